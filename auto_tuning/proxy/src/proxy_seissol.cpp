@@ -133,6 +133,13 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+#ifndef ACL_DEVICE
+    case localfused:
+      for (; t < timesteps; ++t) {
+        computeFusedLocalIntegration();
+      }
+      break;
+#endif
     default:
       break;
   }
@@ -144,6 +151,12 @@ ProxyOutput runProxy(ProxyConfig config) {
 
   registerMarkers();
 
+#ifdef ACL_DEVICE
+  if (config.kernel == localfused) {
+    throw std::runtime_error("the fused local kernel is only available on the host");
+  }
+#endif
+
   bool enableDynamicRupture = false;
   if (config.kernel == neigh_dr || config.kernel == godunov_dr) {
     enableDynamicRupture = true;
@@ -213,6 +226,8 @@ ProxyOutput runProxy(ProxyConfig config) {
       bytes_fun = &bytes_all;
       break;
     case local:
+    case localfused:
+      // the fused kernel computes the same operations as the ADER and the local integration
       flop_fun = &flops_local_actual;
       bytes_fun = &bytes_local;
       break;
@@ -36,6 +36,7 @@ void registerMarkers() {
         LIKWID_MARKER_REGISTER("ader");
         LIKWID_MARKER_REGISTER("localwoader");
         LIKWID_MARKER_REGISTER("local");
+        LIKWID_MARKER_REGISTER("localfused");
         LIKWID_MARKER_REGISTER("neighboring");
     }
 }
@@ -139,6 +140,92 @@ namespace proxy::cpu {
   #endif
   }
 
+#ifdef HOST_CELL_BATCH
+  //! matrices of the full cell batches, packed once as in the time clusters; nullptr for unsupported batches
+  std::vector<kernels::Local::CellBatchMatrices> cellBatchMatrices;
+  std::vector<const kernels::Local::CellBatchMatrices*> cellBatchMatricesOfBatch;
+
+  void packCellBatches(kernels::LocalData::Loader& loader, unsigned nrOfCells) {
+    const unsigned nrOfFullBatches = nrOfCells / kernels::CellBatchSize;
+    cellBatchMatrices.resize(nrOfFullBatches);
+    cellBatchMatricesOfBatch.assign(nrOfFullBatches, nullptr);
+  #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+  #endif
+    for (unsigned batch = 0; batch < nrOfFullBatches; ++batch) {
+      if (m_localKernel.packCellBatchMatrices(loader, batch * kernels::CellBatchSize, cellBatchMatrices[batch])) {
+        cellBatchMatricesOfBatch[batch] = &cellBatchMatrices[batch];
+      }
+    }
+  }
+#endif
+
+  void computeFusedLocalIntegration() {
+    auto&                 layer           = m_ltsTree->child(0).child<Interior>();
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    real**                buffers                       = layer.var(m_lts.buffers);
+    real**                derivatives                   = layer.var(m_lts.derivatives);
+    unsigned              nrOfBatches     = (nrOfCells + kernels::CellBatchSize - 1) / kernels::CellBatchSize;
+
+    kernels::LocalData::Loader loader;
+    loader.load(m_lts, layer);
+
+  #ifdef HOST_CELL_BATCH
+    // the first call packs the matrices, which is not measured
+    if (cellBatchMatrices.size() != nrOfCells / kernels::CellBatchSize) {
+      packCellBatches(loader, nrOfCells);
+    }
+  #endif
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("localfused");
+    kernels::LocalTmp tmp;
+    #pragma omp for schedule(static)
+  #endif
+    for( unsigned int batch = 0; batch < nrOfBatches; batch++ ) {
+      const unsigned firstCell = batch * kernels::CellBatchSize;
+      bool batchFused = false;
+  #ifdef HOST_CELL_BATCH
+      if (batch < cellBatchMatricesOfBatch.size() && cellBatchMatricesOfBatch[batch] != nullptr) {
+        m_localKernel.computeFusedIntegralBatched(seissol::miniSeisSolTimeStep,
+                                                  loader,
+                                                  firstCell,
+                                                  *cellBatchMatricesOfBatch[batch],
+                                                  &buffers[firstCell],
+                                                  &derivatives[firstCell]);
+        batchFused = true;
+      }
+  #endif
+      for( unsigned l_cell = firstCell; !batchFused && l_cell < std::min(firstCell + kernels::CellBatchSize, nrOfCells); l_cell++ ) {
+        auto data = loader.entry(l_cell);
+        if (!m_localKernel.computeFusedIntegral(seissol::miniSeisSolTimeStep,
+                                                data,
+                                                tmp,
+                                                buffers[l_cell],
+                                                derivatives[l_cell])) {
+          m_timeKernel.computeAder(      (double)seissol::miniSeisSolTimeStep,
+                                                 data,
+                                                 tmp,
+                                                 buffers[l_cell],
+                                                 derivatives[l_cell] );
+          m_localKernel.computeIntegral(buffers[l_cell],
+                                        data,
+                                        tmp,
+                                        nullptr,
+                                        nullptr,
+                                        0,
+                                        0);
+        }
+      }
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("localfused");
+    }
+  #endif
+  }
+
   void computeNeighboringIntegration() {
     auto&                     layer                           = m_ltsTree->child(0).child<Interior>();
     unsigned                  nrOfCells                       = layer.getNumberOfCells();
@@ -55,6 +55,13 @@ set(PRECISION "double" CACHE STRING "type of floating point precision, namely: d
 set(PRECISION_OPTIONS single double)
 set_property(CACHE PRECISION PROPERTY STRINGS ${PRECISION_OPTIONS})
 
+option(SINGLE_PRECISION_BUFFERS "Store the time integrated buffers of local time stepping in single precision (requires PRECISION=double)" OFF)
+set(SINGLE_PRECISION_DERIVATIVES 0 CACHE STRING "First time derivative which is stored in single precision for local time stepping, 0 disables (requires PRECISION=double)")
+
+set(FLUX_SOLVERS "stored" CACHE STRING "Flux solvers of the faces: stored per face, or recompute them before use from shared Godunov states (saves memory)")
+set(FLUX_SOLVERS_OPTIONS stored recompute)
+set_property(CACHE FLUX_SOLVERS PROPERTY STRINGS ${FLUX_SOLVERS_OPTIONS})
+
 
 set(PLASTICITY_METHOD "nb" CACHE STRING "Plasticity method: nb (nodal basis) is faster, ip (interpolation points) possibly more accurate. Recommended: nb")
 set(PLASTICITY_OPTIONS nb ip)
@@ -68,6 +75,8 @@ set_property(CACHE DR_QUAD_RULE PROPERTY STRINGS ${DR_QUAD_RULE_OPTIONS})
 
 set(NUMBER_OF_FUSED_SIMULATIONS 1 CACHE STRING "A number of fused simulations")
 
+set(HOST_CELL_BATCH 1 CACHE STRING "Number of cells which are interleaved in the fused local kernel on CPUs, 1 disables the batching")
+
 
 set(MEMORY_LAYOUT "auto" CACHE FILEPATH "A file with a specific memory layout or auto")
 
@@ -113,6 +122,7 @@ check_parameter("DEVICE_ARCH" ${DEVICE_ARCH} "${DEVICE_ARCH_OPTIONS}")
 check_parameter("EQUATIONS" ${EQUATIONS} "${EQUATIONS_OPTIONS}")
 check_parameter("PRECISION" ${PRECISION} "${PRECISION_OPTIONS}")
 check_parameter("PLASTICITY_METHOD" ${PLASTICITY_METHOD} "${PLASTICITY_OPTIONS}")
+check_parameter("FLUX_SOLVERS" ${FLUX_SOLVERS} "${FLUX_SOLVERS_OPTIONS}")
 check_parameter("LOG_LEVEL" ${LOG_LEVEL} "${LOG_LEVEL_OPTIONS}")
 check_parameter("LOG_LEVEL_MASTER" ${LOG_LEVEL_MASTER} "${LOG_LEVEL_MASTER_OPTIONS}")
 
@@ -248,6 +258,54 @@ if (NOT ${NUMBER_OF_FUSED_SIMULATIONS} EQUAL 1 AND NOT ${IS_ALIGNED_MULT_SIMULAT
     message(FATAL_ERROR "a number of fused simulations must be multiple of ${FACTOR}")
 endif()
 
+# check HOST_CELL_BATCH
+if (NOT ${HOST_CELL_BATCH} EQUAL 1)
+    math(EXPR IS_ALIGNED_CELL_BATCH "${HOST_CELL_BATCH} % (${ALIGNMENT} / ${REAL_SIZE_IN_BYTES})")
+    if (NOT ${IS_ALIGNED_CELL_BATCH} EQUAL 0)
+        math(EXPR FACTOR "${ALIGNMENT} / ${REAL_SIZE_IN_BYTES}")
+        message(FATAL_ERROR "the cell batch must be a multiple of ${FACTOR}")
+    endif()
+    if (NOT (EQUATIONS STREQUAL "elastic" OR EQUATIONS STREQUAL "anisotropic"))
+        message(FATAL_ERROR "the cell batch is only supported for the elastic and anisotropic equations")
+    endif()
+    if (NOT ${NUMBER_OF_FUSED_SIMULATIONS} EQUAL 1)
+        message(FATAL_ERROR "the cell batch cannot be combined with fused simulations")
+    endif()
+endif()
+
+# check SINGLE_PRECISION_BUFFERS
+if (SINGLE_PRECISION_BUFFERS)
+    if (NOT PRECISION STREQUAL "double")
+        message(FATAL_ERROR "single precision buffers require PRECISION=double")
+    endif()
+    if (WITH_GPU)
+        message(FATAL_ERROR "single precision buffers are only supported for CPU builds")
+    endif()
+endif()
+
+# check SINGLE_PRECISION_DERIVATIVES
+if (NOT ${SINGLE_PRECISION_DERIVATIVES} EQUAL 0)
+    if (NOT PRECISION STREQUAL "double")
+        message(FATAL_ERROR "single precision derivatives require PRECISION=double")
+    endif()
+    if (WITH_GPU)
+        message(FATAL_ERROR "single precision derivatives are only supported for CPU builds")
+    endif()
+    if (NOT ${SINGLE_PRECISION_DERIVATIVES} LESS ${ORDER})
+        message(FATAL_ERROR "SINGLE_PRECISION_DERIVATIVES has to be smaller than the convergence order ${ORDER}")
+    endif()
+endif()
+
+# check FLUX_SOLVERS
+if (FLUX_SOLVERS STREQUAL "recompute")
+    if (WITH_GPU)
+        message(FATAL_ERROR "recomputed flux solvers are only supported for CPU builds")
+    endif()
+    if (EQUATIONS STREQUAL "anisotropic")
+        message(FATAL_ERROR "recomputed flux solvers are not supported for the anisotropic equations")
+    endif()
+endif()
+
 #-------------------------------------------------------------------------------
 # -------------------- COMPUTE/ADJUST ADDITIONAL PARAMETERS --------------------
 #-------------------------------------------------------------------------------
@@ -232,6 +232,22 @@ class ADERDGBase(ABC):
   def addTime(self, generator, targets):
     pass
 
+  def addFusedLocal(self, generator, targets):
+    """Optional CPU kernel which fuses the time derivatives, the time integration and the local integral."""
+    pass
+
+  def fusedLocalFluxSolvers(self):
+    spp = self.flux_solver_spp()
+    return [Tensor('AplusTFace({})'.format(face), spp.shape, spp=spp) for face in range(4)]
+
+  def taylorSeriesHorner(self, I, derivatives, timestep, indices):
+    """Time integral of the Taylor series over [0, timestep] in Horner form, i.e. evaluated from the highest derivative."""
+    horner = [I[indices] <= derivatives[-1][indices]]
+    for der in range(len(derivatives)-2, -1, -1):
+      horner.append(I[indices] <= derivatives[der][indices] + timestep * ((1.0 / (der+2)) * I[indices]))
+    horner.append(I[indices] <= timestep * I[indices])
+    return horner
+
   def add_include_tensors(self, include_tensors):
     include_tensors.add(self.db.samplingDirections)
     include_tensors.add(self.db.M2inv)
@@ -353,6 +369,86 @@ class LinearADERDG(ADERDGBase):
 
         derivatives.append(dQ)
 
+  def fusedDerivativeSum(self, dQ, star):
+    derivativeSum = Add()
+    if self.sourceMatrix():
+      derivativeSum += dQ['kq'] * self.sourceMatrix()['qp']
+    for j in range(3):
+      derivativeSum += self.db.kDivMT[j][self.t('kl')] * dQ['lq'] * star[j]['qp']
+    return derivativeSum
+
+  def fusedLocalKernel(self, Q, I, derivatives, star, AplusTFace, timestep):
+    fusedLocal = []
+    for i in range(1,self.order):
+      fusedLocal.append(derivatives[i]['kp'] <= self.fusedDerivativeSum(derivatives[i-1], star))
+
+    fusedLocal += self.taylorSeriesHorner(I, derivatives, timestep, 'kp')
+
+    volumeSum = Q['kp']
+    for i in range(3):
+      volumeSum += self.db.kDivM[i][self.t('kl')] * I['lq'] * star[i]['qp']
+    if self.sourceMatrix():
+      volumeSum += I['kq'] * self.sourceMatrix()['qp']
+    fusedLocal.append(Q['kp'] <= volumeSum)
+
+    for face in range(4):
+      fusedLocal.append(Q['kp'] <= Q['kp'] + self.db.rDivM[face][self.t('km')] * self.db.fMrT[face][self.t('ml')] * I['lq'] * AplusTFace[face]['qp'])
+    return fusedLocal
+
+  def addFusedLocal(self, generator, targets):
+    timestep = Scalar('timestep')
+    AplusTFace = self.fusedLocalFluxSolvers()
+    star = [self.starMatrix(i) for i in range(3)]
+
+    generator.add('fusedLocal', self.fusedLocalKernel(self.Q, self.I, self.dQs, star, AplusTFace, timestep), target='cpu')
+
+    cellBatch = self.kwargs.get('cellBatch', 1)
+    if cellBatch > 1:
+      assert not self.sourceMatrix() and not self.Q.hasOptDim()
+      self.addFusedLocalBatched(generator, cellBatch, AplusTFace, timestep)
+
+  def addFusedLocalBatched(self, generator, cellBatch, AplusTFace, timestep):
+    """Fused local kernel for cellBatch cells which are interleaved, such that each cell is computed by one SIMD lane.
+
+    The DOFs are packed into and unpacked from the interleaved layout by the kernels packCellBatch and unpackCellBatch
+    in every time step. The star matrices and the flux solvers do not change, hence packCellBatchMatrices packs them once.
+    """
+    batched = lambda name, shape, spp=None: OptionalDimTensor(name, 'c', cellBatch, 0, shape, spp=spp, alignStride=True)
+    broadcast = lambda tensor: np.broadcast_to(tensor.spp().as_ndarray(), (cellBatch,) + tensor.shape()).copy()
+    lane = [Tensor('cellBatchLane({})'.format(l), (cellBatch,), spp={(l,): '1.0'}) for l in range(cellBatch)]
+
+    qShape = (self.numberOf3DBasisFunctions(), self.numberOfQuantities())
+    QBatch = batched('QBatch', qShape)
+    IBatch = batched('IBatch', qShape)
+    starBatch = [batched('starBatch({})'.format(i), self.starMatrix(i).shape(), broadcast(self.starMatrix(i))) for i in range(3)]
+    AplusTBatch = [batched('AplusTBatch({})'.format(face), self.AplusT.shape(), broadcast(self.AplusT)) for face in range(4)]
+
+    dQBatch = [batched('dQBatch(0)', qShape)]
+    for i in range(1,self.order):
+      derivativeSum = self.fusedDerivativeSum(dQBatch[-1], starBatch)
+      derivativeSum = DeduceIndices( QBatch['kp'].indices ).visit(derivativeSum)
+      derivativeSum = EquivalentSparsityPattern().visit(derivativeSum)
+      dQBatch.append(batched('dQBatch({})'.format(i), qShape, spp=derivativeSum.eqspp()))
+
+    generator.add('fusedLocalBatched', self.fusedLocalKernel(QBatch, IBatch, dQBatch, starBatch, AplusTBatch, timestep), target='cpu')
+
+    # The first lane is assigned, which zeroes the other lanes, hence the batch needs no initialization
+    packLane = lambda l, batch, cell: batch <= (lane[l]['c'] * cell if l == 0 else batch + lane[l]['c'] * cell)
+    generator.addFamily('packCellBatch', simpleParameterSpace(cellBatch), lambda l:
+      packLane(l, QBatch['kp'], self.Q['kp']),
+      target='cpu')
+    generator.addFamily('packCellBatchMatrices', simpleParameterSpace(cellBatch), lambda l:
+      [packLane(l, starBatch[i]['qp'], self.starMatrix(i)['qp']) for i in range(3)] +
+      [packLane(l, AplusTBatch[face]['qp'], AplusTFace[face]['qp']) for face in range(4)],
+      target='cpu')
+    generator.addFamily('unpackCellBatch', simpleParameterSpace(cellBatch), lambda l: [
+      self.Q['kp'] <= lane[l]['c'] * QBatch['kp'],
+      self.I['kp'] <= lane[l]['c'] * IBatch['kp']
+    ], target='cpu')
+    generator.addFamily('unpackCellBatchDerivatives', simpleParameterSpace(cellBatch), lambda l:
+      [self.dQs[i]['kp'] <= lane[l]['c'] * dQBatch[i]['kp'] for i in range(1,self.order)],
+      target='cpu')
+
   def add_include_tensors(self, include_tensors):
     super().add_include_tensors(include_tensors)
     include_tensors.add(self.db.nodes2D)
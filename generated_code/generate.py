@@ -66,6 +66,7 @@ cmdLineParser.add_argument('--order', type=int)
 cmdLineParser.add_argument('--numberOfMechanisms', type=int)
 cmdLineParser.add_argument('--memLayout')
 cmdLineParser.add_argument('--multipleSimulations', type=int)
+cmdLineParser.add_argument('--cellBatch', type=int, default=1)
 cmdLineParser.add_argument('--PlasticityMethod')
 cmdLineParser.add_argument('--gemm_tools')
 cmdLineParser.add_argument('--drQuadRule')
@@ -129,6 +130,7 @@ adg.addInit(generator)
 adg.addLocal(generator, targets)
 adg.addNeighbor(generator, targets)
 adg.addTime(generator, targets)
+adg.addFusedLocal(generator, targets)
 adg.add_include_tensors(include_tensors)
 
 # Common kernels
@@ -191,6 +191,10 @@ class PoroelasticADERDG(LinearADERDG):
     evaluateDOFSAtTimeSTP = QAtTimeSTP['kp'] <= spaceTimePredictor['kpt'] * timeBasisFunctionsAtPoint['t']
     generator.add('evaluateDOFSAtTimeSTP', evaluateDOFSAtTimeSTP)
 
+  def addFusedLocal(self, generator, targets):
+    # The space-time predictor is not expressed with time derivatives
+    pass
+
   def add_include_tensors(self, include_tensors):
     super().add_include_tensors(include_tensors)
     include_tensors.add(self.db.Z)
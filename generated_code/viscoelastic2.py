@@ -159,35 +159,63 @@ class Viscoelastic2ADERDG(ADERDGBase):
       self.Q['kp'] <= self.Q['kp'] + self.Qext['kq'] * self.selectEla['qp']
     ])
 
+  def derivative(self, kthDer):
+    derivativeSum = Add()
+    for j in range(3):
+      derivativeSum += self.db.kDivMT[j][self.t('kl')] * self.dQs[kthDer-1]['lq'] * self.db.star[j]['qp']
+    return [
+      self.dQext[kthDer]['kp'] <= derivativeSum,
+      self.dQs[kthDer]['kp'] <= self.dQext[kthDer]['kq'] * self.selectEla['qp'] + self.dQane[kthDer-1]['kqm'] * self.E['qmp'],
+      self.dQane[kthDer]['kpm'] <= self.w['m'] * self.dQext[kthDer]['kq'] * self.selectAne['qp'] + self.dQane[kthDer-1]['kpl'] * self.W['lm']
+    ]
+
   def addTime(self, generator, targets):
     qShape = (self.numberOf3DBasisFunctions(), self.numberOfQuantities())
     dQ = [OptionalDimTensor('dQ({})'.format(d), self.Q.optName(), self.Q.optSize(), self.Q.optPos(), qShape, alignStride=True) for d in range(self.order)]
     self.dQs = dQ
     dQext = [OptionalDimTensor('dQext({})'.format(d), self.Q.optName(), self.Q.optSize(), self.Q.optPos(), self._qShapeExtended, alignStride=True) for d in range(self.order)]
     dQane = [OptionalDimTensor('dQane({})'.format(d), self.Q.optName(), self.Q.optSize(), self.Q.optPos(), self._qShapeAnelastic, alignStride=True) for d in range(self.order)]
+    self.dQext = dQext
+    self.dQane = dQane
 
     power = Scalar('power')
 
     derivativeTaylorExpansionEla = lambda d: (self.I['kp'] <= self.I['kp'] + power * dQ[d]['kp']) if d > 0 else (self.I['kp'] <= power * dQ[0]['kp'])
     derivativeTaylorExpansionAne = lambda d: (self.Iane['kpm'] <= self.Iane['kpm'] + power * dQane[d]['kpm']) if d > 0 else (self.Iane['kpm'] <= power * dQane[0]['kpm'])
 
-    def derivative(kthDer):
-      derivativeSum = Add()
-      for j in range(3):
-        derivativeSum += self.db.kDivMT[j][self.t('kl')] * dQ[kthDer-1]['lq'] * self.db.star[j]['qp']
-      return derivativeSum
-
-    generator.addFamily('derivative', parameterSpaceFromRanges(range(1,self.order)), lambda d: [
-      dQext[d]['kp'] <= derivative(d),
-      dQ[d]['kp'] <= dQext[d]['kq'] * self.selectEla['qp'] + dQane[d-1]['kqm'] * self.E['qmp'],
-      dQane[d]['kpm'] <= self.w['m'] * dQext[d]['kq'] * self.selectAne['qp'] + dQane[d-1]['kpl'] * self.W['lm']
-    ])
+    generator.addFamily('derivative', parameterSpaceFromRanges(range(1,self.order)), self.derivative)
     generator.addFamily('derivativeTaylorExpansion', simpleParameterSpace(self.order), lambda d: [
       derivativeTaylorExpansionEla(d),
       derivativeTaylorExpansionAne(d)
     ])
     generator.addFamily('derivativeTaylorExpansionEla', simpleParameterSpace(self.order), derivativeTaylorExpansionEla)
 
+  def addFusedLocal(self, generator, targets):
+    timestep = Scalar('timestep')
+    AplusTFace = self.fusedLocalFluxSolvers()
+
+    fusedLocal = []
+    for d in range(1,self.order):
+      fusedLocal += self.derivative(d)
+
+    fusedLocal += self.taylorSeriesHorner(self.I, self.dQs, timestep, 'kp')
+    fusedLocal += self.taylorSeriesHorner(self.Iane, self.dQane, timestep, 'kpm')
+
+    volumeSum = Add()
+    for i in range(3):
+      volumeSum += self.db.kDivM[i][self.t('kl')] * self.I['lq'] * self.db.star[i]['qp']
+    fusedLocal.append(self.Qext['kp'] <= volumeSum)
+
+    for face in range(4):
+      fusedLocal.append(self.Qext['kp'] <= self.Qext['kp'] + self.db.rDivM[face][self.t('km')] * self.db.fMrT[face][self.t('ml')] * self.I['lq'] * AplusTFace[face]['qp'])
+
+    fusedLocal += [
+      self.Qane['kpm'] <= self.Qane['kpm'] + self.w['m'] * self.Qext['kq'] * self.selectAne['qp'] + self.Iane['kpl'] * self.W['lm'],
+      self.Q['kp'] <= self.Q['kp'] + self.Qext['kq'] * self.selectEla['qp'] + self.Iane['kqm'] * self.E['qmp']
+    ]
+
+    generator.add('fusedLocal', fusedLocal, target='cpu')
+
   def add_include_tensors(self, include_tensors):
     super().add_include_tensors(include_tensors)
     include_tensors.add(self.db.nodes2D)
@@ -2,6 +2,9 @@
 
 #include "FrictionLaws/FrictionLaws.h"
 #include "FrictionLaws/ThermalPressurization/ThermalPressurization.h"
+#include "Parallel/MPI.h"
+#include "utils/env.h"
+#include "utils/logger.h"
 
 #ifdef ACL_DEVICE
 namespace friction_law_impl = seissol::dr::friction_law::gpu;
@@ -11,6 +14,14 @@ namespace friction_law_impl = seissol::dr::friction_law;
 
 namespace seissol::dr::factory {
 std::unique_ptr<AbstractFactory> getFactory(std::shared_ptr<dr::DRParameters> drParameters) {
+  // only the linear slip weakening law without specialization evaluates batches of faces
+  if (utils::Env::get<bool>("SEISSOL_DR_FACE_BATCHING", false) &&
+      drParameters->frictionLawType != FrictionLawType::NoFault &&
+      drParameters->frictionLawType != FrictionLawType::LinearSlipWeakening) {
+    logWarning(seissol::MPI::mpi.rank())
+        << "SEISSOL_DR_FACE_BATCHING is ignored: only the linear slip weakening law (type 16)"
+        << "evaluates batches of faces.";
+  }
   switch (drParameters->frictionLawType) {
   case FrictionLawType::NoFault:
     return std::make_unique<NoFaultFactory>(drParameters);
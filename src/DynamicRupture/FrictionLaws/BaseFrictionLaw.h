@@ -1,6 +1,7 @@
 #ifndef SEISSOL_BASEFRICTIONLAW_H
 #define SEISSOL_BASEFRICTIONLAW_H
 
+#include <algorithm>
 #include <yaml-cpp/yaml.h>
 
 #include "DynamicRupture/Misc.h"
@@ -19,6 +20,13 @@ class BaseFrictionLaw : public FrictionSolver {
   public:
   explicit BaseFrictionLaw(dr::DRParameters* drParameters) : FrictionSolver(drParameters){};
 
+  /**
+   * Friction laws which can be evaluated for several faces at once set this to true and provide
+   * FaceBatch, threadFaceBatch, packFaceBatch, packInitialStress, updateFrictionAndSlipBatch,
+   * unpackFaceBatch and the flag useFaceBatching.
+   */
+  static constexpr bool SupportsFaceBatching = false;
+
   /**
    * evaluates the current friction model
    */
@@ -30,6 +38,13 @@ class BaseFrictionLaw : public FrictionSolver {
     BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
 
+    if constexpr (Derived::SupportsFaceBatching) {
+      if (static_cast<Derived*>(this)->useFaceBatching) {
+        evaluateFaceBatches(layerData.getNumberOfCells(), timeWeights);
+        return;
+      }
+    }
+
     // loop over all dynamic rupture faces, in this LTS layer
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
@@ -127,6 +142,118 @@ class BaseFrictionLaw : public FrictionSolver {
       }
     }
   }
+
+  private:
+  /**
+   * Same as evaluate, but the friction law is evaluated for batches of misc::faceBatchSize faces,
+   * see Derived::FaceBatch. Requires Derived::SupportsFaceBatching.
+   */
+  void evaluateFaceBatches(unsigned numberOfFaces, const double timeWeights[CONVERGENCE_ORDER]) {
+    using FaceBatch = typename Derived::FaceBatch;
+    const unsigned numberOfBatches = (numberOfFaces + FaceBatch::Size - 1) / FaceBatch::Size;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      SCOREP_USER_REGION_DEFINE(myRegionHandle)
+      FaceBatch& batch = static_cast<Derived*>(this)->threadFaceBatch();
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (unsigned batchIndex = 0; batchIndex < numberOfBatches; ++batchIndex) {
+        const unsigned firstFace = batchIndex * FaceBatch::Size;
+        const unsigned batchSize = std::min(FaceBatch::Size, numberOfFaces - firstFace);
+
+        SCOREP_USER_REGION_BEGIN(
+            myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
+        LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
+        for (unsigned lane = 0; lane < batchSize; ++lane) {
+          const unsigned ltsFace = firstFace + lane;
+          common::precomputeStressFromQInterpolated(batch.faultStresses[lane],
+                                                    impAndEta[ltsFace],
+                                                    impedanceMatrices[ltsFace],
+                                                    qInterpolatedPlus[ltsFace],
+                                                    qInterpolatedMinus[ltsFace]);
+        }
+        LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
+        SCOREP_USER_REGION_END(myRegionHandle)
+
+        SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                                 "computeDynamicRuptureUpdateFrictionAndSlip",
+                                 SCOREP_USER_REGION_TYPE_COMMON)
+        LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
+        static_cast<Derived*>(this)->packFaceBatch(batch, firstFace, batchSize);
+
+        for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+          if (this->mFullUpdateTime <= this->drParameters->t0) {
+            for (unsigned ltsFace = firstFace; ltsFace < firstFace + batchSize; ++ltsFace) {
+              common::adjustInitialStress(initialStressInFaultCS[ltsFace],
+                                          nucleationStressInFaultCS[ltsFace],
+                                          initialPressure[ltsFace],
+                                          nucleationPressure[ltsFace],
+                                          this->mFullUpdateTime,
+                                          this->drParameters->t0,
+                                          this->deltaT[timeIndex]);
+            }
+            static_cast<Derived*>(this)->packInitialStress(batch, firstFace, batchSize);
+          }
+          static_cast<Derived*>(this)->updateFrictionAndSlipBatch(batch, timeIndex);
+        }
+        static_cast<Derived*>(this)->unpackFaceBatch(batch, firstFace, batchSize);
+        LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
+        SCOREP_USER_REGION_END(myRegionHandle)
+
+        SCOREP_USER_REGION_BEGIN(
+            myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
+        LIKWID_MARKER_START("computeDynamicRupturePostHook");
+        for (unsigned ltsFace = firstFace; ltsFace < firstFace + batchSize; ++ltsFace) {
+          common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
+                                         ruptureTime[ltsFace],
+                                         slipRateMagnitude[ltsFace],
+                                         mFullUpdateTime);
+
+          static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
+
+          common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
+        }
+        LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
+        SCOREP_USER_REGION_END(myRegionHandle)
+
+        SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                                 "computeDynamicRupturePostcomputeImposedState",
+                                 SCOREP_USER_REGION_TYPE_COMMON)
+        LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
+        for (unsigned lane = 0; lane < batchSize; ++lane) {
+          const unsigned ltsFace = firstFace + lane;
+          common::postcomputeImposedStateFromNewStress(batch.faultStresses[lane],
+                                                       batch.tractionResults[lane],
+                                                       impAndEta[ltsFace],
+                                                       impedanceMatrices[ltsFace],
+                                                       imposedStatePlus[ltsFace],
+                                                       imposedStateMinus[ltsFace],
+                                                       qInterpolatedPlus[ltsFace],
+                                                       qInterpolatedMinus[ltsFace],
+                                                       timeWeights);
+        }
+        LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
+        SCOREP_USER_REGION_END(myRegionHandle)
+
+        if (this->drParameters->isFrictionEnergyRequired) {
+          for (unsigned ltsFace = firstFace; ltsFace < firstFace + batchSize; ++ltsFace) {
+            common::computeFrictionEnergy(energyData[ltsFace],
+                                          qInterpolatedPlus[ltsFace],
+                                          qInterpolatedMinus[ltsFace],
+                                          impAndEta[ltsFace],
+                                          timeWeights,
+                                          spaceWeights,
+                                          godunovData[ltsFace]);
+          }
+        }
+      }
+    }
+  }
 };
 } // namespace seissol::dr::friction_law
 
@@ -6,6 +6,10 @@
 #include "Initializer/DynamicRupture.h"
 #include "Kernels/DynamicRupture.h"
 
+namespace seissol {
+class LoopStatistics;
+} // namespace seissol
+
 namespace seissol::dr::friction_law {
 /**
  * Abstract Base for friction solver class with the public interface
@@ -28,6 +32,12 @@ class FrictionSolver {
                         real fullUpdateTime,
                         const double timeWeights[CONVERGENCE_ORDER]) = 0;
 
+  /**
+   * adds the statistics which the friction law gathered during the simulation, e.g. histograms of
+   * iteration counts, to loopStatistics
+   */
+  virtual void addToLoopStatistics(LoopStatistics& loopStatistics) {}
+
   /**
    * compute the DeltaT from the current timePoints call this function before evaluate
    * to set the correct DeltaT
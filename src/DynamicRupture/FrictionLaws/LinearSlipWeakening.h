@@ -3,6 +3,13 @@
 
 #include "BaseFrictionLaw.h"
 
+#include <cassert>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "utils/env.h"
 #include "utils/logger.h"
 
 namespace seissol::dr::friction_law {
@@ -16,7 +23,65 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
   public:
   explicit LinearSlipWeakeningLaw(DRParameters* drParameters)
       : BaseFrictionLaw<LinearSlipWeakeningLaw<SpecializationT>>(drParameters),
-        specialization(drParameters) {}
+        specialization(drParameters) {
+    setFaceBatching(utils::Env::get<bool>("SEISSOL_DR_FACE_BATCHING", false));
+  }
+
+  static constexpr bool SupportsFaceBatching = SpecializationT::SupportsFaceBatching;
+
+  /**
+   * The state of misc::faceBatchSize faces during the update of friction and slip.
+   * The per-point values are interleaved, such that each face is computed by one SIMD lane,
+   * and only the Gauss points are stored. Lanes without a face repeat the first face of the batch.
+   */
+  struct FaceBatch {
+    static constexpr unsigned Size = misc::faceBatchSize;
+    using LaneArray = real[misc::numberOfBoundaryGaussPoints][Size];
+
+    unsigned ltsFace[Size];
+    FaultStresses faultStresses[Size];
+    TractionResults tractionResults[Size];
+
+    alignas(ALIGNMENT) real etaS[Size];
+    alignas(ALIGNMENT) real invEtaS[Size];
+
+    // initial stresses including the fluid pressure, and the stresses of the current time step
+    alignas(ALIGNMENT) LaneArray initialNormalStress, initialTraction1, initialTraction2;
+    alignas(ALIGNMENT) LaneArray normalStress, traction1, traction2;
+
+    // parameters of the friction law
+    alignas(ALIGNMENT) LaneArray dC, muS, muD, cohesion, forcedRuptureTime;
+
+    // variables of the layer which are updated in each time step
+    alignas(ALIGNMENT) LaneArray mu, slipRateMagnitude, slipRate1, slipRate2, slip1, slip2,
+        accumulatedSlipMagnitude, tractionResult1, tractionResult2;
+  };
+
+  /**
+   * Enables or disables the evaluation in batches of faces, if supported by the specialization.
+   * The batches are too large for the stack of the threads, hence one batch per thread is
+   * allocated here once.
+   */
+  void setFaceBatching(bool enable) {
+    useFaceBatching = SupportsFaceBatching && enable;
+#ifdef _OPENMP
+    const int numberOfThreads = omp_get_max_threads();
+#else
+    const int numberOfThreads = 1;
+#endif
+    faceBatches.resize(useFaceBatching ? numberOfThreads : 0);
+  }
+
+  //! the face batch of the calling thread
+  FaceBatch& threadFaceBatch() {
+#ifdef _OPENMP
+    const auto thread = static_cast<std::size_t>(omp_get_thread_num());
+#else
+    const std::size_t thread = 0;
+#endif
+    assert(thread < faceBatches.size());
+    return faceBatches[thread];
+  }
 
   void updateFrictionAndSlip(FaultStresses const& faultStresses,
                              TractionResults& tractionResults,
@@ -195,6 +260,164 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
     }
   }
 
+  void packFaceBatch(FaceBatch& batch, unsigned firstFace, unsigned batchSize) {
+    for (unsigned lane = 0; lane < FaceBatch::Size; ++lane) {
+      const unsigned ltsFace = firstFace + (lane < batchSize ? lane : 0);
+      batch.ltsFace[lane] = ltsFace;
+      batch.etaS[lane] = this->impAndEta[ltsFace].etaS;
+      batch.invEtaS[lane] = this->impAndEta[ltsFace].invEtaS;
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+        batch.dC[pointIndex][lane] = dC[ltsFace][pointIndex];
+        batch.muS[pointIndex][lane] = muS[ltsFace][pointIndex];
+        batch.muD[pointIndex][lane] = muD[ltsFace][pointIndex];
+        batch.cohesion[pointIndex][lane] = cohesion[ltsFace][pointIndex];
+        batch.forcedRuptureTime[pointIndex][lane] = forcedRuptureTime[ltsFace][pointIndex];
+        batch.mu[pointIndex][lane] = this->mu[ltsFace][pointIndex];
+        batch.slipRateMagnitude[pointIndex][lane] = this->slipRateMagnitude[ltsFace][pointIndex];
+        batch.slipRate1[pointIndex][lane] = this->slipRate1[ltsFace][pointIndex];
+        batch.slipRate2[pointIndex][lane] = this->slipRate2[ltsFace][pointIndex];
+        batch.slip1[pointIndex][lane] = this->slip1[ltsFace][pointIndex];
+        batch.slip2[pointIndex][lane] = this->slip2[ltsFace][pointIndex];
+        batch.accumulatedSlipMagnitude[pointIndex][lane] =
+            this->accumulatedSlipMagnitude[ltsFace][pointIndex];
+      }
+    }
+    packInitialStress(batch, firstFace, batchSize);
+  }
+
+  void packInitialStress(FaceBatch& batch, unsigned firstFace, unsigned batchSize) {
+    for (unsigned lane = 0; lane < FaceBatch::Size; ++lane) {
+      const unsigned ltsFace = firstFace + (lane < batchSize ? lane : 0);
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+        batch.initialNormalStress[pointIndex][lane] =
+            this->initialStressInFaultCS[ltsFace][pointIndex][0] +
+            this->initialPressure[ltsFace][pointIndex];
+        batch.initialTraction1[pointIndex][lane] =
+            this->initialStressInFaultCS[ltsFace][pointIndex][3];
+        batch.initialTraction2[pointIndex][lane] =
+            this->initialStressInFaultCS[ltsFace][pointIndex][5];
+      }
+    }
+  }
+
+  /**
+   * Same as updateFrictionAndSlip, i.e. calcStrengthHook, calcSlipRateAndTraction,
+   * calcStateVariableHook and frictionFunctionHook, for all faces of the batch.
+   */
+  void updateFrictionAndSlipBatch(FaceBatch& batch, unsigned timeIndex) {
+    constexpr unsigned numPoints = misc::numberOfBoundaryGaussPoints;
+    const real deltaTime = this->deltaT[timeIndex];
+
+    for (unsigned lane = 0; lane < FaceBatch::Size; ++lane) {
+      const auto& faultStresses = batch.faultStresses[lane];
+      for (unsigned pointIndex = 0; pointIndex < numPoints; pointIndex++) {
+        batch.normalStress[pointIndex][lane] = faultStresses.normalStress[timeIndex][pointIndex] +
+                                               faultStresses.fluidPressure[timeIndex][pointIndex];
+        batch.traction1[pointIndex][lane] = faultStresses.traction1[timeIndex][pointIndex];
+        batch.traction2[pointIndex][lane] = faultStresses.traction2[timeIndex][pointIndex];
+      }
+    }
+
+    for (unsigned pointIndex = 0; pointIndex < numPoints; pointIndex++) {
+#pragma omp simd
+      for (unsigned lane = 0; lane < FaceBatch::Size; ++lane) {
+        // fault strength (Uphoff eq 2.44) with cohesion
+        const real totalNormalStress =
+            batch.initialNormalStress[pointIndex][lane] + batch.normalStress[pointIndex][lane];
+        const real strength = specialization.strengthHook(
+            -batch.cohesion[pointIndex][lane] -
+                batch.mu[pointIndex][lane] * std::min(totalNormalStress, static_cast<real>(0.0)),
+            batch.slipRateMagnitude[pointIndex][lane],
+            deltaTime,
+            batch.ltsFace[lane],
+            pointIndex);
+
+        const real totalTraction1 =
+            batch.initialTraction1[pointIndex][lane] + batch.traction1[pointIndex][lane];
+        const real totalTraction2 =
+            batch.initialTraction2[pointIndex][lane] + batch.traction2[pointIndex][lane];
+        const real absoluteTraction = misc::magnitude(totalTraction1, totalTraction2);
+
+        const real slipRateMagnitude = std::max(
+            static_cast<real>(0.0), (absoluteTraction - strength) * batch.invEtaS[lane]);
+        const real divisor = strength + batch.etaS[lane] * slipRateMagnitude;
+        const real slipRate1 = slipRateMagnitude * totalTraction1 / divisor;
+        const real slipRate2 = slipRateMagnitude * totalTraction2 / divisor;
+
+        batch.slipRateMagnitude[pointIndex][lane] = slipRateMagnitude;
+        batch.slipRate1[pointIndex][lane] = slipRate1;
+        batch.slipRate2[pointIndex][lane] = slipRate2;
+        batch.tractionResult1[pointIndex][lane] =
+            batch.traction1[pointIndex][lane] - batch.etaS[lane] * slipRate1;
+        batch.tractionResult2[pointIndex][lane] =
+            batch.traction2[pointIndex][lane] - batch.etaS[lane] * slipRate2;
+        batch.slip1[pointIndex][lane] += slipRate1 * deltaTime;
+        batch.slip2[pointIndex][lane] += slipRate2 * deltaTime;
+      }
+    }
+
+    alignas(ALIGNMENT) real resampledSlipRate[numPoints][FaceBatch::Size];
+    specialization.resampleSlipRateBatch(resampledSlipRate, batch.slipRateMagnitude);
+
+    const real time = this->mFullUpdateTime + deltaTime;
+    const real t0 = this->drParameters->t0;
+    for (unsigned pointIndex = 0; pointIndex < numPoints; pointIndex++) {
+#pragma omp simd
+      for (unsigned lane = 0; lane < FaceBatch::Size; ++lane) {
+        batch.accumulatedSlipMagnitude[pointIndex][lane] +=
+            resampledSlipRate[pointIndex][lane] * deltaTime;
+        real stateVariable =
+            std::min(std::fabs(batch.accumulatedSlipMagnitude[pointIndex][lane]) /
+                         batch.dC[pointIndex][lane],
+                     static_cast<real>(1.0));
+
+        // forced rupture time
+        real f2 = 0.0;
+        if (t0 == 0) {
+          f2 = 1.0 * (time >= batch.forcedRuptureTime[pointIndex][lane]);
+        } else {
+          f2 = std::clamp((time - batch.forcedRuptureTime[pointIndex][lane]) / t0,
+                          static_cast<real>(0.0),
+                          static_cast<real>(1.0));
+        }
+        stateVariable = std::max(stateVariable, f2);
+
+        batch.mu[pointIndex][lane] =
+            batch.muS[pointIndex][lane] -
+            (batch.muS[pointIndex][lane] - batch.muD[pointIndex][lane]) * stateVariable;
+      }
+    }
+
+    for (unsigned lane = 0; lane < FaceBatch::Size; ++lane) {
+      auto& tractionResults = batch.tractionResults[lane];
+      for (unsigned pointIndex = 0; pointIndex < numPoints; pointIndex++) {
+        tractionResults.traction1[timeIndex][pointIndex] = batch.tractionResult1[pointIndex][lane];
+        tractionResults.traction2[timeIndex][pointIndex] = batch.tractionResult2[pointIndex][lane];
+      }
+    }
+  }
+
+  void unpackFaceBatch(FaceBatch const& batch, unsigned firstFace, unsigned batchSize) {
+    for (unsigned lane = 0; lane < batchSize; ++lane) {
+      const unsigned ltsFace = firstFace + lane;
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+        this->mu[ltsFace][pointIndex] = batch.mu[pointIndex][lane];
+        this->slipRateMagnitude[ltsFace][pointIndex] = batch.slipRateMagnitude[pointIndex][lane];
+        this->slipRate1[ltsFace][pointIndex] = batch.slipRate1[pointIndex][lane];
+        this->slipRate2[ltsFace][pointIndex] = batch.slipRate2[pointIndex][lane];
+        this->slip1[ltsFace][pointIndex] = batch.slip1[pointIndex][lane];
+        this->slip2[ltsFace][pointIndex] = batch.slip2[pointIndex][lane];
+        this->accumulatedSlipMagnitude[ltsFace][pointIndex] =
+            batch.accumulatedSlipMagnitude[pointIndex][lane];
+        this->traction1[ltsFace][pointIndex] = batch.tractionResult1[pointIndex][lane];
+        this->traction2[ltsFace][pointIndex] = batch.tractionResult2[pointIndex][lane];
+      }
+    }
+  }
+
+  //! true if the faces are evaluated in batches, see SEISSOL_DR_FACE_BATCHING
+  bool useFaceBatching = false;
+
   protected:
   real (*dC)[misc::numPaddedPoints];
   real (*muS)[misc::numPaddedPoints];
@@ -202,12 +425,17 @@ class LinearSlipWeakeningLaw : public BaseFrictionLaw<LinearSlipWeakeningLaw<Spe
   real (*cohesion)[misc::numPaddedPoints];
   real (*forcedRuptureTime)[misc::numPaddedPoints];
   SpecializationT specialization;
+
+  private:
+  std::vector<FaceBatch> faceBatches;
 };
 
 class NoSpecialization {
   public:
   explicit NoSpecialization(DRParameters* parameters){};
 
+  static constexpr bool SupportsFaceBatching = true;
+
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
                           real fullUpdateTime){};
@@ -219,6 +447,32 @@ class NoSpecialization {
    */
   void resampleSlipRate(real (&resampledSlipRate)[dr::misc::numPaddedPoints],
                         real const (&slipRate)[dr::misc::numPaddedPoints]);
+
+  /**
+   * Same as resampleSlipRate for the Gauss points of a batch of faces, where the values of the
+   * faces are interleaved (see LinearSlipWeakeningLaw::FaceBatch).
+   */
+  template <unsigned Lanes>
+  void resampleSlipRateBatch(
+      real (&resampledSlipRate)[dr::misc::numberOfBoundaryGaussPoints][Lanes],
+      real const (&slipRate)[dr::misc::numberOfBoundaryGaussPoints][Lanes]) {
+    auto resample = init::resample::view::create(const_cast<real*>(init::resample::Values));
+    for (unsigned pointIndex = 0; pointIndex < dr::misc::numberOfBoundaryGaussPoints;
+         pointIndex++) {
+#pragma omp simd
+      for (unsigned lane = 0; lane < Lanes; ++lane) {
+        resampledSlipRate[pointIndex][lane] = 0.0;
+      }
+      for (unsigned j = 0; j < dr::misc::numberOfBoundaryGaussPoints; j++) {
+        const real weight = resample(pointIndex, j);
+#pragma omp simd
+        for (unsigned lane = 0; lane < Lanes; ++lane) {
+          resampledSlipRate[pointIndex][lane] += weight * slipRate[j][lane];
+        }
+      }
+    }
+  }
+
 #pragma omp declare simd
   real strengthHook(real strength,
                     real localSlipRate,
@@ -236,6 +490,9 @@ class BiMaterialFault {
   public:
   explicit BiMaterialFault(DRParameters* parameters) : drParameters(parameters){};
 
+  // the regularised strength is stored per face
+  static constexpr bool SupportsFaceBatching = false;
+
   void copyLtsTreeToLocal(seissol::initializers::Layer& layerData,
                           seissol::initializers::DynamicRupture const* const dynRup,
                           real fullUpdateTime);
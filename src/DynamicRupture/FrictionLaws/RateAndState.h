@@ -3,6 +3,7 @@
 
 #include "BaseFrictionLaw.h"
 #include "DynamicRupture/FrictionLaws/RateAndStateCommon.h"
+#include "Monitoring/LoopStatistics.h"
 
 namespace seissol::dr::friction_law {
 /**
@@ -24,6 +25,15 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                              unsigned timeIndex) {
     bool hasConverged = false;
 
+    // warm start the Newton iteration from the slip rate found at the previous time quadrature
+    // point, before calcInitialVariables replaces it by the magnitude of the slip rate vector
+    std::array<real, misc::numPaddedPoints> testSlipRate;
+#pragma omp simd
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      testSlipRate[pointIndex] =
+          std::max(rs::almostZero(), this->slipRateMagnitude[ltsFace][pointIndex]);
+    }
+
     // compute initial slip rate and reference values
     auto initialVariables = static_cast<Derived*>(this)->calcInitialVariables(
         faultStresses, stateVariableBuffer, timeIndex, ltsFace);
@@ -41,6 +51,7 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                                        stateVariableBuffer,
                                        normalStress,
                                        absoluteShearStress,
+                                       testSlipRate,
                                        faultStresses,
                                        timeIndex,
                                        ltsFace);
@@ -89,6 +100,19 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
     tpMethod.copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
   }
 
+  void addToLoopStatistics(LoopStatistics& loopStatistics) override {
+    const auto histogram =
+        loopStatistics.addHistogram("rateAndStateNewtonUpdates", newtonUpdateCounts.size());
+    for (unsigned bin = 0; bin < newtonUpdateCounts.size(); ++bin) {
+      loopStatistics.addToHistogram(histogram, bin, newtonUpdateCounts[bin]);
+    }
+    // the counts are handed over, such that repeated calls do not count them twice
+    newtonUpdateCounts.fill(0);
+  }
+
+  //! number of points per Newton update count since the last call of addToLoopStatistics
+  const auto& getNewtonUpdateCounts() const { return newtonUpdateCounts; }
+
   /**
    * Contains all the variables, which are to be computed initially in each timestep.
    */
@@ -144,10 +168,10 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
       std::array<real, misc::numPaddedPoints>& localStateVariable,
       std::array<real, misc::numPaddedPoints>& normalStress,
       std::array<real, misc::numPaddedPoints> const& absoluteShearStress,
+      std::array<real, misc::numPaddedPoints>& testSlipRate,
       FaultStresses const& faultStresses,
       unsigned int timeIndex,
       unsigned int ltsFace) {
-    std::array<real, misc::numPaddedPoints> testSlipRate{0};
     for (unsigned j = 0; j < settings.numberStateVariableUpdates; j++) {
 #pragma omp simd
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
@@ -280,60 +304,74 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
    * \f[g := \frac{1}{\eta_s} \cdot (\sigma_n \cdot \mu - \Theta) - \hat{s} = 0.\f] c.f. Carsten
    * Uphoff's dissertation eq. (4.57). Find root of \f$g\f$ with \f$g^\prime = \partial g / \partial
    * \hat{s}\f$: \f$\hat{s}_{i+1} = \hat{s}_i - ( g_i / g^\prime_i )\f$
+   * Points which have converged keep their slip rate, the iteration stops as soon as all points
+   * have converged. The number of updates per point is counted in newtonUpdateCounts.
    * @param ltsFace index of the face for which we invert the sliprate
    * @param localStateVariable \f$\psi\f$, needed to compute \f$\mu = f(\hat{s}, \psi)\f$
    * @param normalStress \f$\sigma_n\f$
    * @param absoluteShearStress \f$\Theta\f$
-   * @param slipRateTest \f$\hat{s}\f$
+   * @param slipRateTest \f$\hat{s}\f$, contains the initial guess on entry
    */
   bool invertSlipRateIterative(unsigned int ltsFace,
                                std::array<real, misc::numPaddedPoints> const& localStateVariable,
                                std::array<real, misc::numPaddedPoints> const& normalStress,
                                std::array<real, misc::numPaddedPoints> const& absoluteShearStress,
                                std::array<real, misc::numPaddedPoints>& slipRateTest) {
-    // Note that we need double precision here, since single precision led to NaNs.
-    double muF[misc::numPaddedPoints], dMuF[misc::numPaddedPoints];
-    double g[misc::numPaddedPoints], dG[misc::numPaddedPoints];
-
+    // the padded points do not take part in the iteration
+    bool isActive[misc::numPaddedPoints];
+    unsigned numberOfUpdates[misc::numPaddedPoints];
+#pragma omp simd
     for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
-      // first guess = sliprate value of the previous step
-      slipRateTest[pointIndex] = this->slipRateMagnitude[ltsFace][pointIndex];
+      isActive[pointIndex] = pointIndex < misc::numberOfBoundaryGaussPoints;
+      numberOfUpdates[pointIndex] = 0;
     }
 
-    for (unsigned i = 0; i < settings.maxNumberSlipRateUpdates; i++) {
-#pragma omp simd
+    unsigned numberOfActivePoints = misc::numberOfBoundaryGaussPoints;
+    for (unsigned i = 0; i < settings.maxNumberSlipRateUpdates && numberOfActivePoints > 0; i++) {
+      numberOfActivePoints = 0;
+#pragma omp simd reduction(+ : numberOfActivePoints)
       for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+        // Note that we need double precision here, since single precision led to NaNs.
         // calculate friction coefficient and objective function
-        muF[pointIndex] = static_cast<Derived*>(this)->updateMu(
+        const double muF = static_cast<Derived*>(this)->updateMu(
             ltsFace, pointIndex, slipRateTest[pointIndex], localStateVariable[pointIndex]);
-        dMuF[pointIndex] = static_cast<Derived*>(this)->updateMuDerivative(
+        const double dMuF = static_cast<Derived*>(this)->updateMuDerivative(
             ltsFace, pointIndex, slipRateTest[pointIndex], localStateVariable[pointIndex]);
-        g[pointIndex] = -this->impAndEta[ltsFace].invEtaS *
-                            (std::fabs(normalStress[pointIndex]) * muF[pointIndex] -
-                             absoluteShearStress[pointIndex]) -
-                        slipRateTest[pointIndex];
-      }
-
-      // max element of g must be smaller than newtonTolerance
-      const bool hasConverged = std::all_of(std::begin(g), std::end(g), [&](auto val) {
-        return std::fabs(val) < settings.newtonTolerance;
-      });
-      if (hasConverged) {
-        return hasConverged;
-      }
-#pragma omp simd
-      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
-
+        const double g = -this->impAndEta[ltsFace].invEtaS *
+                             (std::fabs(normalStress[pointIndex]) * muF -
+                              absoluteShearStress[pointIndex]) -
+                         slipRateTest[pointIndex];
         // derivative of g
-        dG[pointIndex] = -this->impAndEta[ltsFace].invEtaS *
-                             (std::fabs(normalStress[pointIndex]) * dMuF[pointIndex]) -
-                         1.0;
+        const double dG =
+            -this->impAndEta[ltsFace].invEtaS * (std::fabs(normalStress[pointIndex]) * dMuF) - 1.0;
+
+        // points for which g is smaller than newtonTolerance are frozen
+        isActive[pointIndex] = isActive[pointIndex] && !(std::fabs(g) < settings.newtonTolerance);
         // newton update
-        const real tmp3 = g[pointIndex] / dG[pointIndex];
-        slipRateTest[pointIndex] = std::max(rs::almostZero(), slipRateTest[pointIndex] - tmp3);
+        const real updatedSlipRate =
+            std::max(rs::almostZero(), static_cast<real>(slipRateTest[pointIndex] - g / dG));
+        slipRateTest[pointIndex] = isActive[pointIndex] ? updatedSlipRate : slipRateTest[pointIndex];
+        numberOfUpdates[pointIndex] += isActive[pointIndex];
+        numberOfActivePoints += isActive[pointIndex];
+      }
+    }
+    // points which are still active after the last update have not converged
+    const bool hasConverged = numberOfActivePoints == 0;
+
+    // the last bin counts the points which did not converge
+    unsigned localCounts[rs::Settings::maxNumberSlipRateUpdates + 1] = {};
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      const auto bin = isActive[pointIndex] ? rs::Settings::maxNumberSlipRateUpdates
+                                            : numberOfUpdates[pointIndex];
+      ++localCounts[bin];
+    }
+    for (unsigned bin = 0; bin <= rs::Settings::maxNumberSlipRateUpdates; bin++) {
+      if (localCounts[bin] > 0) {
+#pragma omp atomic
+        newtonUpdateCounts[bin] += localCounts[bin];
       }
     }
-    return false;
+    return hasConverged;
   }
 
   void updateNormalStress(std::array<real, misc::numPaddedPoints>& normalStress,
@@ -360,6 +398,8 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
 
   TPMethod tpMethod;
   rs::Settings settings{};
+  // number of points per Newton update count, summed over all calls of invertSlipRateIterative
+  std::array<unsigned long long, rs::Settings::maxNumberSlipRateUpdates + 1> newtonUpdateCounts{};
 };
 
 } // namespace seissol::dr::friction_law
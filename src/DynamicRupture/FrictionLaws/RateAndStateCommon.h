@@ -26,9 +26,9 @@ struct Settings {
    * the most adapted Number of iteration in the loops
    */
 
-  const unsigned int maxNumberSlipRateUpdates{60};
-  const unsigned int numberStateVariableUpdates{2};
-  const double newtonTolerance{1e-8};
+  static constexpr unsigned int maxNumberSlipRateUpdates{60};
+  static constexpr unsigned int numberStateVariableUpdates{2};
+  static constexpr double newtonTolerance{1e-8};
 };
 } // namespace seissol::dr::friction_law::rs
 
@@ -40,6 +40,12 @@ static constexpr real tpMaxWaveNumber = 10.0;
  */
 static constexpr unsigned int numberOfBoundaryGaussPoints = init::QInterpolated::Shape[0];
 
+/**
+ * Number of faces which are evaluated together by friction laws with face batching,
+ * one face per SIMD lane.
+ */
+static constexpr unsigned int faceBatchSize = VECTORSIZE / sizeof(real);
+
 template <class TupleT, class F, std::size_t... I>
 constexpr F forEachImpl(TupleT&& tuple, F&& functor, std::index_sequence<I...>) {
   return (void)std::initializer_list<int>{
@@ -1,6 +1,9 @@
 #ifndef EQUATION_DIRICHLET_BOUNDARY_H_
 #define EQUATION_DIRICHLET_BOUNDARY_H_
 
+#include <array>
+#include <utility>
+
 #include "generated_code/init.h"
 #include "generated_code/kernel.h"
 #include "generated_code/tensor.h"
@@ -160,23 +163,25 @@ class DirichletBoundary {
       timeWeights[point] = 0.5 * timeStepWidth * quadWeights[point];
     }
   
-    alignas(ALIGNMENT) real dofsFaceBoundaryNodalTmp[tensor::INodal::size()];
-    auto boundaryDofsTmp = init::INodal::view::create(dofsFaceBoundaryNodalTmp);
+    NodalBuffer dofsFaceBoundaryNodalTmp[CONVERGENCE_ORDER];
+    auto boundaryDofsTmp = createNodalViews(dofsFaceBoundaryNodalTmp,
+                                            std::make_index_sequence<CONVERGENCE_ORDER>{});
   
     boundaryDofs.setZero();
-    boundaryDofsTmp.setZero();
+    for (auto& boundaryDofsAtTime : boundaryDofsTmp) {
+      boundaryDofsAtTime.setZero();
+    }
   
+    // Evaluate boundary conditions at precomputed nodes (in global coordinates) for all time points at once.
+    std::forward<Func>(evaluateBoundaryCondition)(boundaryMapping.nodes,
+                                                  timePoints,
+                                                  CONVERGENCE_ORDER,
+                                                  boundaryDofsTmp.data());
+
     auto updateKernel = kernel::updateINodal{};
     updateKernel.INodal = dofsFaceBoundaryNodal;
-    updateKernel.INodalUpdate = dofsFaceBoundaryNodalTmp;
-    // Evaluate boundary conditions at precomputed nodes (in global coordinates).
-  
     for (int i = 0; i < CONVERGENCE_ORDER; ++i) {
-      boundaryDofsTmp.setZero();
-      std::forward<Func>(evaluateBoundaryCondition)(boundaryMapping.nodes,
-						    timePoints[i],
-						    boundaryDofsTmp);
-    
+      updateKernel.INodalUpdate = dofsFaceBoundaryNodalTmp[i].data;
       updateKernel.factor = timeWeights[i];
       updateKernel.execute();
     }
@@ -184,6 +189,16 @@ class DirichletBoundary {
   }
 
  private:
+  struct alignas(ALIGNMENT) NodalBuffer {
+    real data[tensor::INodal::size()];
+  };
+
+  template<std::size_t... Times>
+  static std::array<init::INodal::view::type, sizeof...(Times)> createNodalViews(NodalBuffer* buffers,
+                                                                                std::index_sequence<Times...>) {
+    return {init::INodal::view::create(buffers[Times].data)...};
+  }
+
   double quadPoints[CONVERGENCE_ORDER];
   double quadWeights[CONVERGENCE_ORDER];
 };
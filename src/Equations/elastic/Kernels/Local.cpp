@@ -44,6 +44,7 @@
 #include <yateto.h>
 
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <stdint.h>
@@ -55,6 +56,8 @@
 #pragma GCC diagnostic pop
 
 #include <Kernels/common.hpp>
+#include <Kernels/denseMatrixOps.hpp>
+#include <Kernels/FluxSolvers.h>
 GENERATE_HAS_MEMBER(ET)
 GENERATE_HAS_MEMBER(sourceMatrix)
 
@@ -80,6 +83,19 @@ void seissol::kernels::Local::setHostGlobalData(GlobalData const* global) {
 
   m_projectKrnlPrototype.V3mTo2nFace = global->V3mTo2nFace;
   m_projectRotatedKrnlPrototype.V3mTo2nFace = global->V3mTo2nFace;
+
+#ifndef USE_STP
+  m_fusedLocalKernelPrototype.kDivM = global->stiffnessMatrices;
+  m_fusedLocalKernelPrototype.kDivMT = global->stiffnessMatricesTransposed;
+  m_fusedLocalKernelPrototype.rDivM = global->changeOfBasisMatrices;
+  m_fusedLocalKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+#endif
+#ifdef HOST_CELL_BATCH
+  m_fusedLocalBatchedKernelPrototype.kDivM = global->stiffnessMatrices;
+  m_fusedLocalBatchedKernelPrototype.kDivMT = global->stiffnessMatricesTransposed;
+  m_fusedLocalBatchedKernelPrototype.rDivM = global->changeOfBasisMatrices;
+  m_fusedLocalBatchedKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+#endif
 }
 
 void seissol::kernels::Local::setGlobalData(const CompoundGlobalData& global) {
@@ -110,21 +126,20 @@ struct ApplyAnalyticalSolution {
 
 
   void operator()(const real* nodes,
-                  double time,
-                  seissol::init::INodal::view::type& boundaryDofs) {
+                  const double* times,
+                  std::size_t numberOfTimes,
+                  seissol::init::INodal::view::type* boundaryDofs) {
 
-    auto nodesVec = std::vector<std::array<double, 3>>{};
+    std::array<std::array<double, 3>, seissol::tensor::INodal::Shape[0]> nodesArray;
     int offset = 0;
-    for (unsigned int i = 0; i < seissol::tensor::INodal::Shape[0]; ++i) {
-      auto curNode = std::array<double, 3>{};
+    for (auto& curNode : nodesArray) {
       curNode[0] = nodes[offset++];
       curNode[1] = nodes[offset++];
       curNode[2] = nodes[offset++];
-      nodesVec.push_back(curNode);
     }
 
     assert(initCondition != nullptr);
-    initCondition->evaluate(time, nodesVec, localData.material, boundaryDofs);
+    initCondition->evaluateBatch(times, numberOfTimes, nodesArray, localData.material, boundaryDofs);
   }
 
 private:
@@ -161,20 +176,29 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   
   volKrnl.execute();
 
+  alignas(ALIGNMENT) real localFluxSolverBuffer[tensor::AplusT::size()];
+  alignas(ALIGNMENT) real neighborFluxSolverBuffer[tensor::AminusT::size()];
   for (int face = 0; face < 4; ++face) {
+    const FaceType faceType = data.cellInformation.faceTypes[face];
     // no element local contribution in the case of dynamic rupture boundary conditions
-    if (data.cellInformation.faceTypes[face] != FaceType::dynamicRupture) {
-      lfKrnl.AplusT = data.localIntegration.nApNm1[face];
+    if (faceType != FaceType::dynamicRupture) {
+      lfKrnl.AplusT = localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffer);
       lfKrnl.execute(face);
     }
 
+    // the nodal boundary conditions below are the only users of the neighbor flux solver
+    if (faceType != FaceType::freeSurfaceGravity && faceType != FaceType::dirichlet
+        && faceType != FaceType::analytical) {
+      continue;
+    }
+
     alignas(ALIGNMENT) real dofsFaceBoundaryNodal[tensor::INodal::size()];
     auto nodalLfKrnl = m_nodalLfKrnlPrototype;
     nodalLfKrnl.Q = data.dofs;
     nodalLfKrnl.INodal = dofsFaceBoundaryNodal;
     nodalLfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
     nodalLfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
-    nodalLfKrnl.AminusT = data.neighboringIntegration.nAmNm1[face];
+    nodalLfKrnl.AminusT = neighborFluxSolver(data.neighboringIntegration, faceType, face, neighborFluxSolverBuffer);
 
     // Include some boundary conditions here.
     switch (data.cellInformation.faceTypes[face]) {
@@ -266,6 +290,221 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   }
 }
 
+void seissol::kernels::Local::computeRegularIntegral(real timeIntegrated[tensor::I::size()],
+                                                     LocalData& data,
+                                                     LocalTmp& /*tmp*/) {
+  assert(reinterpret_cast<uintptr_t>(timeIntegrated) % ALIGNMENT == 0);
+  assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
+  assert(std::all_of(std::begin(data.cellInformation.faceTypes),
+                     std::end(data.cellInformation.faceTypes),
+                     [](const FaceType faceType) {
+                       return faceType == FaceType::regular || faceType == FaceType::periodic;
+                     }));
+
+  kernel::volume volKrnl = m_volumeKernelPrototype;
+  volKrnl.Q = data.dofs;
+  volKrnl.I = timeIntegrated;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+    volKrnl.star(i) = data.localIntegration.starMatrices[i];
+  }
+
+  // Optional source term
+  set_ET(volKrnl, get_ptr_sourceMatrix(data.localIntegration.specific));
+
+  kernel::localFlux lfKrnl = m_localFluxKernelPrototype;
+  lfKrnl.Q = data.dofs;
+  lfKrnl.I = timeIntegrated;
+  lfKrnl._prefetch.I = timeIntegrated + tensor::I::size();
+  lfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
+
+  volKrnl.execute();
+
+  alignas(ALIGNMENT) real localFluxSolverBuffer[tensor::AplusT::size()];
+  for (unsigned face = 0; face < 4; ++face) {
+    lfKrnl.AplusT = localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffer);
+    lfKrnl.execute(face);
+  }
+}
+
+#ifndef USE_STP
+// Faces whose boundary conditions need the time integrated DOFs in between are not fused
+static bool isFusable(const CellLocalInformation& cellInformation) {
+  return std::none_of(std::begin(cellInformation.faceTypes),
+                      std::end(cellInformation.faceTypes),
+                      [](const FaceType faceType) {
+                        return faceType == FaceType::dynamicRupture
+                               || faceType == FaceType::freeSurfaceGravity
+                               || faceType == FaceType::dirichlet
+                               || faceType == FaceType::analytical;
+                      });
+}
+#endif
+
+bool seissol::kernels::Local::computeFusedIntegral(double timeStepWidth,
+                                                   LocalData& data,
+                                                   LocalTmp& tmp,
+                                                   real timeIntegrated[tensor::I::size()],
+                                                   real* timeDerivatives) {
+#ifdef USE_STP
+  return false;
+#else
+  if (!isFusable(data.cellInformation)) {
+    return false;
+  }
+
+  assert(reinterpret_cast<uintptr_t>(timeIntegrated) % ALIGNMENT == 0);
+  assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
+  assert(timeDerivatives == nullptr || reinterpret_cast<uintptr_t>(timeDerivatives) % ALIGNMENT == 0);
+
+  alignas(PAGESIZE_STACK) real temporaryBuffer[yateto::computeFamilySize<tensor::dQ>()];
+  auto* derivativesBuffer = (timeDerivatives != nullptr) ? timeDerivatives : temporaryBuffer;
+
+  kernel::fusedLocal krnl = m_fusedLocalKernelPrototype;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+    krnl.star(i) = data.localIntegration.starMatrices[i];
+  }
+
+  // Optional source term
+  set_ET(krnl, get_ptr_sourceMatrix(data.localIntegration.specific));
+
+  // The DOFs are updated by the kernel, hence the zeroth derivative is stored first
+  if (timeDerivatives != nullptr) {
+    streamstore(tensor::dQ::size(0), data.dofs, timeDerivatives);
+  }
+  krnl.dQ(0) = data.dofs;
+  real* derivative = derivativesBuffer;
+  for (unsigned i = 1; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+    derivative += tensor::dQ::size(i-1);
+    krnl.dQ(i) = derivative;
+  }
+
+  alignas(ALIGNMENT) real localFluxSolverBuffers[4][tensor::AplusT::size()];
+  for (unsigned face = 0; face < 4; ++face) {
+    krnl.AplusTFace(face) =
+        localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffers[face]);
+  }
+
+  krnl.I = timeIntegrated;
+  krnl.Q = data.dofs;
+  krnl.timestep = timeStepWidth;
+  krnl.execute();
+
+  return true;
+#endif //USE_STP
+}
+
+#ifdef HOST_CELL_BATCH
+bool seissol::kernels::Local::packCellBatchMatrices(LocalData::Loader& loader,
+                                                    unsigned firstCell,
+                                                    CellBatchMatrices& matrices) {
+  for (unsigned lane = 0; lane < CellBatchSize; ++lane) {
+    if (!isFusable(loader.entry(firstCell + lane).cellInformation)) {
+      return false;
+    }
+  }
+
+  kernel::packCellBatchMatrices packKrnl;
+  real* starMatrix = matrices.starMatrices;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::starBatch>(); ++i) {
+    packKrnl.starBatch(i) = starMatrix;
+    starMatrix += tensor::starBatch::size(i);
+  }
+  real* fluxSolver = matrices.fluxSolvers;
+  for (unsigned face = 0; face < 4; ++face) {
+    packKrnl.AplusTBatch(face) = fluxSolver;
+    fluxSolver += tensor::AplusTBatch::size(face);
+  }
+
+  alignas(ALIGNMENT) real localFluxSolverBuffers[4][tensor::AplusT::size()];
+  for (unsigned lane = 0; lane < CellBatchSize; ++lane) {
+    auto data = loader.entry(firstCell + lane);
+    packKrnl.cellBatchLane(lane) = init::cellBatchLane::Values[tensor::cellBatchLane::index(lane)];
+    for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+      packKrnl.star(i) = data.localIntegration.starMatrices[i];
+    }
+    for (unsigned face = 0; face < 4; ++face) {
+      packKrnl.AplusTFace(face) =
+          localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffers[face]);
+    }
+    packKrnl.execute(lane);
+  }
+  return true;
+}
+
+void seissol::kernels::Local::computeFusedIntegralBatched(double timeStepWidth,
+                                                          LocalData::Loader& loader,
+                                                          unsigned firstCell,
+                                                          const CellBatchMatrices& matrices,
+                                                          real* const timeIntegrated[CellBatchSize],
+                                                          real* const timeDerivatives[CellBatchSize]) {
+  // Packing the first lane overwrites the packed DOFs, hence they are not initialized
+  alignas(PAGESIZE_STACK) real dofs[tensor::QBatch::size()];
+  alignas(PAGESIZE_STACK) real integrated[tensor::IBatch::size()];
+  alignas(PAGESIZE_STACK) real derivatives[yateto::computeFamilySize<tensor::dQBatch>()];
+
+  kernel::packCellBatch packKrnl;
+  kernel::fusedLocalBatched krnl = m_fusedLocalBatchedKernelPrototype;
+  kernel::unpackCellBatch unpackKrnl;
+  kernel::unpackCellBatchDerivatives unpackDerivativesKrnl;
+
+  packKrnl.QBatch = dofs;
+  krnl.QBatch = dofs;
+  unpackKrnl.QBatch = dofs;
+  krnl.IBatch = integrated;
+  unpackKrnl.IBatch = integrated;
+
+  const real* starMatrix = matrices.starMatrices;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::starBatch>(); ++i) {
+    krnl.starBatch(i) = starMatrix;
+    starMatrix += tensor::starBatch::size(i);
+  }
+  const real* fluxSolver = matrices.fluxSolvers;
+  for (unsigned face = 0; face < 4; ++face) {
+    krnl.AplusTBatch(face) = fluxSolver;
+    fluxSolver += tensor::AplusTBatch::size(face);
+  }
+  krnl.dQBatch(0) = dofs;
+  real* derivative = derivatives;
+  for (unsigned i = 1; i < yateto::numFamilyMembers<tensor::dQBatch>(); ++i) {
+    derivative += tensor::dQBatch::size(i-1);
+    krnl.dQBatch(i) = derivative;
+    unpackDerivativesKrnl.dQBatch(i) = derivative;
+  }
+  for (unsigned lane = 0; lane < CellBatchSize; ++lane) {
+    const real* laneSelector = init::cellBatchLane::Values[tensor::cellBatchLane::index(lane)];
+    packKrnl.cellBatchLane(lane) = laneSelector;
+    unpackKrnl.cellBatchLane(lane) = laneSelector;
+    unpackDerivativesKrnl.cellBatchLane(lane) = laneSelector;
+  }
+
+  for (unsigned lane = 0; lane < CellBatchSize; ++lane) {
+    assert(isFusable(loader.entry(firstCell + lane).cellInformation));
+    packKrnl.Q = loader.entry(firstCell + lane).dofs;
+    packKrnl.execute(lane);
+  }
+
+  krnl.timestep = timeStepWidth;
+  krnl.execute();
+
+  for (unsigned lane = 0; lane < CellBatchSize; ++lane) {
+    auto data = loader.entry(firstCell + lane);
+    if (timeDerivatives[lane] != nullptr) {
+      // The DOFs of the cell are not updated yet
+      streamstore(tensor::dQ::size(0), data.dofs, timeDerivatives[lane]);
+      real* cellDerivative = timeDerivatives[lane];
+      for (unsigned i = 1; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+        cellDerivative += tensor::dQ::size(i-1);
+        unpackDerivativesKrnl.dQ(i) = cellDerivative;
+      }
+      unpackDerivativesKrnl.execute(lane);
+    }
+    unpackKrnl.Q = data.dofs;
+    unpackKrnl.I = timeIntegrated[lane];
+    unpackKrnl.execute(lane);
+  }
+}
+#endif
+
 void seissol::kernels::Local::computeBatchedIntegral(
   ConditionalPointersToRealsTable& dataTable,
   ConditionalMaterialTable& materialTable,
@@ -428,6 +667,13 @@ void seissol::kernels::Local::flopsIntegral(FaceType const i_faceTypes[4],
     if (i_faceTypes[face] != FaceType::dynamicRupture) {
       o_nonZeroFlops += seissol::kernel::localFlux::nonZeroFlops(face);
       o_hardwareFlops += seissol::kernel::localFlux::hardwareFlops(face);
+      flopsLocalFluxSolver(o_nonZeroFlops, o_hardwareFlops);
+    }
+
+    // The nodal boundary conditions use the neighboring flux solver
+    if (i_faceTypes[face] == FaceType::freeSurfaceGravity || i_faceTypes[face] == FaceType::dirichlet
+        || i_faceTypes[face] == FaceType::analytical) {
+      flopsNeighborFluxSolver(o_nonZeroFlops, o_hardwareFlops);
     }
 
     // Take boundary condition flops into account.
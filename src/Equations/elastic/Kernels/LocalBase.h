@@ -69,6 +69,12 @@ class seissol::kernels::LocalBase {
 
     kernel::projectToNodalBoundary m_projectKrnlPrototype;
     kernel::projectToNodalBoundaryRotated m_projectRotatedKrnlPrototype;
+#ifndef USE_STP
+    kernel::fusedLocal m_fusedLocalKernelPrototype;
+#endif
+#ifdef HOST_CELL_BATCH
+    kernel::fusedLocalBatched m_fusedLocalBatchedKernelPrototype;
+#endif
 
     kernels::DirichletBoundary dirichletBoundary;
 
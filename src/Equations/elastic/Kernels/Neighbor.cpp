@@ -74,6 +74,8 @@
 #include <cassert>
 #include <stdint.h>
 
+#include "Kernels/FluxSolvers.h"
+
 void seissol::kernels::NeighborBase::checkGlobalData(GlobalData const* global, size_t alignment) {
 #ifndef NDEBUG
   for( int l_neighbor = 0; l_neighbor < 4; ++l_neighbor ) {
@@ -138,10 +140,14 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
       assert(reinterpret_cast<uintptr_t>(i_timeIntegrated[l_face]) % ALIGNMENT == 0 );
       assert(data.cellInformation.faceRelations[l_face][0] < 4
              && data.cellInformation.faceRelations[l_face][1] < 3);
+      alignas(ALIGNMENT) real neighborFluxSolverBuffer[tensor::AminusT::size()];
       kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
       nfKrnl.Q = data.dofs;
       nfKrnl.I = i_timeIntegrated[l_face];
-      nfKrnl.AminusT = data.neighboringIntegration.nAmNm1[l_face];
+      nfKrnl.AminusT = neighborFluxSolver(data.neighboringIntegration,
+                                          data.cellInformation.faceTypes[l_face],
+                                          l_face,
+                                          neighborFluxSolverBuffer);
       nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
       nfKrnl.execute(data.cellInformation.faceRelations[l_face][1],
 		     data.cellInformation.faceRelations[l_face][0],
@@ -169,6 +175,30 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
   }
 }
 
+void seissol::kernels::Neighbor::computeRegularNeighborsIntegral(NeighborData& data,
+                                                                 real* const timeIntegrated[4],
+                                                                 real* const faceNeighborsPrefetch[4]) {
+  assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
+
+  alignas(ALIGNMENT) real neighborFluxSolverBuffer[tensor::AminusT::size()];
+  kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
+  nfKrnl.Q = data.dofs;
+  for (unsigned face = 0; face < 4; ++face) {
+    assert(data.cellInformation.faceTypes[face] == FaceType::regular
+           || data.cellInformation.faceTypes[face] == FaceType::periodic);
+    assert(reinterpret_cast<uintptr_t>(timeIntegrated[face]) % ALIGNMENT == 0);
+    nfKrnl.I = timeIntegrated[face];
+    nfKrnl.AminusT = neighborFluxSolver(data.neighboringIntegration,
+                                        data.cellInformation.faceTypes[face],
+                                        face,
+                                        neighborFluxSolverBuffer);
+    nfKrnl._prefetch.I = faceNeighborsPrefetch[face];
+    nfKrnl.execute(data.cellInformation.faceRelations[face][1],
+                   data.cellInformation.faceRelations[face][0],
+                   face);
+  }
+}
+
 void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalPointersToRealsTable &table) {
 #ifdef ACL_DEVICE
   kernel::gpu_neighboringFlux neighFluxKrnl = deviceNfKrnlPrototype;
@@ -271,6 +301,7 @@ void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTyp
       assert(i_neighboringIndices[face][0] < 4 && i_neighboringIndices[face][1] < 3);
       o_nonZeroFlops += kernel::neighboringFlux::nonZeroFlops(i_neighboringIndices[face][1], i_neighboringIndices[face][0], face);
       o_hardwareFlops += kernel::neighboringFlux::hardwareFlops(i_neighboringIndices[face][1], i_neighboringIndices[face][0], face);
+      flopsNeighborFluxSolver(o_nonZeroFlops, o_hardwareFlops);
       break;
     case FaceType::dynamicRupture:
       o_drNonZeroFlops += dynamicRupture::kernel::nodalFlux::nonZeroFlops(cellDrMapping[face].side, cellDrMapping[face].faceRelation);
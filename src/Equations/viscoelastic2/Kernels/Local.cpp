@@ -41,12 +41,16 @@
 
 #include "Kernels/Local.h"
 
+#include <algorithm>
 #include <cassert>
 #include <stdint.h>
 #include <cstring>
 
 #include <yateto.h>
 
+#include <Kernels/denseMatrixOps.hpp>
+#include <Kernels/FluxSolvers.h>
+
 void seissol::kernels::Local::setHostGlobalData(GlobalData const* global) {
 #ifndef NDEBUG
   for (unsigned stiffness = 0; stiffness < 3; ++stiffness) {
@@ -63,6 +67,13 @@ void seissol::kernels::Local::setHostGlobalData(GlobalData const* global) {
   m_localFluxKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
   m_localKernelPrototype.selectEla = init::selectEla::Values;
   m_localKernelPrototype.selectAne = init::selectAne::Values;
+
+  m_fusedLocalKernelPrototype.kDivM = global->stiffnessMatrices;
+  m_fusedLocalKernelPrototype.kDivMT = global->stiffnessMatricesTransposed;
+  m_fusedLocalKernelPrototype.rDivM = global->changeOfBasisMatrices;
+  m_fusedLocalKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+  m_fusedLocalKernelPrototype.selectEla = init::selectEla::Values;
+  m_fusedLocalKernelPrototype.selectAne = init::selectAne::Values;
 }
 
 void seissol::kernels::Local::setGlobalData(const CompoundGlobalData& global) {
@@ -101,10 +112,11 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   
   volKrnl.execute();
   
+  alignas(ALIGNMENT) real localFluxSolverBuffer[tensor::AplusT::size()];
   for( unsigned int face = 0; face < 4; ++face ) {
     // no element local contribution in the case of dynamic rupture boundary conditions
     if( data.cellInformation.faceTypes[face] != FaceType::dynamicRupture ) {
-      lfKrnl.AplusT = data.localIntegration.nApNm1[face];
+      lfKrnl.AplusT = localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffer);
       lfKrnl.execute(face);
     }
   }
@@ -121,6 +133,122 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   lKrnl.execute();
 }
 
+void seissol::kernels::Local::computeRegularIntegral(real timeIntegrated[tensor::I::size()],
+                                                     LocalData& data,
+                                                     LocalTmp& tmp) {
+  assert(reinterpret_cast<uintptr_t>(timeIntegrated) % ALIGNMENT == 0);
+  assert(reinterpret_cast<uintptr_t>(tmp.timeIntegratedAne) % ALIGNMENT == 0);
+  assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
+  assert(std::all_of(std::begin(data.cellInformation.faceTypes),
+                     std::end(data.cellInformation.faceTypes),
+                     [](const FaceType faceType) {
+                       return faceType == FaceType::regular || faceType == FaceType::periodic;
+                     }));
+
+  real Qext[tensor::Qext::size()] __attribute__((aligned(ALIGNMENT)));
+
+  kernel::volumeExt volKrnl = m_volumeKernelPrototype;
+  volKrnl.Qext = Qext;
+  volKrnl.I = timeIntegrated;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+    volKrnl.star(i) = data.localIntegration.starMatrices[i];
+  }
+
+  kernel::localFluxExt lfKrnl = m_localFluxKernelPrototype;
+  lfKrnl.Qext = Qext;
+  lfKrnl.I = timeIntegrated;
+  lfKrnl._prefetch.I = timeIntegrated + tensor::I::size();
+  lfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
+
+  volKrnl.execute();
+
+  alignas(ALIGNMENT) real localFluxSolverBuffer[tensor::AplusT::size()];
+  for (unsigned face = 0; face < 4; ++face) {
+    lfKrnl.AplusT = localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffer);
+    lfKrnl.execute(face);
+  }
+
+  kernel::local lKrnl = m_localKernelPrototype;
+  lKrnl.E = data.localIntegration.specific.E;
+  lKrnl.Iane = tmp.timeIntegratedAne;
+  lKrnl.Q = data.dofs;
+  lKrnl.Qane = data.dofsAne;
+  lKrnl.Qext = Qext;
+  lKrnl.W = data.localIntegration.specific.W;
+  lKrnl.w = data.localIntegration.specific.w;
+
+  lKrnl.execute();
+}
+
+bool seissol::kernels::Local::computeFusedIntegral(double timeStepWidth,
+                                                   LocalData& data,
+                                                   LocalTmp& tmp,
+                                                   real timeIntegrated[tensor::I::size()],
+                                                   real* timeDerivatives) {
+  if (std::any_of(std::begin(data.cellInformation.faceTypes),
+                  std::end(data.cellInformation.faceTypes),
+                  [](const FaceType faceType) { return faceType == FaceType::dynamicRupture; })) {
+    return false;
+  }
+
+  // assert alignments
+#ifndef NDEBUG
+  assert( ((uintptr_t)timeIntegrated) % ALIGNMENT == 0 );
+  assert( ((uintptr_t)tmp.timeIntegratedAne) % ALIGNMENT == 0 );
+  assert( ((uintptr_t)data.dofs) % ALIGNMENT == 0 );
+  assert( ((uintptr_t)timeDerivatives) % ALIGNMENT == 0 || timeDerivatives == nullptr );
+#endif
+
+  // the Taylor series is evaluated from the highest derivative, hence all derivatives are kept
+  real temporaryBuffer[yateto::computeFamilySize<tensor::dQ>()] __attribute__((aligned(PAGESIZE_STACK)));
+  real temporaryBufferExt[yateto::computeFamilySize<tensor::dQext>()] __attribute__((aligned(PAGESIZE_STACK)));
+  real temporaryBufferAne[yateto::computeFamilySize<tensor::dQane>()] __attribute__((aligned(PAGESIZE_STACK)));
+  real Qext[tensor::Qext::size()] __attribute__((aligned(ALIGNMENT)));
+  real* derivativesBuffer = (timeDerivatives != nullptr) ? timeDerivatives : temporaryBuffer;
+
+  kernel::fusedLocal krnl = m_fusedLocalKernelPrototype;
+
+  // The DOFs are updated by the kernel, hence the zeroth derivative is stored first
+  if (timeDerivatives != nullptr) {
+    streamstore(tensor::dQ::size(0), data.dofs, timeDerivatives);
+  }
+  krnl.dQ(0) = data.dofs;
+  krnl.dQane(0) = data.dofsAne;
+  real* derivative = derivativesBuffer;
+  real* derivativeExt = temporaryBufferExt;
+  real* derivativeAne = temporaryBufferAne;
+  for (unsigned i = 1; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+    derivative += tensor::dQ::size(i-1);
+    derivativeAne += tensor::dQane::size(i-1);
+    krnl.dQ(i) = derivative;
+    krnl.dQane(i) = derivativeAne;
+    krnl.dQext(i) = derivativeExt;
+    derivativeExt += tensor::dQext::size(i);
+  }
+
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+    krnl.star(i) = data.localIntegration.starMatrices[i];
+  }
+  alignas(ALIGNMENT) real localFluxSolverBuffers[4][tensor::AplusT::size()];
+  for (unsigned face = 0; face < 4; ++face) {
+    krnl.AplusTFace(face) =
+        localFluxSolver(data.localIntegration, data.neighboringIntegration, face, localFluxSolverBuffers[face]);
+  }
+  krnl.w = data.localIntegration.specific.w;
+  krnl.W = data.localIntegration.specific.W;
+  krnl.E = data.localIntegration.specific.E;
+
+  krnl.I = timeIntegrated;
+  krnl.Iane = tmp.timeIntegratedAne;
+  krnl.Q = data.dofs;
+  krnl.Qane = data.dofsAne;
+  krnl.Qext = Qext;
+  krnl.timestep = timeStepWidth;
+  krnl.execute();
+
+  return true;
+}
+
 void seissol::kernels::Local::flopsIntegral(FaceType const i_faceTypes[4],
                                             unsigned int &o_nonZeroFlops,
                                             unsigned int &o_hardwareFlops )
@@ -132,6 +260,7 @@ void seissol::kernels::Local::flopsIntegral(FaceType const i_faceTypes[4],
     if (i_faceTypes[face] != FaceType::dynamicRupture) {
       o_nonZeroFlops  += seissol::kernel::localFluxExt::nonZeroFlops(face);
       o_hardwareFlops += seissol::kernel::localFluxExt::hardwareFlops(face);
+      flopsLocalFluxSolver(o_nonZeroFlops, o_hardwareFlops);
     }
   }
 
@@ -53,6 +53,7 @@ namespace seissol {
       kernel::volumeExt m_volumeKernelPrototype;
       kernel::localFluxExt m_localFluxKernelPrototype;
       kernel::local m_localKernelPrototype;
+      kernel::fusedLocal m_fusedLocalKernelPrototype;
       const std::vector<std::unique_ptr<physics::InitialField>> *initConds;
     public:
       virtual void setInitConds(decltype(initConds) initConds) {
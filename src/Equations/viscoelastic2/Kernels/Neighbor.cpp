@@ -47,6 +47,7 @@
 #include <cstring>
 
 #include <generated_code/init.h>
+#include "Kernels/FluxSolvers.h"
 
 void seissol::kernels::Neighbor::setHostGlobalData(GlobalData const* global) {
 #ifndef NDEBUG
@@ -100,6 +101,7 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
   kernel::neighbourFluxExt nfKrnl = m_nfKrnlPrototype;
   nfKrnl.Qext = Qext;
 
+  alignas(ALIGNMENT) real neighborFluxSolverBuffer[tensor::AminusT::size()];
   // iterate over faces
   for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
     // no neighboring cell contribution in the case of absorbing and dynamic rupture boundary conditions
@@ -110,7 +112,10 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
         assert(data.cellInformation.faceRelations[l_face][0] < 4 && data.cellInformation.faceRelations[l_face][1] < 3);
 
         nfKrnl.I = i_timeIntegrated[l_face];
-        nfKrnl.AminusT = data.neighboringIntegration.nAmNm1[l_face];
+        nfKrnl.AminusT = neighborFluxSolver(data.neighboringIntegration,
+                                            data.cellInformation.faceTypes[l_face],
+                                            l_face,
+                                            neighborFluxSolverBuffer);
         nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
         nfKrnl.execute(data.cellInformation.faceRelations[l_face][1], data.cellInformation.faceRelations[l_face][0], l_face);
       }
@@ -135,6 +140,38 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
   nKrnl.execute();
 }
 
+void seissol::kernels::Neighbor::computeRegularNeighborsIntegral(NeighborData& data,
+                                                                 real* const timeIntegrated[4],
+                                                                 real* const faceNeighborsPrefetch[4]) {
+  assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
+
+  real Qext[tensor::Qext::size()] __attribute__((aligned(PAGESIZE_STACK))) = {};
+
+  alignas(ALIGNMENT) real neighborFluxSolverBuffer[tensor::AminusT::size()];
+  kernel::neighbourFluxExt nfKrnl = m_nfKrnlPrototype;
+  nfKrnl.Qext = Qext;
+  for (unsigned face = 0; face < 4; ++face) {
+    assert(data.cellInformation.faceTypes[face] == FaceType::regular
+           || data.cellInformation.faceTypes[face] == FaceType::periodic);
+    assert(reinterpret_cast<uintptr_t>(timeIntegrated[face]) % ALIGNMENT == 0);
+    nfKrnl.I = timeIntegrated[face];
+    nfKrnl.AminusT = neighborFluxSolver(data.neighboringIntegration,
+                                        data.cellInformation.faceTypes[face],
+                                        face,
+                                        neighborFluxSolverBuffer);
+    nfKrnl._prefetch.I = faceNeighborsPrefetch[face];
+    nfKrnl.execute(data.cellInformation.faceRelations[face][1], data.cellInformation.faceRelations[face][0], face);
+  }
+
+  kernel::neighbour nKrnl = m_nKrnlPrototype;
+  nKrnl.Qext = Qext;
+  nKrnl.Q = data.dofs;
+  nKrnl.Qane = data.dofsAne;
+  nKrnl.w = data.neighboringIntegration.specific.w;
+
+  nKrnl.execute();
+}
+
 void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTypes[4],
                                                         const int i_neighboringIndices[4][2],
                                                         CellDRMapping const (&cellDrMapping)[4],
@@ -156,6 +193,7 @@ void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTyp
 
         o_nonZeroFlops  += seissol::kernel::neighbourFluxExt::nonZeroFlops(i_neighboringIndices[l_face][1], i_neighboringIndices[l_face][0], l_face);
         o_hardwareFlops += seissol::kernel::neighbourFluxExt::hardwareFlops(i_neighboringIndices[l_face][1], i_neighboringIndices[l_face][0], l_face);
+        flopsNeighborFluxSolver(o_nonZeroFlops, o_hardwareFlops);
       } else { // fall back to local matrices in case of free surface boundary conditions
         o_nonZeroFlops  += seissol::kernel::localFluxExt::nonZeroFlops(l_face);
         o_hardwareFlops += seissol::kernel::localFluxExt::hardwareFlops(l_face);
@@ -92,6 +92,13 @@ public:
 
     void get(const real* inData, const unsigned int* cellMap,
             int variable, real* outData) const;
+
+    /**
+     * Same as above, but the variables of every cell are stored separately.
+     * Cells with a null pointer are sampled as zero.
+     */
+    void get(const real* const* inCells, const unsigned int* cellMap,
+            int variable, real* outData) const;
 };
 
 //------------------------------------------------------------------------------
@@ -146,6 +153,25 @@ void VariableSubsampler<T>::get(const real* inData,  const unsigned int* cellMap
 
 //------------------------------------------------------------------------------
 
+template<typename T>
+void VariableSubsampler<T>::get(const real* const* inCells, const unsigned int* cellMap,
+        int variable, real* outData) const
+{
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    // Iterate over original Cells
+    for (unsigned int c = 0; c < m_numCells; ++c) {
+        const real* inData = inCells[cellMap[c]];
+        for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
+            outData[getOutVarOffset(c, sc)] = (inData == nullptr) ? 0.0 :
+            		m_BasisFunctions[sc].evalWithCoeffs(&inData[variable * kNumAlignedDOF]);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace
 }
 
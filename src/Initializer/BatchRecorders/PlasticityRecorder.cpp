@@ -11,8 +11,7 @@ void PlasticityRecorder::record(LTS& handler, Layer& layer) {
   loader.load(handler, layer);
   setUpContext(handler, layer, loader);
 
-  real(*pstrains)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] =
-      currentLayer->var(currentHandler->pstrain);
+  real** pstrains = currentLayer->var(currentHandler->pstrain);
   size_t nodalStressTensorCounter = 0;
   real* scratchMem =
       static_cast<real*>(currentLayer->getScratchpadMemory(currentHandler->integratedDofsScratch));
@@ -28,7 +27,7 @@ void PlasticityRecorder::record(LTS& handler, Layer& layer) {
       dofsPtrs[cell] = static_cast<real*>(data.dofs);
       qstressNodalPtrs[cell] = &scratchMem[nodalStressTensorCounter];
       nodalStressTensorCounter += tensor::QStressNodal::size();
-      pstransPtrs[cell] = static_cast<real*>(pstrains[cell]);
+      pstransPtrs[cell] = pstrains[cell];
       initialLoadPtrs[cell] = static_cast<real*>(data.plasticity.initialLoading);
     }
 
@@ -41,7 +41,16 @@
 
 #include "CellLocalMatrices.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <Initializer/ParameterDB.h>
 #include "Initializer/MemoryManager.h"
@@ -52,6 +61,7 @@
 #include <generated_code/tensor.h>
 #include <generated_code/kernel.h>
 #include <utils/logger.h>
+#include "Parallel/MPI.h"
 #ifdef ACL_DEVICE
 #include <device.h>
 #endif
@@ -75,11 +85,124 @@ void setStarMatrix( real* i_AT,
   }
 }
 
+namespace {
+//! Bytewise comparison of materials; equal bytes imply equal parameters, even if different bytes may describe the same material
+template <typename MaterialT>
+int compareMaterials(const MaterialT& lhs, const MaterialT& rhs) {
+  return std::memcmp(static_cast<const void*>(&lhs), static_cast<const void*>(&rhs), sizeof(MaterialT));
+}
+
+template <typename MaterialT>
+void computeGodunovStates(const MaterialT& local, const MaterialT& neighbor, FaceType faceType, FaceGodunovStates& faceStates) {
+  auto QgodLocal = seissol::init::QgodLocal::view::create(faceStates.QgodLocal);
+  auto QgodNeighbor = seissol::init::QgodNeighbor::view::create(faceStates.QgodNeighbor);
+  // AT with elastic parameters in local coordinate system, used for flux kernel
+  auto ATtilde = seissol::init::star::view<0>::create(faceStates.starMatrix);
+  seissol::model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+  seissol::model::getTransposedCoefficientMatrix(local, 0, ATtilde);
+}
+
+/**
+ * Remembers the Godunov states of the combinations of materials and face type which one thread has seen.
+ * Faces of layered and homogeneous models share few material pairs, such that most
+ * (for non-elastic materials eigen) decompositions are skipped. The entries are found by a hash of the
+ * bytes of the materials, and are compared bytewise only on equal hashes. The cache is emptied once it
+ * would exceed MaxBytes, which bounds its memory for heterogeneous models, where almost every face misses.
+ * Not thread-safe.
+ **/
+template <typename MaterialT>
+class GodunovStateCache {
+ public:
+  static constexpr std::size_t MaxBytes = std::size_t(4) << 20;
+
+  struct Entry {
+    MaterialT local;
+    MaterialT neighbor;
+    FaceType faceType;
+    FaceGodunovStates states;
+    // the Godunov states in the table shared by all faces, if the flux solvers are recomputed
+    const FaceGodunovStates* shared;
+  };
+
+  static constexpr std::size_t MaxNumberOfEntries = std::max(MaxBytes / sizeof(Entry), std::size_t(1));
+
+ private:
+  // the entries keep their addresses, as the index points to them
+  std::deque<Entry> entries;
+  std::unordered_multimap<std::size_t, Entry*> index;
+  Entry* lastEntry = nullptr;
+  std::size_t numberOfHits = 0;
+  std::size_t numberOfMisses = 0;
+
+  static bool matches(const Entry& entry, const MaterialT& local, const MaterialT& neighbor, FaceType faceType) {
+    return entry.faceType == faceType && compareMaterials(entry.local, local) == 0 &&
+           compareMaterials(entry.neighbor, neighbor) == 0;
+  }
+
+  static std::size_t hashOf(const MaterialT& local, const MaterialT& neighbor, FaceType faceType) {
+    const auto bytesOf = [](const MaterialT& material) {
+      return std::string_view(reinterpret_cast<const char*>(&material), sizeof(MaterialT));
+    };
+    const std::hash<std::string_view> hash;
+    std::size_t seed = hash(bytesOf(local));
+    seed ^= hash(bytesOf(neighbor)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= static_cast<std::size_t>(faceType) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+
+ public:
+  //! Returns the entry of the given face, which is computed if it is not cached
+  Entry& get(const MaterialT& local, const MaterialT& neighbor, FaceType faceType) {
+    // faces of the same cell and of neighboring cells mostly repeat the last material pair
+    if (lastEntry != nullptr && matches(*lastEntry, local, neighbor, faceType)) {
+      ++numberOfHits;
+      return *lastEntry;
+    }
+    const auto hash = hashOf(local, neighbor, faceType);
+    const auto [begin, end] = index.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+      if (matches(*it->second, local, neighbor, faceType)) {
+        ++numberOfHits;
+        lastEntry = it->second;
+        return *lastEntry;
+      }
+    }
+
+    ++numberOfMisses;
+    if (entries.size() == MaxNumberOfEntries) {
+      index.clear();
+      entries.clear();
+    }
+    lastEntry = &entries.emplace_back(Entry{local, neighbor, faceType, {}, nullptr});
+    index.emplace(hash, lastEntry);
+    computeGodunovStates(local, neighbor, faceType, lastEntry->states);
+    return *lastEntry;
+  }
+
+  [[nodiscard]] std::size_t getNumberOfHits() const { return numberOfHits; }
+
+  [[nodiscard]] std::size_t getNumberOfMisses() const { return numberOfMisses; }
+};
+
+//! Number of distinct materials among the given ones
+template <typename MaterialT>
+std::size_t countUniqueMaterials(std::vector<const MaterialT*>& materials) {
+  std::sort(materials.begin(), materials.end(), [](const MaterialT* lhs, const MaterialT* rhs) {
+    return compareMaterials(*lhs, *rhs) < 0;
+  });
+  const auto last = std::unique(materials.begin(), materials.end(), [](const MaterialT* lhs, const MaterialT* rhs) {
+    return compareMaterials(*lhs, *rhs) == 0;
+  });
+  return static_cast<std::size_t>(last - materials.begin());
+}
+} // namespace
+
 void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::MeshReader const&      i_meshReader,
                                                          LTSTree*               io_ltsTree,
                                                          LTS*                   i_lts,
                                                          Lut*                   i_ltsLut,
-                                                         TimeStepping const&    timeStepping )
+                                                         TimeStepping const&    timeStepping,
+                                                         DeduplicatedTable<FaceGodunovStates>& godunovStates )
 {
   std::vector<Element> const& elements = i_meshReader.getElements();
   std::vector<Vertex> const& vertices = i_meshReader.getVertices();
@@ -96,6 +219,15 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
   assert(ltsToMesh      == i_ltsLut->getLtsToMeshLut(i_lts->localIntegration.mask));
   assert(ltsToMesh      == i_ltsLut->getLtsToMeshLut(i_lts->neighboringIntegration.mask));
 
+  using MaterialT = decltype(CellMaterialData::local);
+#ifdef _OPENMP
+  const auto numberOfThreads = static_cast<std::size_t>(omp_get_max_threads());
+#else
+  const std::size_t numberOfThreads = 1;
+#endif
+  std::vector<GodunovStateCache<MaterialT>> godunovStateCaches(numberOfThreads);
+  std::vector<const MaterialT*> cellMaterials;
+
   for (LTSTree::leaf_iterator it = io_ltsTree->beginLeaf(LayerMask(Ghost)); it != io_ltsTree->endLeaf(); ++it) {
     CellMaterialData*           material                = it->var(i_lts->material);
     LocalIntegrationData*       localIntegration        = it->var(i_lts->localIntegration);
@@ -107,12 +239,9 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
     {
 #endif
     real ATData[tensor::star::size(0)];
-    real ATtildeData[tensor::star::size(0)];
     real BTData[tensor::star::size(1)];
     real CTData[tensor::star::size(2)];
     auto AT = init::star::view<0>::create(ATData);
-    // AT with elastic parameters in local coordinate system, used for flux kernel
-    auto ATtilde = init::star::view<0>::create(ATtildeData);
     auto BT = init::star::view<0>::create(BTData);
     auto CT = init::star::view<0>::create(CTData);
 
@@ -121,11 +250,13 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
     auto T = init::T::view::create(TData);
     auto Tinv = init::Tinv::view::create(TinvData);
 
-    real QgodLocalData[tensor::QgodLocal::size()];
-    real QgodNeighborData[tensor::QgodNeighbor::size()];
-    auto QgodLocal = init::QgodLocal::view::create(QgodLocalData);
-    auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
-    
+#ifdef _OPENMP
+    auto& godunovStateCache = godunovStateCaches[omp_get_thread_num()];
+#else
+    auto& godunovStateCache = godunovStateCaches[0];
+#endif
+    FaceGodunovStates anisotropicStates;
+
 #ifdef _OPENMP
     #pragma omp for schedule(static)
 #endif
@@ -172,51 +303,72 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
 
         real NLocalData[6*6];
         seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
+        // the Godunov states of anisotropic materials depend on the face orientation and are never shared
+        typename GodunovStateCache<MaterialT>::Entry* cachedEntry = nullptr;
+        const FaceGodunovStates* states = nullptr;
         if (material[cell].local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
-          seissol::model::getTransposedGodunovState(  seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)),
-                                                      seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].neighbor[side])),
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)), 0, ATtilde );
+          computeGodunovStates( seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)),
+                                seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].neighbor[side])),
+                                cellInformation[cell].faceTypes[side],
+                                anisotropicStates );
+          states = &anisotropicStates;
         } else {
-          seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                      material[cell].neighbor[side],     
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, ATtilde );
+          cachedEntry = &godunovStateCache.get( material[cell].local,
+                                                material[cell].neighbor[side],
+                                                cellInformation[cell].faceTypes[side] );
+          states = &cachedEntry->states;
         }
 
-        // Calculate transposed T instead
-        seissol::model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
-
         // Scale with |S_side|/|J| and multiply with -1 as the flux matrices
         // must be subtracted.
         real fluxScale = -2.0 * surface / (6.0 * volume);
 
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+        // Only store the inputs of the flux solvers, see kernels::localFluxSolver and kernels::neighborFluxSolver
+        FaceFluxSolverData& face = neighboringIntegration[cell].faces[side];
+        // only faces which miss the cache have to look up the shared table
+        if (cachedEntry != nullptr && cachedEntry->shared != nullptr) {
+          face.godunovStates = cachedEntry->shared;
+        } else {
+#ifdef _OPENMP
+          #pragma omp critical (godunovStates)
+#endif
+          face.godunovStates = godunovStates.insert(*states);
+          if (cachedEntry != nullptr) {
+            cachedEntry->shared = face.godunovStates;
+          }
+        }
+        std::copy_n(normal, 3, face.normal);
+        std::copy_n(tangent1, 3, face.tangent1);
+        std::copy_n(tangent2, 3, face.tangent2);
+        face.fluxScale = fluxScale;
+#else
+        // Calculate transposed T instead
+        seissol::model::getFaceRotationMatrix(normal, tangent1, tangent2, T, Tinv);
+
         kernel::computeFluxSolverLocal localKrnl;
         localKrnl.fluxScale = fluxScale;
         localKrnl.AplusT = localIntegration[cell].nApNm1[side];
-        localKrnl.QgodLocal = QgodLocalData;
+        localKrnl.QgodLocal = states->QgodLocal;
         localKrnl.T = TData;
         localKrnl.Tinv = TinvData;
-        localKrnl.star(0) = ATtildeData;
+        localKrnl.star(0) = states->starMatrix;
         localKrnl.execute();
         
         kernel::computeFluxSolverNeighbor neighKrnl;
         neighKrnl.fluxScale = fluxScale;
         neighKrnl.AminusT = neighboringIntegration[cell].nAmNm1[side];
-        neighKrnl.QgodNeighbor = QgodNeighborData;
+        neighKrnl.QgodNeighbor = states->QgodNeighbor;
         neighKrnl.T = TData;
         neighKrnl.Tinv = TinvData;
-        neighKrnl.star(0) = ATtildeData;
+        neighKrnl.star(0) = states->starMatrix;
         if (cellInformation[cell].faceTypes[side] == FaceType::dirichlet ||
             cellInformation[cell].faceTypes[side] == FaceType::freeSurfaceGravity) {
           // Already rotated!
           neighKrnl.Tinv = init::identityT::Values;
         }
         neighKrnl.execute();
+#endif
       }
 
       seissol::model::initializeSpecificLocalData(  material[cell].local,
@@ -231,7 +383,29 @@ void seissol::initializers::initializeCellLocalMatrices( seissol::geometry::Mesh
     }
 #endif
     ltsToMesh += it->getNumberOfCells();
+    for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+      cellMaterials.push_back(&material[cell].local);
+    }
   }
+
+  const std::size_t numberOfFaces = 4 * cellMaterials.size();
+  std::size_t numberOfComputedStates = 0;
+  std::size_t numberOfCachedFaces = 0;
+  for (const auto& godunovStateCache : godunovStateCaches) {
+    numberOfComputedStates += godunovStateCache.getNumberOfMisses();
+    numberOfCachedFaces += godunovStateCache.getNumberOfHits() + godunovStateCache.getNumberOfMisses();
+  }
+  // anisotropic faces bypass the caches
+  numberOfComputedStates += numberOfFaces - numberOfCachedFaces;
+
+  const auto numberOfCells = cellMaterials.size();
+  const auto rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Found" << countUniqueMaterials(cellMaterials) << "unique material parameter sets in" << numberOfCells << "cells.";
+  logInfo(rank) << "Computed" << numberOfComputedStates << "Godunov states for" << numberOfFaces << "faces.";
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  logInfo(rank) << "Flux solvers are recomputed from" << godunovStates.size()
+                << "unique Godunov states for" << godunovStates.getNumberOfInsertions() << "faces.";
+#endif
 }
 
 void surfaceAreaAndVolume(  seissol::geometry::MeshReader const&      i_meshReader,
@@ -48,18 +48,23 @@
 #include <Initializer/tree/LTSTree.hpp>
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/Boundary.h>
+#include <Initializer/DeduplicatedTable.h>
 
 namespace seissol {
   namespace initializers {
       class EasiBoundary;
       /**
       * Computes the star matrices A*, B*, and C*, and solves the Riemann problems at the interfaces.
+      * If the flux solvers are recomputed, the Godunov states of the faces are stored in godunovStates.
+      * Consecutive faces with equal materials and face type share their Godunov states, except for anisotropic materials.
+      * The material parameters remain a per-cell copy in the LTS tree.
       **/
      void initializeCellLocalMatrices( seissol::geometry::MeshReader const&      i_meshReader,
                                        LTSTree*               io_ltsTree,
                                        LTS*                   i_lts,
                                        Lut*                   i_ltsLut,
-                                       TimeStepping const&    timeStepping );
+                                       TimeStepping const&    timeStepping,
+                                       DeduplicatedTable<FaceGodunovStates>& godunovStates );
                                        
      void initializeBoundaryMappings(seissol::geometry::MeshReader const& i_meshReader,
                                      const EasiBoundary* easiBoundary,
@@ -0,0 +1,57 @@
+#ifndef SEISSOL_DEDUPLICATEDTABLE_H
+#define SEISSOL_DEDUPLICATEDTABLE_H
+
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <set>
+#include <type_traits>
+
+namespace seissol::initializers {
+
+/**
+ * Stores each distinct value only once, such that equal per-cell or per-face data can be shared.
+ *
+ * Values are compared bytewise, hence T must not contain padding or pointers to other data.
+ * The returned pointers stay valid for the lifetime of the table.
+ * The table is not thread-safe.
+ **/
+template <typename T>
+class DeduplicatedTable {
+  static_assert(std::is_trivially_copyable_v<T>, "values are compared bytewise");
+
+ private:
+  struct BytewiseLess {
+    bool operator()(const T* lhs, const T* rhs) const { return std::memcmp(lhs, rhs, sizeof(T)) < 0; }
+  };
+
+  std::deque<T> values;
+  std::set<const T*, BytewiseLess> index;
+  std::size_t numberOfInsertions = 0;
+
+ public:
+  DeduplicatedTable() = default;
+  DeduplicatedTable(const DeduplicatedTable&) = delete;
+  DeduplicatedTable& operator=(const DeduplicatedTable&) = delete;
+
+  //! Returns the stored value which equals the given one, and stores a copy if there is none
+  const T* insert(const T& value) {
+    ++numberOfInsertions;
+    const auto it = index.find(&value);
+    if (it != index.end()) {
+      return *it;
+    }
+    const T* stored = &values.emplace_back(value);
+    index.insert(stored);
+    return stored;
+  }
+
+  //! Number of distinct values
+  [[nodiscard]] std::size_t size() const { return values.size(); }
+
+  [[nodiscard]] std::size_t getNumberOfInsertions() const { return numberOfInsertions; }
+};
+
+} // namespace seissol::initializers
+
+#endif // SEISSOL_DEDUPLICATEDTABLE_H
@@ -73,6 +73,11 @@ static void closeSeisSol() {
   seissol::SeisSol::main.faultWriter().close();
   seissol::SeisSol::main.freeSurfaceWriter().close();
 
+#ifdef USE_MPI
+  // free persistent MPI requests before the memory they refer to
+  seissol::SeisSol::main.getMemoryManager().freeCommunicationStructure();
+#endif
+
   // deallocate memory manager
   seissol::SeisSol::main.deleteMemoryManager();
 }
@@ -100,12 +100,19 @@ static void setupOutput() {
         seissol::SeisSol::main.meshReader(),
         ltsClusteringData,
         reinterpret_cast<const real*>(ltsTree->var(lts->dofs)),
-        reinterpret_cast<const real*>(ltsTree->var(lts->pstrain)),
+        ltsTree->var(lts->pstrain),
         seissol::SeisSol::main.postProcessor().getIntegrals(ltsTree),
         ltsLut->getMeshToLtsLut(lts->dofs.mask)[0],
         seissolParams.output.waveFieldParameters,
         seissolParams.output.xdmfWriterBackend,
         backupTimeStamp);
+
+    auto* snapshot = seissol::SeisSol::main.waveFieldWriter().createSnapshot(
+        ltsTree->getNumberOfCells(lts->dofs.mask));
+    if (snapshot != nullptr) {
+      seissol::SeisSol::main.timeManager().setWaveFieldSnapshot(
+          *snapshot, seissolParams.output.waveFieldParameters.interval);
+    }
   }
 
   if (seissolParams.output.freeSurfaceParameters.enabled) {
@@ -86,13 +86,23 @@ static void readMeshPUML(const seissol::initializer::parameters::SeisSolParamete
   bool readPartitionFromFile = seissol::SeisSol::main.simulator().checkPointingEnabled();
 
   using namespace seissol::initializers::time_stepping;
+  const auto* ltsParameters = seissol::SeisSol::main.getMemoryManager().getLtsParameters();
+
+  double clusterOverhead = 0.0;
+  if (ltsParameters->getClusterCostModel() == ClusterCostModel::Calibrated) {
+    logInfo(rank) << "Running mini SeisSol to determine the fixed cost per cluster time step";
+    clusterOverhead = seissol::miniSeisSolClusterOverhead(seissol::SeisSol::main.getMemoryManager(),
+                                                          seissolParams.model.plasticity);
+  }
+
   LtsWeightsConfig config{seissolParams.model.materialFileName,
                           static_cast<unsigned int>(seissolParams.timeStepping.lts.rate),
                           seissolParams.timeStepping.vertexWeight.weightElement,
                           seissolParams.timeStepping.vertexWeight.weightDynamicRupture,
-                          seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity};
+                          seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity,
+                          seissolParams.timeStepping.vertexWeight.weightFile,
+                          clusterOverhead};
 
-  const auto* ltsParameters = seissol::SeisSol::main.getMemoryManager().getLtsParameters();
   auto ltsWeights =
       getLtsWeightsImplementation(seissolParams.timeStepping.lts.weighttype, config, ltsParameters);
   auto meshReader =
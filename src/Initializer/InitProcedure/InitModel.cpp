@@ -214,7 +214,8 @@ static void initializeCellMatrices(LtsInfo& ltsInfo) {
                                                      memoryManager.getLtsTree(),
                                                      memoryManager.getLts(),
                                                      memoryManager.getLtsLut(),
-                                                     ltsInfo.timeStepping);
+                                                     ltsInfo.timeStepping,
+                                                     memoryManager.getGodunovStates());
 
   seissol::initializers::initializeDynamicRuptureMatrices(meshReader,
                                                           memoryManager.getLtsTree(),
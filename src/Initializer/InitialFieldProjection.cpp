@@ -82,8 +82,7 @@ void seissol::initializers::projectInitialField(std::vector<std::unique_ptr<phys
   real iniCondData[tensor::iniCond::size()] __attribute__((aligned(ALIGNMENT))) = {};
   auto iniCond = init::iniCond::view::create(iniCondData);
 
-  std::vector<std::array<double, 3>> quadraturePointsXyz;
-  quadraturePointsXyz.resize(numQuadPoints);
+  std::array<std::array<double, 3>, numQuadPoints> quadraturePointsXyz;
 
   kernel::projectIniCond krnl;
   krnl.projectQP = globalData.projectQPMatrix;
@@ -271,6 +271,8 @@ static void readMesh(ParameterReader& baseReader, SeisSolParameters& seissolPara
       reader.readWithDefault("vertexweightdynamicrupture", 100);
   seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity =
       reader.readWithDefault("vertexweightfreesurfacewithgravity", 100);
+  seissolParams.timeStepping.vertexWeight.weightFile =
+      reader.readWithDefault("vertexweightfile", std::string(""));
 
   seissolParams.mesh.showEdgeCutStatistics = reader.readWithDefault("showedgecutstatistics", false);
 
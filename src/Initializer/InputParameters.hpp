@@ -94,6 +94,7 @@ struct VertexWeightParameters {
   int weightElement;
   int weightDynamicRupture;
   int weightFreeSurfaceWithGravity;
+  std::string weightFile;
 };
 
 struct MeshParameters {
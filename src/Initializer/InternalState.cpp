@@ -43,6 +43,7 @@
 #include <cstddef>
 #include <cassert>
 #include <yateto.h>
+#include <Kernels/TimeBuffers.h>
 
 void seissol::initializers::InternalState::deriveLayerLayout(       unsigned int                  i_numberOfClusters,
                                                                     unsigned int                 *i_numberOfRegions,
@@ -139,15 +140,15 @@ void seissol::initializers::InternalState::setUpLayerPointers(       unsigned in
       // set pointers and increase conunters
       if( (i_cellLocalInformation[l_cell].ltsSetup >> 8 ) % 2 ) {
         o_buffers[l_cell] = i_layerMemory + l_offset
-                                          + l_bufferCounter * tensor::I::size();
+                                          + l_bufferCounter * kernels::BufferSize;
         l_bufferCounter++;
       }
       else o_buffers[l_cell] = NULL;
 
       if( (i_cellLocalInformation[l_cell].ltsSetup >> 9 ) % 2 ) {
         o_derivatives[l_cell] = i_layerMemory + l_offset 
-                                              + i_numberOfBuffers[l_region] * tensor::I::size()
-                                              + l_derivativeCounter * yateto::computeFamilySize<tensor::dQ>();
+                                              + i_numberOfBuffers[l_region] * kernels::BufferSize
+                                              + l_derivativeCounter * kernels::DerivativesSize;
         l_derivativeCounter++;
       }
       else o_derivatives[l_cell] = NULL;
@@ -159,8 +160,8 @@ void seissol::initializers::InternalState::setUpLayerPointers(       unsigned in
 
     // update offsets
     l_firstRegionCell = l_firstNonRegionCell;
-    l_offset += i_numberOfBuffers[l_region]     * tensor::I::size() +
-                i_numberOfDerivatives[l_region] * yateto::computeFamilySize<tensor::dQ>();
+    l_offset += i_numberOfBuffers[l_region]     * kernels::BufferSize +
+                i_numberOfDerivatives[l_region] * kernels::DerivativesSize;
   }
 }
 
@@ -71,9 +71,11 @@
 #include "MemoryManager.h"
 #include "InternalState.h"
 #include "GlobalData.h"
+#include "Parallel/PersistentRequests.h"
 #include <yateto.h>
 
 #include <Kernels/common.hpp>
+#include <Kernels/TimeBuffers.h>
 #include <generated_code/tensor.h>
 #include <unordered_set>
 #include <cmath>
@@ -270,8 +272,8 @@ void seissol::initializers::MemoryManager::initializeCommunicationStructure() {
       unsigned int l_numberOfBuffers     = m_meshStructure[tc].numberOfGhostRegionCells[l_region] - l_numberOfDerivatives;
 
       // set size
-      m_meshStructure[tc].ghostRegionSizes[l_region] = tensor::Q::size() * l_numberOfBuffers +
-                                                       yateto::computeFamilySize<tensor::dQ>() * l_numberOfDerivatives;
+      m_meshStructure[tc].ghostRegionSizes[l_region] = kernels::BufferSize * l_numberOfBuffers +
+                                                       kernels::DerivativesSize * l_numberOfDerivatives;
 
       // update the pointer
       ghostStart += m_meshStructure[tc].ghostRegionSizes[l_region];
@@ -308,13 +310,31 @@ void seissol::initializers::MemoryManager::initializeCommunicationStructure() {
       assert( m_meshStructure[tc].copyRegions[l_region] != NULL );
 
       // set size
-      m_meshStructure[tc].copyRegionSizes[l_region] = tensor::Q::size() * l_numberOfBuffers +
-                                                      yateto::computeFamilySize<tensor::dQ>() * l_numberOfDerivatives;
+      m_meshStructure[tc].copyRegionSizes[l_region] = kernels::BufferSize * l_numberOfBuffers +
+                                                      kernels::DerivativesSize * l_numberOfDerivatives;
 
       // jump over region
       l_offset += m_meshStructure[tc].numberOfCopyRegionCells[l_region];
     }
   }
+
+  /*
+   * persistent requests: buffers, sizes, ranks and tags of the regions never change
+   */
+  if (seissol::MPI::mpi.usePersistentRequests()) {
+    for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+      seissol::parallel::initPersistentRequests(m_meshStructure[tc], timeData, seissol::MPI::mpi.comm());
+    }
+  }
+}
+
+void seissol::initializers::MemoryManager::freeCommunicationStructure() {
+  if (!seissol::MPI::mpi.usePersistentRequests()) {
+    return;
+  }
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    seissol::parallel::freePersistentRequests(m_meshStructure[tc]);
+  }
 }
 #endif
 
@@ -428,7 +448,7 @@ void seissol::initializers::MemoryManager::touchBuffersDerivatives( Layer& layer
     // touch buffers
     real* buffer = buffers[cell];
     if (buffer != NULL) {
-      for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
+      for (unsigned dof = 0; dof < kernels::BufferSize; ++dof) {
           // zero time integration buffers
           buffer[dof] = (real) 0;
       }
@@ -437,7 +457,7 @@ void seissol::initializers::MemoryManager::touchBuffersDerivatives( Layer& layer
     // touch derivatives
     real* derivative = derivatives[cell];
     if (derivative != NULL) {
-      for (unsigned dof = 0; dof < yateto::computeFamilySize<tensor::dQ>(); ++dof ) {
+      for (unsigned dof = 0; dof < kernels::DerivativesSize; ++dof ) {
         derivative[dof] = (real) 0;
       }
     }
@@ -471,6 +491,19 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
   m_ltsTree.allocateVariables();
   m_ltsTree.touchVariables();
 
+#ifdef ACL_DEVICE
+  if (usePlasticity) {
+    // The batched plasticity kernels update the plastic strain of every cell, hence all cells get a slot
+    m_plasticStrainTable.reserve(m_ltsTree.getNumberOfCells(m_lts.pstrain.mask));
+    for (auto it = m_ltsTree.beginLeaf(m_lts.pstrain.mask); it != m_ltsTree.endLeaf(); ++it) {
+      real** pstrain = it->var(m_lts.pstrain);
+      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+        pstrain[cell] = m_plasticStrainTable.acquire();
+      }
+    }
+  }
+#endif
+
   /// Dynamic rupture tree
   m_dynRup->addTo(m_dynRupTree);
 
@@ -714,15 +747,15 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout()
     size_t l_interiorSize = 0;
 #ifdef USE_MPI
     for( unsigned int l_region = 0; l_region < m_meshStructure[tc].numberOfRegions; l_region++ ) {
-      l_ghostSize    += sizeof(real) * tensor::Q::size() * m_numberOfGhostRegionBuffers[tc][l_region];
-      l_ghostSize    += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfGhostRegionDerivatives[tc][l_region];
+      l_ghostSize    += sizeof(real) * kernels::BufferSize * m_numberOfGhostRegionBuffers[tc][l_region];
+      l_ghostSize    += sizeof(real) * kernels::DerivativesSize * m_numberOfGhostRegionDerivatives[tc][l_region];
 
-      l_copySize     += sizeof(real) * tensor::Q::size() * m_numberOfCopyRegionBuffers[tc][l_region];
-      l_copySize     += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfCopyRegionDerivatives[tc][l_region];
+      l_copySize     += sizeof(real) * kernels::BufferSize * m_numberOfCopyRegionBuffers[tc][l_region];
+      l_copySize     += sizeof(real) * kernels::DerivativesSize * m_numberOfCopyRegionDerivatives[tc][l_region];
     }
 #endif // USE_MPI
-    l_interiorSize += sizeof(real) * tensor::Q::size() * m_numberOfInteriorBuffers[tc];
-    l_interiorSize += sizeof(real) * yateto::computeFamilySize<tensor::dQ>() * m_numberOfInteriorDerivatives[tc];
+    l_interiorSize += sizeof(real) * kernels::BufferSize * m_numberOfInteriorBuffers[tc];
+    l_interiorSize += sizeof(real) * kernels::DerivativesSize * m_numberOfInteriorDerivatives[tc];
 
     cluster.child<Ghost>().setBucketSize(m_lts.buffersDerivatives, l_ghostSize);
     cluster.child<Copy>().setBucketSize(m_lts.buffersDerivatives, l_copySize);
@@ -86,6 +86,8 @@
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/InputAux.hpp>
 #include <Initializer/Boundary.h>
+#include <Initializer/DeduplicatedTable.h>
+#include <Initializer/PlasticStrainTable.h>
 #include <Initializer/ParameterDB.h>
 #include <Initializer/time_stepping/LtsParameters.h>
 
@@ -167,6 +169,12 @@ class seissol::initializers::MemoryManager {
     LTS                   m_lts;
     Lut                   m_ltsLut;
 
+    //! Godunov states shared by the faces if the flux solvers are recomputed
+    DeduplicatedTable<FaceGodunovStates> m_godunovStates;
+
+    //! Plastic strain of the cells which have yielded, see LTS::pstrain
+    PlasticStrainTable m_plasticStrainTable{MEMKIND_UNIFIED};
+
     std::vector<std::unique_ptr<physics::InitialField>> m_iniConds;
     
     LTSTree m_dynRupTree;
@@ -253,6 +261,14 @@ class seissol::initializers::MemoryManager {
      * Initialization function, which allocates memory for the global matrices and initializes them.
      **/
     void initialize();
+
+#ifdef USE_MPI
+    /**
+     * Frees the persistent MPI requests of the communication structure, if any.
+     * Needs to be called before MPI is finalized.
+     **/
+    void freeCommunicationStructure();
+#endif
     
     /**
      * Sets the number of cells in each leaf of the lts tree, fixates the variables, and allocates memory.
@@ -323,6 +339,14 @@ class seissol::initializers::MemoryManager {
       return &m_ltsLut;
     }
 
+    inline DeduplicatedTable<FaceGodunovStates>& getGodunovStates() {
+      return m_godunovStates;
+    }
+
+    inline PlasticStrainTable& getPlasticStrainTable() {
+      return m_plasticStrainTable;
+    }
+
     // TODO(David): remove again (this method is merely a temporary construction to transition from C++ to FORTRAN and should be removed in the next refactoring step)
     inline Lut& getLtsLutUnsafe() {
       return m_ltsLut;
@@ -0,0 +1,43 @@
+#include "PlasticStrainTable.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace seissol::initializers {
+
+PlasticStrainTable::PlasticStrainTable(memory::Memkind memkind, std::size_t slotsPerChunk)
+    : memkind(memkind), slotsPerChunk(slotsPerChunk) {}
+
+PlasticStrainTable::~PlasticStrainTable() {
+  for (auto* chunk : chunks) {
+    memory::free(chunk, memkind);
+  }
+}
+
+real* PlasticStrainTable::acquire() {
+  const std::lock_guard<std::mutex> lock(mutex);
+  if (chunkUsed == chunkCapacity) {
+    allocateChunk(slotsPerChunk);
+  }
+  real* slot = chunks.back() + chunkUsed * SlotSize;
+  ++chunkUsed;
+  ++numberOfSlots;
+  std::memset(slot, 0, SlotSize * sizeof(real));
+  return slot;
+}
+
+void PlasticStrainTable::reserve(std::size_t numberOfSlots) {
+  const std::lock_guard<std::mutex> lock(mutex);
+  if (chunkCapacity - chunkUsed < numberOfSlots) {
+    allocateChunk(std::max(numberOfSlots, slotsPerChunk));
+  }
+}
+
+void PlasticStrainTable::allocateChunk(std::size_t capacity) {
+  chunks.push_back(static_cast<real*>(
+      memory::allocate(capacity * SlotSize * sizeof(real), PAGESIZE_HEAP, memkind)));
+  chunkCapacity = capacity;
+  chunkUsed = 0;
+}
+
+} // namespace seissol::initializers
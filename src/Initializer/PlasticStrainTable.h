@@ -0,0 +1,53 @@
+#ifndef SEISSOL_PLASTICSTRAINTABLE_H
+#define SEISSOL_PLASTICSTRAINTABLE_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "Initializer/MemoryAllocator.h"
+#include "Initializer/typedefs.hpp"
+
+namespace seissol::initializers {
+
+/**
+ * Holds the plastic strain and eta of the cells which have yielded.
+ *
+ * A cell gets a zero-initialized slot of SlotSize reals when it yields for the first time,
+ * cells without a slot have zero plastic strain. Slots are allocated in chunks, hence the
+ * returned pointers stay valid for the lifetime of the table.
+ **/
+class PlasticStrainTable {
+ public:
+  //! Six strain components and eta, each with NUMBER_OF_ALIGNED_BASIS_FUNCTIONS coefficients
+  static constexpr std::size_t SlotSize = 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS;
+
+  explicit PlasticStrainTable(memory::Memkind memkind, std::size_t slotsPerChunk = 4096);
+  ~PlasticStrainTable();
+  PlasticStrainTable(const PlasticStrainTable&) = delete;
+  PlasticStrainTable& operator=(const PlasticStrainTable&) = delete;
+
+  //! Returns a new zeroed slot; thread-safe
+  real* acquire();
+
+  //! Ensures that the next numberOfSlots calls of acquire use a single chunk
+  void reserve(std::size_t numberOfSlots);
+
+  //! Number of acquired slots
+  [[nodiscard]] std::size_t size() const { return numberOfSlots; }
+
+ private:
+  void allocateChunk(std::size_t capacity);
+
+  memory::Memkind memkind;
+  std::size_t slotsPerChunk;
+  std::vector<real*> chunks;
+  std::size_t chunkCapacity = 0;
+  std::size_t chunkUsed = 0;
+  std::size_t numberOfSlots = 0;
+  std::mutex mutex;
+};
+
+} // namespace seissol::initializers
+
+#endif // SEISSOL_PLASTICSTRAINTABLE_H
@@ -43,11 +43,16 @@
 #include "Parallel/MPI.h"
 
 #include "utils/logger.h"
+#include "utils/env.h"
 
 #include "LtsLayout.h"
 #include "MultiRate.hpp"
 #include "GlobalTimestep.hpp"
+#include <algorithm>
 #include <iterator>
+#include <numeric>
+#include <string>
+#include <tuple>
 
 #include "Initializer/ParameterDB.h"
 
@@ -95,6 +100,23 @@ void seissol::initializers::time_stepping::LtsLayout::setMesh( const seissol::ge
         seissol::initializers::CellToVertexArray::fromMeshReader(i_mesh));
   
   m_cellTimeStepWidths = std::move(timesteps.cellTimeStepWidths);
+
+  // order of the cells within the layers, see sortClusteredInterior and sortClusteredCopyAlongCurve
+  m_cellOrdering = parseCellOrdering( utils::Env::get( "SEISSOL_CELL_ORDERING", "mesh" ) );
+  std::vector< std::array< double, 3 > > l_barycenters;
+  if( m_cellOrdering != CellOrdering::Mesh ) {
+    const auto& l_vertices = i_mesh.getVertices();
+    l_barycenters.resize( m_cells.size(), { 0.0, 0.0, 0.0 } );
+    for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+      for( const auto l_vertex : m_cells[l_cell].vertices ) {
+        for( unsigned int l_dim = 0; l_dim < 3; l_dim++ ) {
+          l_barycenters[l_cell][l_dim] += 0.25 * l_vertices[l_vertex].coords[l_dim];
+        }
+      }
+    }
+  }
+  m_cellCurveIndices = curveIndices( m_cellOrdering, l_barycenters );
+  m_cellCurveIndices.resize( m_cells.size(), 0 );
 }
 
 FaceType seissol::initializers::time_stepping::LtsLayout::getFaceType(int i_meshFaceType) {
@@ -954,6 +976,111 @@ void seissol::initializers::time_stepping::LtsLayout::deriveClusteredCopyInterio
   }
 }
 
+unsigned short seissol::initializers::time_stepping::LtsLayout::getUnnormalizedLtsSetup( unsigned int i_meshId ) {
+  const int rank = seissol::MPI::mpi.rank();
+
+  FaceType     l_faceTypes[4];
+  unsigned int l_neighboringClusterIds[4] = {0};
+  unsigned int l_faceNeighborIds[4] = {0};
+  bool         l_copy = false;
+
+  for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+    l_faceTypes[l_face] = getFaceType( m_cells[i_meshId].boundaries[l_face] );
+
+    if( m_cells[i_meshId].neighborRanks[l_face] != rank ) {
+      // cells with a face neighbor in another rank are part of the copy layer
+      l_copy = true;
+      const unsigned int l_plainRegion = getPlainRegion( m_cells[i_meshId].neighborRanks[l_face] );
+      l_neighboringClusterIds[l_face] = m_plainGhostCellClusterIds[l_plainRegion][ m_cells[i_meshId].mpiIndices[l_face] ];
+    }
+    else if( l_faceTypes[l_face] == FaceType::regular ||
+             l_faceTypes[l_face] == FaceType::periodic ||
+             l_faceTypes[l_face] == FaceType::dynamicRupture ) {
+      l_neighboringClusterIds[l_face] = m_cellClusterIds[ m_cells[i_meshId].neighbors[l_face] ];
+    }
+  }
+
+  return getLtsSetup( m_cellClusterIds[i_meshId], l_neighboringClusterIds, l_faceTypes, l_faceNeighborIds, l_copy );
+}
+
+void seissol::initializers::time_stepping::LtsLayout::sortClusteredInterior() {
+  m_clusteredInteriorPositions.assign( m_cells.size(), std::numeric_limits<unsigned int>::max() );
+
+  // the normalization of a LTS setup depends on the LTS setups of the face neighbors
+  std::vector< unsigned short > l_ltsSetups( m_cells.size() );
+  for( unsigned int l_meshId = 0; l_meshId < m_cells.size(); l_meshId++ ) {
+    l_ltsSetups[l_meshId] = getUnnormalizedLtsSetup( l_meshId );
+  }
+
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredInterior.size(); l_cluster++ ) {
+    // group of a cell: face types and normalized LTS setup, as derived by getCellInformation and deriveLtsSetups
+    std::vector< std::tuple< std::array< unsigned int, 4 >, unsigned short, std::uint64_t, clusterCell > > l_groups;
+    l_groups.reserve( m_clusteredInterior[l_cluster].size() );
+
+    for( const auto l_meshId : m_clusteredInterior[l_cluster] ) {
+      std::array< unsigned int, 4 > l_faceTypes{};
+      unsigned short l_neighboringSetups[4] = { 240, 240, 240, 240 };
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        const FaceType l_faceType = getFaceType( m_cells[l_meshId].boundaries[l_face] );
+        l_faceTypes[l_face] = static_cast<unsigned int>( l_faceType );
+        if( l_faceType == FaceType::regular ||
+            l_faceType == FaceType::periodic ||
+            l_faceType == FaceType::dynamicRupture ) {
+          // interior cells have local face neighbors only
+          l_neighboringSetups[l_face] = l_ltsSetups[ m_cells[l_meshId].neighbors[l_face] ];
+        }
+      }
+      unsigned short l_ltsSetup = l_ltsSetups[l_meshId];
+      normalizeLtsSetup( l_neighboringSetups, l_ltsSetup );
+
+      l_groups.emplace_back( l_faceTypes, l_ltsSetup, m_cellCurveIndices[l_meshId], l_meshId );
+    }
+
+    // ties on the curve (or without a curve) keep the mesh order
+    std::sort( l_groups.begin(), l_groups.end() );
+
+    for( unsigned int l_cell = 0; l_cell < l_groups.size(); l_cell++ ) {
+      m_clusteredInterior[l_cluster][l_cell] = std::get<3>( l_groups[l_cell] );
+      m_clusteredInteriorPositions[ std::get<3>( l_groups[l_cell] ) ] = l_cell;
+    }
+  }
+}
+
+void seissol::initializers::time_stepping::LtsLayout::sortClusteredCopyAlongCurve() {
+  auto l_alongCurve = [this]( unsigned int i_first, unsigned int i_second ) {
+    return std::make_pair( m_cellCurveIndices[i_first], i_first ) < std::make_pair( m_cellCurveIndices[i_second], i_second );
+  };
+
+  for( auto& l_copyLayer : m_clusteredCopy ) {
+    for( auto& l_copyRegion : l_copyLayer ) {
+      // derivatives come first, see sortClusteredCopyGts
+      auto l_firstBuffer = l_copyRegion.second.begin() + l_copyRegion.first[2];
+      std::sort( l_copyRegion.second.begin(), l_firstBuffer,            l_alongCurve );
+      std::sort( l_firstBuffer,               l_copyRegion.second.end(), l_alongCurve );
+    }
+  }
+}
+
+void seissol::initializers::time_stepping::LtsLayout::deriveSearchOrders() {
+  auto l_searchOrder = []( const std::vector< unsigned int > &i_cells ) {
+    std::vector< unsigned int > l_order( i_cells.size() );
+    std::iota( l_order.begin(), l_order.end(), 0 );
+    std::sort( l_order.begin(), l_order.end(), [&i_cells]( unsigned int i_first, unsigned int i_second ) { return i_cells[i_first] < i_cells[i_second]; } );
+    return l_order;
+  };
+
+  m_clusteredCopySearchOrder.resize( m_clusteredCopy.size() );
+  m_clusteredGhostSearchOrder.resize( m_clusteredGhost.size() );
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredCopy.size(); l_cluster++ ) {
+    for( const auto& l_copyRegion : m_clusteredCopy[l_cluster] ) {
+      m_clusteredCopySearchOrder[l_cluster].push_back( l_searchOrder( l_copyRegion.second ) );
+    }
+    for( const auto& l_ghostRegion : m_clusteredGhost[l_cluster] ) {
+      m_clusteredGhostSearchOrder[l_cluster].push_back( l_searchOrder( l_ghostRegion.second ) );
+    }
+  }
+}
+
 void seissol::initializers::time_stepping::LtsLayout::deriveClusteredGhost() {
   /*
    * Get sizes of the ghost regions
@@ -1204,8 +1331,20 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
   // derive clustered copy and interior layout
   deriveClusteredCopyInterior();
 
+  // group the interior cells by face types and LTS setup
+  sortClusteredInterior();
+
+  if( m_cellOrdering != CellOrdering::Mesh ) {
+    logInfo(rank) << "Ordering the cells of the interior and the copy regions along the"
+                  << ( m_cellOrdering == CellOrdering::Hilbert ? "Hilbert" : "Morton" ) << "curve.";
+    sortClusteredCopyAlongCurve();
+  }
+
   // derive the region sizes of the ghost layer
   deriveClusteredGhost();
+
+  // copy and ghost regions are not necessarily sorted by mesh id
+  deriveSearchOrders();
   
   // derive dynamic rupture layers
   deriveDynamicRupturePlainCopyInterior();
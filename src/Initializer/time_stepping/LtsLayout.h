@@ -47,9 +47,14 @@
 #include <Geometry/MeshDefinition.h>
 #include <Geometry/MeshReader.h>
 
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <limits>
 #include <cassert>
+#include <vector>
 
 namespace seissol {
   namespace initializers {
@@ -63,7 +68,7 @@ namespace seissol {
  * Layout used by the LTS schemes for computation.
  **/
 class seissol::initializers::time_stepping::LtsLayout {
-  //private:
+  protected:
     //! used clustering strategy
     enum TimeClustering m_clusteringStrategy;
 
@@ -76,6 +81,12 @@ class seissol::initializers::time_stepping::LtsLayout {
     //! time step widths of the cells (cfl)
     std::vector<double>       m_cellTimeStepWidths;
 
+    //! order of the cells within a layer
+    CellOrdering m_cellOrdering = CellOrdering::Mesh;
+
+    //! position of the cell barycenters on the space filling curve, all zero if the order of the mesh is kept
+    std::vector<std::uint64_t> m_cellCurveIndices;
+
     //! cluster ids of the cells
     unsigned int *m_cellClusterIds;
 
@@ -159,6 +170,21 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     std::vector< std::vector< clusterCell > > m_clusteredInterior;
 
+    /**
+     * position of an interior cell in its clustered interior
+     * [*]           : mesh id (only valid for interior cells)
+     **/
+    std::vector< unsigned int > m_clusteredInteriorPositions;
+
+    /**
+     * positions of the cells of the copy and ghost regions, sorted by mesh id
+     * [*][ ][ ]     : cluster
+     * [ ][*][ ]     : region
+     * [ ][ ][*]     : position in the region
+     **/
+    std::vector< std::vector< std::vector< unsigned int > > > m_clusteredCopySearchOrder;
+    std::vector< std::vector< std::vector< unsigned int > > > m_clusteredGhostSearchOrder;
+
     /**
      * copy region of a time stepping cluster.
      * first[0]: mpi rank of the neighboring cluster
@@ -321,6 +347,53 @@ class seissol::initializers::time_stepping::LtsLayout {
      */
     void sortClusteredCopyGts( clusterCopyRegion &io_copyRegion);
 
+    /**
+     * Gets the LTS setup of a cell before its normalization, see getLtsSetup in common.hpp.
+     * The cluster ids of face neighbors in other ranks are taken from the plain ghost layer.
+     *
+     * @param i_meshId mesh id of the cell.
+     **/
+    unsigned short getUnnormalizedLtsSetup( unsigned int i_meshId );
+
+    /**
+     * Sorts the interior of every cluster by the face types and the (normalized) LTS setups of the cells.
+     * Cells with the same face types and LTS setup are contiguous afterwards, such that the time clusters can compute
+     * them with kernels specialized for the group. Within a group, the cells are ordered along the space filling curve,
+     * or keep the order of the mesh if no curve is used.
+     **/
+    void sortClusteredInterior();
+
+    /**
+     * Orders the cells of every copy region along the space filling curve.
+     * Cells which send derivatives and cells which send buffers are sorted separately, see sortClusteredCopyGts.
+     * The ghost regions of the neighboring ranks follow, as they are derived from the ordered copy regions.
+     **/
+    void sortClusteredCopyAlongCurve();
+
+    /**
+     * Derives the search orders of the copy and ghost regions, whose cells are not necessarily sorted by mesh id.
+     **/
+    void deriveSearchOrders();
+
+    /**
+     * Searches for the position of a cell in a region.
+     *
+     * @param i_cells mesh ids of the cells in the region.
+     * @param i_searchOrder positions of the cells, sorted by mesh id.
+     * @param i_meshId mesh id of the cell.
+     * @return position of the cell in the region or the size of the region if the cell is not part of it.
+     **/
+    static unsigned int searchRegion( const std::vector< unsigned int > &i_cells,
+                                      const std::vector< unsigned int > &i_searchOrder,
+                                      unsigned int                       i_meshId ) {
+      auto l_searchResult = std::lower_bound( i_searchOrder.begin(),
+                                              i_searchOrder.end(),
+                                              i_meshId,
+                                              [&i_cells]( unsigned int i_position, unsigned int i_value ) { return i_cells[i_position] < i_value; } );
+      if( l_searchResult == i_searchOrder.end() || i_cells[*l_searchResult] != i_meshId ) return i_cells.size();
+      return *l_searchResult;
+    }
+
     /**
      * Adds a specific cell with given cluster id, neighboring rank and neighboring cluster id to the respective copy region (if not present already).
      *
@@ -354,28 +427,12 @@ class seissol::initializers::time_stepping::LtsLayout {
     unsigned int searchClusteredGhostCell( unsigned int i_meshId,
                                            unsigned int i_cluster,
                                            unsigned int i_region ) {
-      unsigned int l_localGhostId = 0;
-      std::vector< unsigned int >::iterator l_searchResult;
-
-      // non-gts neighbors have a linear ordering
-      if( m_clusteredCopy[i_cluster][i_region].first[1] != m_localClusters[i_cluster] ) {
-        // search for the right cell in the ghost region (exploits sorting by mesh ids)
-        l_searchResult = std::lower_bound( m_clusteredGhost[i_cluster][i_region].second.begin(), // start of the search
-                                           m_clusteredGhost[i_cluster][i_region].second.end(),   // end of the search
-                                           i_meshId );                                           // value to search for
-      }
-      // gts neighbors not necessarily
-      else {
-        l_searchResult = std::find( m_clusteredGhost[i_cluster][i_region].second.begin(), // start of the search
-                                    m_clusteredGhost[i_cluster][i_region].second.end(),   // end of the search
-                                    i_meshId );                                           // value to search for
-      }
-
-      l_localGhostId = l_searchResult - m_clusteredGhost[i_cluster][i_region].second.begin();
+      unsigned int l_localGhostId = searchRegion( m_clusteredGhost[i_cluster][i_region].second,
+                                                  m_clusteredGhostSearchOrder[i_cluster][i_region],
+                                                  i_meshId );
 
       // ensure there's a valid result
-      if(  l_localGhostId > m_clusteredGhost[i_cluster][i_region].second.size() - 1 ||
-          *l_searchResult != i_meshId ) logError() << "no matching neighboring ghost region cell";
+      if( l_localGhostId == m_clusteredGhost[i_cluster][i_region].second.size() ) logError() << "no matching neighboring ghost region cell";
 
       return l_localGhostId;
     }
@@ -398,27 +455,12 @@ class seissol::initializers::time_stepping::LtsLayout {
 
       // search cell in the possible copy regions
       for( unsigned int l_region = 0; l_region < m_clusteredCopy[o_localClusterId].size(); l_region++ ) {
-        std::vector< unsigned int >::iterator l_searchResult;
-        unsigned int l_localCellId;
-
-        // non-gts neighbors have a linear ordering
-        if( m_clusteredCopy[o_localClusterId][l_region].first[1] != m_cellClusterIds[i_meshId] ) {
-          l_searchResult = std::lower_bound( m_clusteredCopy[o_localClusterId][l_region].second.begin(), // start of the search
-                                             m_clusteredCopy[o_localClusterId][l_region].second.end(),   // end of the search
-                                             i_meshId );                                                 // value to search for
-          l_localCellId = l_searchResult - m_clusteredCopy[o_localClusterId][l_region].second.begin();
-        }
-        // gts neighbors not necessarily
-        else {
-          l_searchResult = std::find( m_clusteredCopy[o_localClusterId][l_region].second.begin(), // start of the search
-                                      m_clusteredCopy[o_localClusterId][l_region].second.end(),   // end of the search
-                                      i_meshId );                                                 // value to search for
-          l_localCellId = l_searchResult - m_clusteredCopy[o_localClusterId][l_region].second.begin();
-        }
+        unsigned int l_localCellId = searchRegion( m_clusteredCopy[o_localClusterId][l_region].second,
+                                                   m_clusteredCopySearchOrder[o_localClusterId][l_region],
+                                                   i_meshId );
 
         // not found continue
-        if( l_localCellId > m_clusteredCopy[o_localClusterId][l_region].second.size() - 1 ||
-            *l_searchResult != i_meshId ) {
+        if( l_localCellId == m_clusteredCopy[o_localClusterId][l_region].second.size() ) {
           assert( l_region != m_clusteredCopy[o_localClusterId].size() - 1 );
         }
         // success: store value and abort search over regions
@@ -444,14 +486,12 @@ class seissol::initializers::time_stepping::LtsLayout {
       o_localClusterId = m_cellClusterIds[ i_meshId ];
       o_localClusterId = getLocalClusterId( o_localClusterId );
 
-      std::vector< unsigned int >::iterator l_searchResult = std::lower_bound( m_clusteredInterior[o_localClusterId].begin(), // start of the search
-                                                                               m_clusteredInterior[o_localClusterId].end(),   // end of the search
-                                                                               i_meshId );                                    // value to search for
-      o_localCellId = l_searchResult - m_clusteredInterior[o_localClusterId].begin();
+      // the interior is not sorted by mesh id, see sortClusteredInterior()
+      o_localCellId = m_clusteredInteriorPositions[ i_meshId ];
 
       // ensure a valid value
       if( o_localCellId > m_clusteredInterior[o_localClusterId].size() - 1 ||
-          *l_searchResult != i_meshId ) logError() << "no matching neighboring interior cell";
+          m_clusteredInterior[o_localClusterId][o_localCellId] != i_meshId ) logError() << "no matching neighboring interior cell";
     }
 
   public:
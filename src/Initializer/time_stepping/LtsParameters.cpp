@@ -16,6 +16,16 @@ AutoMergeCostBaseline parseAutoMergeCostBaseline(std::string str) {
   throw std::invalid_argument(str + " is not a valid cluster merging baseline");
 }
 
+ClusterCostModel parseClusterCostModel(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](auto c) { return std::tolower(c); });
+  if (str == "theoretical") {
+    return ClusterCostModel::Theoretical;
+  } else if (str == "calibrated") {
+    return ClusterCostModel::Calibrated;
+  }
+  throw std::invalid_argument(str + " is not a valid cluster cost model");
+}
+
 LtsParameters readLtsParametersFromYaml(std::shared_ptr<YAML::Node>& params) {
   using namespace seissol::initializers;
 
@@ -36,6 +46,8 @@ LtsParameters readLtsParametersFromYaml(std::shared_ptr<YAML::Node>& params) {
   const double allowedPerformanceLossRatioAutoMerge = allowedRelativePerformanceLossAutoMerge + 1.0;
   const auto autoMergeCostBaseline = parseAutoMergeCostBaseline((getWithDefault(
       discretizationParams, "ltsautomergecostbaseline", std::string("bestwigglefactor"))));
+  const auto clusterCostModel = parseClusterCostModel(getWithDefault(
+      discretizationParams, "ltsclustercostmodel", std::string("theoretical")));
   return LtsParameters(rate,
                        wiggleFactorMinimum,
                        wiggleFactorStepsize,
@@ -43,7 +55,8 @@ LtsParameters readLtsParametersFromYaml(std::shared_ptr<YAML::Node>& params) {
                        maxNumberOfClusters,
                        autoMergeClusters,
                        allowedPerformanceLossRatioAutoMerge,
-                       autoMergeCostBaseline);
+                       autoMergeCostBaseline,
+                       clusterCostModel);
 }
 
 LtsParameters::LtsParameters(unsigned int rate,
@@ -53,14 +66,15 @@ LtsParameters::LtsParameters(unsigned int rate,
                              int maxNumberOfClusters,
                              bool ltsAutoMergeClusters,
                              double allowedPerformanceLossRatioAutoMerge,
-                             AutoMergeCostBaseline autoMergeCostBaseline)
+                             AutoMergeCostBaseline autoMergeCostBaseline,
+                             ClusterCostModel clusterCostModel)
     : rate(rate), wiggleFactorMinimum(wiggleFactorMinimum),
       wiggleFactorStepsize(wiggleFactorStepsize),
       wiggleFactorEnforceMaximumDifference(wigleFactorEnforceMaximumDifference),
       maxNumberOfClusters(maxNumberOfClusters),
       autoMergeClusters(ltsAutoMergeClusters),
       allowedPerformanceLossRatioAutoMerge(allowedPerformanceLossRatioAutoMerge),
-      autoMergeCostBaseline(autoMergeCostBaseline) {
+      autoMergeCostBaseline(autoMergeCostBaseline), clusterCostModel(clusterCostModel) {
   const bool isWiggleFactorValid =
       (rate == 1 && wiggleFactorMinimum == 1.0) ||
       (wiggleFactorMinimum <= 1.0 && wiggleFactorMinimum > (1.0 / rate));
@@ -101,4 +115,6 @@ AutoMergeCostBaseline LtsParameters::getAutoMergeCostBaseline() const {
   return autoMergeCostBaseline;
 }
 
+ClusterCostModel LtsParameters::getClusterCostModel() const { return clusterCostModel; }
+
 } // namespace seissol::initializers::time_stepping
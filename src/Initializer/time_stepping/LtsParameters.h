@@ -15,6 +15,15 @@ enum class AutoMergeCostBaseline {
 
 AutoMergeCostBaseline parseAutoMergeCostBaseline(std::string str);
 
+enum class ClusterCostModel {
+  // Cost of a cluster is proportional to its number of cells times its update rate
+  Theoretical,
+  // Adds a fixed cost per time step of a cluster, measured by a benchmark
+  Calibrated,
+};
+
+ClusterCostModel parseClusterCostModel(std::string str);
+
 class LtsParameters {
   private:
   unsigned int rate;
@@ -25,6 +34,7 @@ class LtsParameters {
   bool autoMergeClusters;
   double allowedPerformanceLossRatioAutoMerge;
   AutoMergeCostBaseline autoMergeCostBaseline = AutoMergeCostBaseline::BestWiggleFactor;
+  ClusterCostModel clusterCostModel = ClusterCostModel::Theoretical;
 
   public:
   [[nodiscard]] unsigned int getRate() const;
@@ -36,6 +46,7 @@ class LtsParameters {
   [[nodiscard]] bool isAutoMergeUsed() const;
   [[nodiscard]] double getAllowedPerformanceLossRatioAutoMerge() const;
   [[nodiscard]] AutoMergeCostBaseline getAutoMergeCostBaseline() const;
+  [[nodiscard]] ClusterCostModel getClusterCostModel() const;
 
   LtsParameters(unsigned int rate,
                 double wiggleFactorMinimum,
@@ -44,7 +55,8 @@ class LtsParameters {
                 int maxNumberOfClusters,
                 bool ltsAutoMergeClusters,
                 double allowedPerformanceLossRatioAutoMerge,
-                AutoMergeCostBaseline autoMergeCostBaseline);
+                AutoMergeCostBaseline autoMergeCostBaseline,
+                ClusterCostModel clusterCostModel = ClusterCostModel::Theoretical);
 };
 
 LtsParameters readLtsParametersFromYaml(std::shared_ptr<YAML::Node>& params);
@@ -50,6 +50,10 @@
 #include <Initializer/time_stepping/GlobalTimestep.hpp>
 #include <Parallel/MPI.h>
 
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
 #include <generated_code/init.h>
 
 #include "SeisSol.h"
@@ -72,15 +76,28 @@ double computeLocalCostOfClustering(const std::vector<int>& clusterIds,
                                const std::vector<int>& cellCosts,
                                unsigned int rate,
                                double wiggleFactor,
-                               double minimalTimestep) {
+                               double minimalTimestep,
+                               double clusterOverhead) {
   assert(clusterIds.size() == cellCosts.size());
 
   double cost = 0.0;
+  std::vector<bool> isClusterUsed;
   for (auto i = 0U; i < clusterIds.size(); ++i) {
     const auto cluster = clusterIds[i];
     const auto cellCost = cellCosts[i];
     const double updateFactor = 1.0 / (std::pow(rate, cluster));
     cost += updateFactor * cellCost;
+    if (static_cast<std::size_t>(cluster) >= isClusterUsed.size()) {
+      isClusterUsed.resize(cluster + 1, false);
+    }
+    isClusterUsed[cluster] = true;
+  }
+  if (clusterOverhead > 0.0) {
+    for (std::size_t cluster = 0; cluster < isClusterUsed.size(); ++cluster) {
+      if (isClusterUsed[cluster]) {
+        cost += clusterOverhead / std::pow(rate, cluster);
+      }
+    }
   }
 
   const auto minDtWithWiggle = minimalTimestep * wiggleFactor;
@@ -92,9 +109,10 @@ double computeGlobalCostOfClustering(const std::vector<int>& clusterIds,
                                      unsigned int rate,
                                      double wiggleFactor,
                                      double minimalTimestep,
-                                     MPI_Comm comm) {
-  double cost =
-      computeLocalCostOfClustering(clusterIds, cellCosts, rate, wiggleFactor, minimalTimestep);
+                                     MPI_Comm comm,
+                                     double clusterOverhead) {
+  double cost = computeLocalCostOfClustering(
+      clusterIds, cellCosts, rate, wiggleFactor, minimalTimestep, clusterOverhead);
 #ifdef USE_MPI
   MPI_Allreduce(MPI_IN_PLACE, &cost, 1, MPI_DOUBLE, MPI_SUM, comm);
 #endif // USE_MPI
@@ -118,7 +136,8 @@ int computeMaxClusterIdAfterAutoMerge(const std::vector<int>& clusterIds,
                                       unsigned int rate,
                                       double maximalAdmissibleCost,
                                       double wiggleFactor,
-                                      double minimalTimestep) {
+                                      double minimalTimestep,
+                                      double clusterOverhead) {
   int maxClusterId = *std::max_element(clusterIds.begin(), clusterIds.end());
 #ifdef USE_MPI
   MPI_Allreduce(MPI_IN_PLACE, &maxClusterId, 1, MPI_INT, MPI_MAX, MPI::mpi.comm());
@@ -132,8 +151,13 @@ int computeMaxClusterIdAfterAutoMerge(const std::vector<int>& clusterIds,
   // Iteratively merge clusters until we found the first number of clusters that has a cost that is too high
   for (auto curMaxClusterId = maxClusterId; curMaxClusterId >= 0; --curMaxClusterId) {
     const auto newClustering = enforceMaxClusterId(clusterIds, curMaxClusterId);
-    const double cost = computeGlobalCostOfClustering(
-        newClustering, cellCosts, rate, wiggleFactor, minimalTimestep, MPI::mpi.comm());
+    const double cost = computeGlobalCostOfClustering(newClustering,
+                                                      cellCosts,
+                                                      rate,
+                                                      wiggleFactor,
+                                                      minimalTimestep,
+                                                      MPI::mpi.comm(),
+                                                      clusterOverhead);
     if (cost > maximalAdmissibleCost) {
       // This is the first number of clusters that resulted in an inadmissible cost
       // Hence, it was admissible in the previous iteration
@@ -148,7 +172,92 @@ LtsWeights::LtsWeights(const LtsWeightsConfig& config, const LtsParameters* ltsP
       m_vertexWeightElement(config.vertexWeightElement),
       m_vertexWeightDynamicRupture(config.vertexWeightDynamicRupture),
       m_vertexWeightFreeSurfaceWithGravity(config.vertexWeightFreeSurfaceWithGravity),
-      ltsParameters(ltsParameters) { }
+      m_clusterOverhead(config.clusterOverhead * config.vertexWeightElement),
+      ltsParameters(ltsParameters) {
+  if (m_clusterOverhead > 0.0) {
+    logInfo(seissol::MPI::mpi.rank())
+        << "The cost of the clustering includes a fixed cost of" << config.clusterOverhead
+        << "elements per time step of a cluster.";
+  }
+  if (!config.vertexWeightFile.empty()) {
+    const auto rank = seissol::MPI::mpi.rank();
+    std::ifstream costs(config.vertexWeightFile);
+    if (costs) {
+      logInfo(rank) << "Reading measured vertex weights from" << config.vertexWeightFile;
+      const auto calibratedConfig = calibrateVertexWeights(config, costs);
+      m_vertexWeightDynamicRupture = calibratedConfig.vertexWeightDynamicRupture;
+      logInfo(rank) << "Vertex weights: element =" << m_vertexWeightElement
+                    << ", dynamic rupture =" << m_vertexWeightDynamicRupture
+                    << ", free surface with gravity =" << m_vertexWeightFreeSurfaceWithGravity;
+    } else {
+      logWarning(rank) << "Could not open" << config.vertexWeightFile
+                       << "; using the configured vertex weights.";
+    }
+  }
+}
+
+LtsWeightsConfig calibrateVertexWeights(const LtsWeightsConfig& config, std::istream& costs) {
+  const auto rank = seissol::MPI::mpi.rank();
+  auto calibratedConfig = config;
+
+  std::string line;
+  if (!std::getline(costs, line) || line != "region,constant,perElement") {
+    logWarning(rank) << "The measured costs do not start with the header region,constant,perElement.";
+    return calibratedConfig;
+  }
+
+  std::map<std::string, double> costPerElement;
+  for (unsigned lineNumber = 2; std::getline(costs, line); ++lineNumber) {
+    const auto first = line.find(',');
+    const auto second = first == std::string::npos ? first : line.find(',', first + 1);
+    if (second == std::string::npos || line.find(',', second + 1) != std::string::npos) {
+      logWarning(rank) << "Skipping line" << lineNumber << "of the measured costs: expected 3 columns.";
+      continue;
+    }
+    const auto value = line.substr(second + 1);
+    double perElement = 0.0;
+    std::size_t parsed = 0;
+    try {
+      perElement = std::stod(value, &parsed);
+    } catch (const std::invalid_argument&) {
+      parsed = 0;
+    } catch (const std::out_of_range&) {
+      parsed = 0;
+    }
+    if (parsed == 0 || parsed != value.size() || !std::isfinite(perElement)) {
+      logWarning(rank) << "Skipping line" << lineNumber << "of the measured costs: invalid cost" << value;
+      continue;
+    }
+    costPerElement[line.substr(0, first)] = perElement;
+  }
+
+  const auto local = costPerElement.find("computeLocalIntegration");
+  const auto neighbor = costPerElement.find("computeNeighboringIntegration");
+  const auto dynamicRupture = costPerElement.find("computeDynamicRupture");
+  const auto plasticity = costPerElement.find("computePlasticity");
+  if (local == costPerElement.end() || neighbor == costPerElement.end()) {
+    logWarning(rank) << "The measured costs do not contain the element costs.";
+    return calibratedConfig;
+  }
+  // The plasticity is applied to every cell, hence it is part of the element cost
+  const double plasticityCost =
+      (plasticity != costPerElement.end() && plasticity->second > 0.0) ? plasticity->second : 0.0;
+  const double elementCost = local->second + neighbor->second + plasticityCost;
+  if (elementCost <= 0.0) {
+    logWarning(rank) << "The measured element cost is not positive.";
+    return calibratedConfig;
+  }
+  if (plasticityCost > 0.0) {
+    logInfo(rank) << "The plasticity makes up" << 100.0 * plasticityCost / elementCost
+                  << "% of the measured element cost.";
+  }
+  // The dynamic rupture region counts faces, whose cost is split between the two adjacent cells
+  if (dynamicRupture != costPerElement.end() && dynamicRupture->second > 0.0) {
+    calibratedConfig.vertexWeightDynamicRupture = static_cast<int>(
+        std::lround(config.vertexWeightElement * 0.5 * dynamicRupture->second / elementCost));
+  }
+  return calibratedConfig;
+}
 
 void LtsWeights::computeWeights(PUML::TETPUML const& mesh, double maximumAllowedTimeStep) {
   const auto rank = seissol::MPI::mpi.rank();
@@ -249,7 +358,8 @@ LtsWeights::ComputeWiggleFactorResult
                                                  m_rate,
                                                  maxWiggleFactor,
                                                  m_details.globalMinTimeStep,
-                                                 MPI::mpi.comm());
+                                                 MPI::mpi.comm(),
+                                                 m_clusterOverhead);
     logInfo(rank) << "Baseline cost, without wiggle factor and cluster merging is" << *baselineCost;
   }
   assert(baselineCost);
@@ -276,7 +386,8 @@ LtsWeights::ComputeWiggleFactorResult
                                             m_rate,
                                             maxAdmissibleCost,
                                             curWiggleFactor,
-                                            m_details.globalMinTimeStep);
+                                            m_details.globalMinTimeStep,
+                                            m_clusterOverhead);
       maxClusterIdToEnforce = std::min(maxClusterIdAfterMerging, maxClusterIdToEnforce);
     }
 
@@ -294,7 +405,8 @@ LtsWeights::ComputeWiggleFactorResult
                                                       m_rate,
                                                       curWiggleFactor,
                                                       m_details.globalMinTimeStep,
-                                                      MPI::mpi.comm());
+                                                      MPI::mpi.comm(),
+                                                      m_clusterOverhead);
 
     if (auto it = mapMaxClusterIdToLowestCost.find(maxClusterId);
         it == mapMaxClusterIdToLowestCost.end() || cost <= it->second) {
@@ -42,6 +42,7 @@
 #ifndef INITIALIZER_TIMESTEPPING_LTSWEIGHTS_H_
 #define INITIALIZER_TIMESTEPPING_LTSWEIGHTS_H_
 
+#include <istream>
 #include <limits>
 #include <map>
 #include <optional>
@@ -62,20 +63,46 @@ struct LtsWeightsConfig {
   int vertexWeightElement{};
   int vertexWeightDynamicRupture{};
   int vertexWeightFreeSurfaceWithGravity{};
+  //! costs measured by the loop statistics of a previous run, replace the vertex weights if not empty
+  std::string vertexWeightFile{};
+  //! fixed cost of a time step of a cluster in units of elements, see ClusterCostModel::Calibrated
+  double clusterOverhead{};
 };
 
+/**
+ * Replaces the vertex weights of dynamic rupture faces by the measured costs.
+ *
+ * The costs are the per element regression coefficients of the loop statistics
+ * (see LoopStatistics::writeCosts). The cost of an element is the sum of its
+ * local and neighboring integration and its plasticity, and corresponds to vertexWeightElement.
+ * Regions which are missing keep their configured weight; malformed lines are skipped.
+ *
+ * The costs are not calibrated per cluster, since the weights models account for the update
+ * rate of the clusters, nor per face type other than dynamic rupture, since the free surface
+ * with gravity is evaluated within the local integration of a cell and has no loop statistics region.
+ */
+LtsWeightsConfig calibrateVertexWeights(const LtsWeightsConfig& config, std::istream& costs);
+
+/**
+ * Cost of the clustering per simulated time.
+ *
+ * @param clusterOverhead The fixed cost of a time step of a cluster, which is added
+ *        once per cluster with local cells. In the same units as the cell costs.
+ */
 double computeLocalCostOfClustering(const std::vector<int>& clusterIds,
                                     const std::vector<int>& cellCosts,
                                     unsigned int rate,
                                     double wiggleFactor,
-                                    double minimalTimestep);
+                                    double minimalTimestep,
+                                    double clusterOverhead = 0.0);
 
 double computeGlobalCostOfClustering(const std::vector<int>& clusterIds,
                                      const std::vector<int>& cellCosts,
                                      unsigned int rate,
                                      double wiggleFactor,
                                      double minimalTimestep,
-                                     MPI_Comm comm);
+                                     MPI_Comm comm,
+                                     double clusterOverhead = 0.0);
 
 std::vector<int> enforceMaxClusterId(const std::vector<int>& clusterIds, int maxClusterId);
 
@@ -84,7 +111,8 @@ int computeMaxClusterIdAfterAutoMerge(const std::vector<int>& clusterIds,
                                       unsigned int rate,
                                       double maximalAdmissibleCost,
                                       double wiggleFactor,
-                                      double minimalTimestep);
+                                      double minimalTimestep,
+                                      double clusterOverhead = 0.0);
 
 class LtsWeights {
 public:
@@ -128,6 +156,8 @@ protected:
   int m_vertexWeightElement{};
   int m_vertexWeightDynamicRupture{};
   int m_vertexWeightFreeSurfaceWithGravity{};
+  //! in units of the cell costs
+  double m_clusterOverhead{};
   int m_ncon{std::numeric_limits<int>::infinity()};
   const PUML::TETPUML * m_mesh{nullptr};
   std::vector<int> m_clusterIds{};
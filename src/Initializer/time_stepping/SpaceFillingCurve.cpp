@@ -0,0 +1,104 @@
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace seissol::initializers::time_stepping {
+
+CellOrdering parseCellOrdering(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](auto c) { return std::tolower(c); });
+  if (str == "mesh") {
+    return CellOrdering::Mesh;
+  } else if (str == "morton") {
+    return CellOrdering::Morton;
+  } else if (str == "hilbert") {
+    return CellOrdering::Hilbert;
+  }
+  throw std::invalid_argument(str + " is not a valid cell ordering");
+}
+
+std::uint64_t mortonIndex(const std::array<std::uint32_t, 3>& coords, unsigned bits) {
+  std::uint64_t index = 0;
+  for (int bit = static_cast<int>(bits) - 1; bit >= 0; --bit) {
+    for (const auto coord : coords) {
+      index = (index << 1) | ((coord >> bit) & 1U);
+    }
+  }
+  return index;
+}
+
+std::uint64_t hilbertIndex(std::array<std::uint32_t, 3> coords, unsigned bits) {
+  // Transposes the coordinates to the Hilbert index, see J. Skilling, "Programming the Hilbert curve" (2004)
+  const std::uint32_t highestBit = 1U << (bits - 1);
+  for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (auto& coord : coords) {
+      if ((coord & q) != 0) {
+        // invert
+        coords[0] ^= p;
+      } else {
+        // exchange
+        const std::uint32_t t = (coords[0] ^ coord) & p;
+        coords[0] ^= t;
+        coord ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  coords[1] ^= coords[0];
+  coords[2] ^= coords[1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = highestBit; q > 1; q >>= 1) {
+    if ((coords[2] & q) != 0) {
+      t ^= q - 1;
+    }
+  }
+  for (auto& coord : coords) {
+    coord ^= t;
+  }
+
+  // The transposed index has the same bit interleaving as the Morton index
+  return mortonIndex(coords, bits);
+}
+
+std::vector<std::uint64_t> curveIndices(CellOrdering ordering,
+                                        const std::vector<std::array<double, 3>>& points) {
+  std::vector<std::uint64_t> indices(points.size(), 0);
+  if (ordering == CellOrdering::Mesh || points.empty()) {
+    return indices;
+  }
+
+  std::array<double, 3> min;
+  std::array<double, 3> max;
+  min.fill(std::numeric_limits<double>::max());
+  max.fill(std::numeric_limits<double>::lowest());
+  for (const auto& point : points) {
+    for (unsigned d = 0; d < 3; ++d) {
+      min[d] = std::min(min[d], point[d]);
+      max[d] = std::max(max[d], point[d]);
+    }
+  }
+
+  // The same scaling in all directions keeps the locality of the curve for elongated domains
+  double extent = 0.0;
+  for (unsigned d = 0; d < 3; ++d) {
+    extent = std::max(extent, max[d] - min[d]);
+  }
+  const double maxCoord = static_cast<double>((1U << CurveBits) - 1);
+  const double scale = extent > 0.0 ? maxCoord / extent : 0.0;
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::array<std::uint32_t, 3> coords;
+    for (unsigned d = 0; d < 3; ++d) {
+      coords[d] = static_cast<std::uint32_t>(std::min(maxCoord, std::floor((points[i][d] - min[d]) * scale)));
+    }
+    indices[i] = ordering == CellOrdering::Hilbert ? hilbertIndex(coords) : mortonIndex(coords);
+  }
+  return indices;
+}
+
+} // namespace seissol::initializers::time_stepping
@@ -0,0 +1,40 @@
+#ifndef SEISSOL_SPACEFILLINGCURVE_H
+#define SEISSOL_SPACEFILLINGCURVE_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace seissol::initializers::time_stepping {
+
+enum class CellOrdering {
+  // Order of the mesh reader
+  Mesh,
+  // Z-order curve of the cell barycenters
+  Morton,
+  // Hilbert curve of the cell barycenters
+  Hilbert,
+};
+
+CellOrdering parseCellOrdering(std::string str);
+
+//! Number of bits per coordinate, such that the index of a 3D point fits into 63 bits
+constexpr unsigned CurveBits = 21;
+
+//! Position on the Z-order curve of a point on the grid [0, 2^bits)^3
+std::uint64_t mortonIndex(const std::array<std::uint32_t, 3>& coords, unsigned bits = CurveBits);
+
+//! Position on the Hilbert curve of a point on the grid [0, 2^bits)^3
+std::uint64_t hilbertIndex(std::array<std::uint32_t, 3> coords, unsigned bits = CurveBits);
+
+/**
+ * Positions of the points on the given curve. The bounding box of the points is mapped to the grid of the curve.
+ * All indices are zero for CellOrdering::Mesh.
+ **/
+std::vector<std::uint64_t> curveIndices(CellOrdering ordering,
+                                        const std::vector<std::array<double, 3>>& points);
+
+} // namespace seissol::initializers::time_stepping
+
+#endif // SEISSOL_SPACEFILLINGCURVE_H
@@ -333,13 +333,34 @@ struct CompoundGlobalData {
   GlobalData* onDevice{nullptr};
 };
 
+// inputs of the flux solvers of a face which only depend on the materials and the face type;
+// shared by all faces with equal inputs if the flux solvers are recomputed (USE_RECOMPUTED_FLUX_SOLVERS)
+struct FaceGodunovStates {
+  real QgodLocal[seissol::tensor::QgodLocal::size()];
+  real QgodNeighbor[seissol::tensor::QgodNeighbor::size()];
+  // transposed coefficient matrix of the local material in the face-aligned coordinate system
+  real starMatrix[seissol::tensor::star::size(0)];
+};
+
+// compact description of the flux solvers of a face, which are rebuilt right before use
+struct FaceFluxSolverData {
+  const FaceGodunovStates* godunovStates;
+  double normal[3];
+  double tangent1[3];
+  double tangent2[3];
+  // scaling of the flux solvers with -|S_side|/|J|
+  real fluxScale;
+};
+
 // data for the cell local integration
 struct LocalIntegrationData {
   // star matrices
   real starMatrices[3][seissol::tensor::star::size(0)];
 
+#ifndef USE_RECOMPUTED_FLUX_SOLVERS
   // flux solver for element local contribution
   real nApNm1[4][seissol::tensor::AplusT::size()];
+#endif
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -357,8 +378,13 @@ struct LocalIntegrationData {
 
 // data for the neighboring boundary integration
 struct NeighboringIntegrationData {
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  // inputs of the local and neighboring flux solvers, see kernels::localFluxSolver and kernels::neighborFluxSolver
+  FaceFluxSolverData faces[4];
+#else
   // flux solver for the contribution of the neighboring elements
   real nAmNm1[4][seissol::tensor::AminusT::size()];
+#endif
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -0,0 +1,51 @@
+#include "Kernels/FluxSolvers.h"
+
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+#include <Model/common.hpp>
+#include <generated_code/init.h>
+#include <generated_code/kernel.h>
+
+namespace seissol::kernels {
+
+void rebuildLocalFluxSolver(const FaceFluxSolverData& face, real fluxSolver[tensor::AplusT::size()]) {
+  alignas(ALIGNMENT) real TData[tensor::T::size()];
+  alignas(ALIGNMENT) real TinvData[tensor::Tinv::size()];
+  auto T = init::T::view::create(TData);
+  auto Tinv = init::Tinv::view::create(TinvData);
+  seissol::model::getFaceRotationMatrix(face.normal, face.tangent1, face.tangent2, T, Tinv);
+
+  kernel::computeFluxSolverLocal krnl;
+  krnl.fluxScale = face.fluxScale;
+  krnl.AplusT = fluxSolver;
+  krnl.QgodLocal = face.godunovStates->QgodLocal;
+  krnl.T = TData;
+  krnl.Tinv = TinvData;
+  krnl.star(0) = face.godunovStates->starMatrix;
+  krnl.execute();
+}
+
+void rebuildNeighborFluxSolver(const FaceFluxSolverData& face,
+                               FaceType faceType,
+                               real fluxSolver[tensor::AminusT::size()]) {
+  alignas(ALIGNMENT) real TData[tensor::T::size()];
+  alignas(ALIGNMENT) real TinvData[tensor::Tinv::size()];
+  auto T = init::T::view::create(TData);
+  auto Tinv = init::Tinv::view::create(TinvData);
+  seissol::model::getFaceRotationMatrix(face.normal, face.tangent1, face.tangent2, T, Tinv);
+
+  kernel::computeFluxSolverNeighbor krnl;
+  krnl.fluxScale = face.fluxScale;
+  krnl.AminusT = fluxSolver;
+  krnl.QgodNeighbor = face.godunovStates->QgodNeighbor;
+  krnl.T = TData;
+  krnl.Tinv = TinvData;
+  krnl.star(0) = face.godunovStates->starMatrix;
+  if (faceType == FaceType::dirichlet || faceType == FaceType::freeSurfaceGravity) {
+    // The boundary data is already rotated, see initializeCellLocalMatrices
+    krnl.Tinv = init::identityT::Values;
+  }
+  krnl.execute();
+}
+
+} // namespace seissol::kernels
+#endif
@@ -0,0 +1,82 @@
+#ifndef KERNELS_FLUXSOLVERS_H_
+#define KERNELS_FLUXSOLVERS_H_
+
+#include <Initializer/typedefs.hpp>
+#include <generated_code/tensor.h>
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+#include <generated_code/kernel.h>
+#endif
+
+namespace seissol::kernels {
+
+/**
+ * Access to the flux solvers of the faces of a cell.
+ *
+ * By default, the flux solvers nApNm1 and nAmNm1 are stored per face. With USE_RECOMPUTED_FLUX_SOLVERS,
+ * only the face geometry and a pointer to Godunov states shared by all faces with equal materials are stored,
+ * and the flux solvers are rebuilt into the given buffer right before use.
+ **/
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+constexpr bool RecomputedFluxSolvers = true;
+
+//! Computes the flux solver for the element local contribution of a face
+void rebuildLocalFluxSolver(const FaceFluxSolverData& face, real fluxSolver[tensor::AplusT::size()]);
+
+//! Computes the flux solver for the contribution of the neighboring element of a face
+void rebuildNeighborFluxSolver(const FaceFluxSolverData& face,
+                               FaceType faceType,
+                               real fluxSolver[tensor::AminusT::size()]);
+#else
+constexpr bool RecomputedFluxSolvers = false;
+#endif
+
+//! Returns the flux solver for the element local contribution of the given face; the buffer is only written in the recompute mode
+inline const real* localFluxSolver([[maybe_unused]] const LocalIntegrationData& localIntegration,
+                                   [[maybe_unused]] const NeighboringIntegrationData& neighboringIntegration,
+                                   unsigned face,
+                                   [[maybe_unused]] real buffer[tensor::AplusT::size()]) {
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  rebuildLocalFluxSolver(neighboringIntegration.faces[face], buffer);
+  return buffer;
+#else
+  return localIntegration.nApNm1[face];
+#endif
+}
+
+//! Returns the flux solver for the contribution of the neighboring element of the given face; the buffer is only written in the recompute mode
+inline const real* neighborFluxSolver(const NeighboringIntegrationData& neighboringIntegration,
+                                      [[maybe_unused]] FaceType faceType,
+                                      unsigned face,
+                                      [[maybe_unused]] real buffer[tensor::AminusT::size()]) {
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  rebuildNeighborFluxSolver(neighboringIntegration.faces[face], faceType, buffer);
+  return buffer;
+#else
+  return neighboringIntegration.nAmNm1[face];
+#endif
+}
+
+/**
+ * Adds the flops of rebuilding the local or the neighboring flux solver of a face before its use to the counters,
+ * nothing if the flux solvers are stored. The rotation matrices of the face are computed outside of the generated
+ * kernels and are not counted, just as the boundary conditions in the flop counters of the kernels.
+ **/
+inline void flopsLocalFluxSolver([[maybe_unused]] unsigned int& nonZeroFlops,
+                                 [[maybe_unused]] unsigned int& hardwareFlops) {
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  nonZeroFlops += kernel::computeFluxSolverLocal::NonZeroFlops;
+  hardwareFlops += kernel::computeFluxSolverLocal::HardwareFlops;
+#endif
+}
+
+inline void flopsNeighborFluxSolver([[maybe_unused]] unsigned int& nonZeroFlops,
+                                    [[maybe_unused]] unsigned int& hardwareFlops) {
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  nonZeroFlops += kernel::computeFluxSolverNeighbor::NonZeroFlops;
+  hardwareFlops += kernel::computeFluxSolverNeighbor::HardwareFlops;
+#endif
+}
+
+} // namespace seissol::kernels
+
+#endif // KERNELS_FLUXSOLVERS_H_
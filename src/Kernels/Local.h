@@ -51,6 +51,13 @@
 namespace seissol {
   namespace kernels {
     class Local;
+
+    //! number of cells which are interleaved in the batched local kernel, one cell per SIMD lane
+#ifdef HOST_CELL_BATCH
+    constexpr unsigned CellBatchSize = HOST_CELL_BATCH;
+#else
+    constexpr unsigned CellBatchSize = 1;
+#endif
   }
 }
 
@@ -67,6 +74,62 @@ class seissol::kernels::Local : public LocalBase {
                          double time,
                          double timeStepWidth);
 
+    /**
+     * Computes the local integral of a cell whose faces are all regular or periodic, without branching on the face types.
+     * The result equals the one of computeIntegral for such cells.
+     **/
+    void computeRegularIntegral(real timeIntegrated[tensor::I::size()],
+                                LocalData& data,
+                                LocalTmp& tmp);
+
+    /**
+     * Computes the time derivatives, the time integrated DOFs and the local integral in a single kernel,
+     * such that the derivatives and the time integrated DOFs stay in cache.
+     *
+     * @param timeDerivatives output of all time derivatives, may be nullptr.
+     * @return false if the cell or the equation is not supported, in which case nothing is computed.
+     *         Supported cells have only faces whose local contribution is the local flux kernel.
+     **/
+    bool computeFusedIntegral(double timeStepWidth,
+                              LocalData& data,
+                              LocalTmp& tmp,
+                              real timeIntegrated[tensor::I::size()],
+                              real* timeDerivatives);
+
+#ifdef HOST_CELL_BATCH
+    /**
+     * The star matrices and the local flux solvers of CellBatchSize cells, interleaved such that each cell is one SIMD lane.
+     * They do not change during the simulation, hence they are packed once by packCellBatchMatrices.
+     **/
+    struct CellBatchMatrices {
+      alignas(ALIGNMENT) real starMatrices[yateto::computeFamilySize<tensor::starBatch>()];
+      alignas(ALIGNMENT) real fluxSolvers[yateto::computeFamilySize<tensor::AplusTBatch>()];
+    };
+
+    /**
+     * Packs the matrices of the CellBatchSize cells starting at firstCell.
+     *
+     * @return false if any cell of the batch is not supported by computeFusedIntegralBatched, in which case nothing is packed.
+     **/
+    bool packCellBatchMatrices(LocalData::Loader& loader,
+                               unsigned firstCell,
+                               CellBatchMatrices& matrices);
+
+    /**
+     * Same as computeFusedIntegral for the CellBatchSize cells starting at firstCell, whose data is
+     * interleaved such that the kernel computes one cell per SIMD lane.
+     *
+     * @param matrices the matrices of the batch, see packCellBatchMatrices.
+     * @param timeDerivatives output of all time derivatives per cell, entries may be nullptr.
+     **/
+    void computeFusedIntegralBatched(double timeStepWidth,
+                                     LocalData::Loader& loader,
+                                     unsigned firstCell,
+                                     const CellBatchMatrices& matrices,
+                                     real* const timeIntegrated[CellBatchSize],
+                                     real* const timeDerivatives[CellBatchSize]);
+#endif
+
     void computeBatchedIntegral(ConditionalPointersToRealsTable& dataTable,
                                 ConditionalMaterialTable& materialTable,
                                 ConditionalIndicesTable& indicesTable,
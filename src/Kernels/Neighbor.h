@@ -91,6 +91,14 @@ class seissol::kernels::Neighbor : public NeighborBase {
                                   real* i_timeIntegrated[4],
                                   real* faceNeighbors_prefetch[4]);
 
+    /**
+     * Computes the neighboring integral of a cell whose faces are all regular or periodic, without branching on the face types.
+     * The result equals the one of computeNeighborsIntegral for such cells.
+     **/
+    void computeRegularNeighborsIntegral(NeighborData& data,
+                                         real* const timeIntegrated[4],
+                                         real* const faceNeighborsPrefetch[4]);
+
     void computeBatchedNeighborsIntegral(ConditionalPointersToRealsTable &table);
 
     void flopsNeighborsIntegral(const FaceType i_faceTypes[4],
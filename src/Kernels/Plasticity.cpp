@@ -44,6 +44,8 @@
 #include <cstring>
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <limits>
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include "common.hpp"
@@ -55,6 +57,91 @@ using namespace device;
 #endif
 
 namespace seissol::kernels {
+#ifndef MULTIPLE_SIMULATIONS
+  namespace {
+    constexpr unsigned NumberOfPlasticityBasisFunctions = tensor::QEtaModal::Shape[0];
+    constexpr unsigned NumberOfPlasticityNodes = tensor::QEtaNodal::Shape[0];
+
+    /* The values of the basis function l at the nodes lie in [center[l] - radius[l], center[l] + radius[l]].
+     * The constant basis function has radius 0. */
+    struct NodalBasisBounds {
+      real center[NumberOfPlasticityBasisFunctions];
+      real radius[NumberOfPlasticityBasisFunctions];
+    };
+
+    NodalBasisBounds computeNodalBasisBounds() {
+      NodalBasisBounds bounds{};
+      real QEtaModal[tensor::QEtaModal::size()] __attribute__((aligned(ALIGNMENT)));
+      real QEtaNodal[tensor::QEtaNodal::size()] __attribute__((aligned(ALIGNMENT)));
+      for (unsigned l = 0; l < NumberOfPlasticityBasisFunctions; ++l) {
+        std::fill(std::begin(QEtaModal), std::end(QEtaModal), 0.0);
+        QEtaModal[l] = 1.0;
+
+        kernel::plConvertEtaModal2Nodal m2nKrnl;
+        m2nKrnl.v = init::v::Values;
+        m2nKrnl.QEtaModal = QEtaModal;
+        m2nKrnl.QEtaNodal = QEtaNodal;
+        m2nKrnl.execute();
+
+        const auto [minValue, maxValue] = std::minmax_element(QEtaNodal, QEtaNodal + NumberOfPlasticityNodes);
+        bounds.center[l] = 0.5 * (*maxValue + *minValue);
+        bounds.radius[l] = 0.5 * (*maxValue - *minValue);
+      }
+      return bounds;
+    }
+  } // namespace
+#endif
+
+  bool Plasticity::isBelowYieldSurface(PlasticityData const *plasticityData,
+                                       real const degreesOfFreedom[tensor::Q::size()]) {
+#ifdef MULTIPLE_SIMULATIONS
+    return false;
+#else
+    static const NodalBasisBounds bounds = computeNodalBasisBounds();
+
+    /* At every node, the stress component p (including sigma0) lies in [center[p] - radius[p], center[p] + radius[p]].
+     * This is the same as plConvertToNodal, but with the vandermonde matrix replaced by the bounds of its columns. */
+    auto QStress = init::QStress::view::create(const_cast<real*>(degreesOfFreedom));
+    real center[6];
+    real radius[6];
+    real scale = 0.0;
+    for (unsigned p = 0; p < 6; ++p) {
+      center[p] = plasticityData->initialLoading[p];
+      radius[p] = 0.0;
+      for (unsigned l = 0; l < NumberOfPlasticityBasisFunctions; ++l) {
+        center[p] += bounds.center[l] * QStress(l, p);
+        radius[p] += bounds.radius[l] * std::abs(QStress(l, p));
+      }
+      scale += std::abs(center[p]) + radius[p];
+    }
+
+    // m = s_{ii} / 3.0 lies in [meanCenter - meanRadius, meanCenter + meanRadius]
+    const real meanCenter = (center[0] + center[1] + center[2]) / 3.0;
+    const real meanRadius = (radius[0] + radius[1] + radius[2]) / 3.0;
+
+    // Bound the deviatoric stresses s_{ij} - m delta_{ij} and tau = sqrt(I_2) from above
+    real secondInvariantBound = 0.0;
+    for (unsigned p = 0; p < 3; ++p) {
+      const real deviatoricBound = std::abs(center[p] - meanCenter) + radius[p] / 3.0 + meanRadius;
+      secondInvariantBound += 0.5 * deviatoricBound * deviatoricBound;
+    }
+    for (unsigned p = 3; p < 6; ++p) {
+      const real deviatoricBound = std::abs(center[p]) + radius[p];
+      secondInvariantBound += deviatoricBound * deviatoricBound;
+    }
+    const real tauBound = std::sqrt(secondInvariantBound);
+
+    // Bound tau_c from below
+    const real taulimBound = plasticityData->cohesionTimesCosAngularFriction
+                             - meanCenter * plasticityData->sinAngularFriction
+                             - meanRadius * std::abs(plasticityData->sinAngularFriction);
+
+    // The nodal computation is subject to rounding errors, hence keep a margin relative to the magnitude of the stresses
+    const real margin = 16 * NumberOfPlasticityBasisFunctions * std::numeric_limits<real>::epsilon() * scale;
+    return tauBound + margin <= taulimBound;
+#endif
+  }
+
   unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
                                          double timeStepWidth,
                                          double T_v,
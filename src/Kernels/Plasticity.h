@@ -56,6 +56,7 @@ namespace seissol {
 class seissol::kernels::Plasticity {
 public:
   /** Returns 1 if there was plastic yielding otherwise 0.
+   *  Cells for which isBelowYieldSurface returns true may be skipped by the caller.
    */
   static unsigned computePlasticity( double                      oneMinusIntegratingFactor,
                                      double                      timeStepWidth,
@@ -65,6 +66,12 @@ public:
                                      real                        degreesOfFreedom[tensor::Q::size()],
                                      real*                       pstrain);
 
+  /** Returns true if a conservative bound of the stresses, computed from the modal degrees of freedom only,
+   *  guarantees that no node of the cell exceeds the yield criterion, i.e. computePlasticity would not change the cell.
+   */
+  static bool isBelowYieldSurface( PlasticityData const*       plasticityData,
+                                   real const                  degreesOfFreedom[tensor::Q::size()]);
+
   static unsigned computePlasticityBatched(double relaxTime,
                                            double timeStepWidth,
                                            double T_v,
@@ -0,0 +1,174 @@
+#ifndef KERNELS_TIMEBUFFERS_H_
+#define KERNELS_TIMEBUFFERS_H_
+
+#include <algorithm>
+#include <type_traits>
+
+#include <Initializer/typedefs.hpp>
+#include <generated_code/tensor.h>
+#include <yateto.h>
+
+namespace seissol::kernels {
+
+/**
+ * Storage of the time integrated DOFs which a cell provides to its face neighbors (the buffers of the LTS tree).
+ *
+ * With SINGLE_PRECISION_BUFFERS, the buffers are stored in single precision, while the DOFs and all kernels
+ * stay in double precision. The time integrated DOFs are rounded when the local integration writes
+ * them to a buffer, and converted back when the neighboring integration reads a buffer. This halves the memory
+ * traffic and the MPI messages of the buffers. The buffers keep the type real* in the LTS tree,
+ * hence they must only be accessed with the buffer functions below.
+ **/
+#ifdef SINGLE_PRECISION_BUFFERS
+using BufferReal = float;
+#else
+using BufferReal = real;
+#endif
+
+constexpr bool ReducedPrecisionBuffers = !std::is_same_v<BufferReal, real>;
+
+//! Number of reals which a buffer occupies in the LTS tree; rounded up such that the following buffers and derivatives stay aligned
+constexpr unsigned BufferSize =
+    ReducedPrecisionBuffers
+        ? (tensor::I::size() * sizeof(BufferReal) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT / sizeof(real)
+        : tensor::I::size();
+
+//! Overwrites the buffer with the time integrated DOFs
+inline void storeBuffer(const real* timeIntegrated, real* buffer) {
+  auto* bufferData = reinterpret_cast<BufferReal*>(buffer);
+#pragma omp simd
+  for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+    bufferData[dof] = static_cast<BufferReal>(timeIntegrated[dof]);
+  }
+}
+
+//! Adds the time integrated DOFs to the buffer
+inline void accumulateBuffer(const real* timeIntegrated, real* buffer) {
+  auto* bufferData = reinterpret_cast<BufferReal*>(buffer);
+#pragma omp simd
+  for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+    bufferData[dof] += static_cast<BufferReal>(timeIntegrated[dof]);
+  }
+}
+
+//! Converts the buffer to time integrated DOFs in working precision
+inline void loadBuffer(const real* buffer, real* timeIntegrated) {
+  const auto* bufferData = reinterpret_cast<const BufferReal*>(buffer);
+#pragma omp simd
+  for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+    timeIntegrated[dof] = static_cast<real>(bufferData[dof]);
+  }
+}
+
+/**
+ * Converts the buffers of the face neighbors (bits 0-3 of the LTS setup are zero) to working precision
+ * and replaces the pointers to them by pointers to the integration buffer. Does nothing if the buffers are stored in working precision.
+ *
+ * @param ltsSetup bitmask for the LTS setup.
+ * @param faceTypes face types of the neighboring cells.
+ * @param timeDofs pointers to time integrated buffers or time derivatives of the four neighboring cells.
+ * @param integrationBuffer memory for the converted buffers, which may be shared with TimeCommon::computeIntegrals. Ensure thread safety!
+ **/
+inline void loadNeighborBuffers(unsigned short ltsSetup,
+                                const FaceType faceTypes[4],
+                                real* timeDofs[4],
+                                real integrationBuffer[4][tensor::I::size()]) {
+  if constexpr (ReducedPrecisionBuffers) {
+    for (unsigned face = 0; face < 4; ++face) {
+      if (faceTypes[face] != FaceType::outflow && faceTypes[face] != FaceType::dynamicRupture
+          && (ltsSetup >> face) % 2 == 0) {
+        loadBuffer(timeDofs[face], integrationBuffer[face]);
+        timeDofs[face] = integrationBuffer[face];
+      }
+    }
+  }
+}
+
+/**
+ * Storage of the time derivatives which a cell provides to its face neighbors and dynamic rupture faces (the derivatives of the LTS tree).
+ *
+ * With SINGLE_PRECISION_DERIVATIVES=k, the derivatives dQ(k), dQ(k+1), ... are stored in single precision, while
+ * dQ(0), ..., dQ(k-1) keep the working precision and their layout. The higher derivatives are scaled with powers of
+ * the time step in the Taylor expansion, hence their rounding error is small compared to the one of the DOFs.
+ * The known zero blocks of the derivatives are already dropped by the sparsity patterns of the generated dQ tensors.
+ * Consumers of the derivatives in the LTS tree have to convert them with loadDerivatives, except for
+ * dQ(0), which is read directly by the fault and energy output.
+ **/
+#ifdef SINGLE_PRECISION_DERIVATIVES
+using DerivativeReal = float;
+constexpr unsigned FirstReducedDerivative = SINGLE_PRECISION_DERIVATIVES;
+static_assert(FirstReducedDerivative > 0, "dQ(0) has to be stored in working precision");
+#else
+using DerivativeReal = real;
+constexpr unsigned FirstReducedDerivative = yateto::numFamilyMembers<tensor::dQ>();
+#endif
+
+constexpr bool ReducedPrecisionDerivatives = !std::is_same_v<DerivativeReal, real>
+                                             && FirstReducedDerivative < yateto::numFamilyMembers<tensor::dQ>();
+
+//! Number of reals of the derivatives before the given derivative, i.e. the offset of dQ(derivative) in working precision
+constexpr unsigned derivativesOffset(unsigned derivative) {
+  unsigned offset = 0;
+  for (unsigned i = 0; i < derivative; ++i) {
+    offset += tensor::dQ::size(i);
+  }
+  return offset;
+}
+
+constexpr unsigned ReducedDerivativesOffset = derivativesOffset(FirstReducedDerivative);
+
+//! Number of reals which the derivatives of a cell occupy in the LTS tree
+constexpr unsigned DerivativesSize =
+    ReducedPrecisionDerivatives
+        ? ReducedDerivativesOffset
+              + ((yateto::computeFamilySize<tensor::dQ>() - ReducedDerivativesOffset) * sizeof(DerivativeReal) + ALIGNMENT - 1)
+                    / ALIGNMENT * ALIGNMENT / sizeof(real)
+        : yateto::computeFamilySize<tensor::dQ>();
+
+//! Overwrites the stored derivatives with derivatives in working precision
+inline void storeDerivatives(const real* derivatives, real* stored) {
+  std::copy_n(derivatives, ReducedDerivativesOffset, stored);
+  auto* reduced = reinterpret_cast<DerivativeReal*>(stored + ReducedDerivativesOffset);
+#pragma omp simd
+  for (unsigned i = ReducedDerivativesOffset; i < yateto::computeFamilySize<tensor::dQ>(); ++i) {
+    reduced[i - ReducedDerivativesOffset] = static_cast<DerivativeReal>(derivatives[i]);
+  }
+}
+
+//! Converts the stored derivatives to derivatives in working precision
+inline void loadDerivatives(const real* stored, real* derivatives) {
+  std::copy_n(stored, ReducedDerivativesOffset, derivatives);
+  const auto* reduced = reinterpret_cast<const DerivativeReal*>(stored + ReducedDerivativesOffset);
+#pragma omp simd
+  for (unsigned i = ReducedDerivativesOffset; i < yateto::computeFamilySize<tensor::dQ>(); ++i) {
+    derivatives[i] = static_cast<real>(reduced[i - ReducedDerivativesOffset]);
+  }
+}
+
+/**
+ * Converts the derivatives of the face neighbors (bits 0-3 of the LTS setup are set) to working precision
+ * and replaces the pointers to them. Does nothing if the derivatives are stored in working precision.
+ *
+ * @param ltsSetup bitmask for the LTS setup.
+ * @param faceTypes face types of the neighboring cells.
+ * @param timeDofs pointers to time integrated buffers or time derivatives of the four neighboring cells.
+ * @param derivativesBuffer memory for the converted derivatives. Ensure thread safety!
+ **/
+inline void loadNeighborDerivatives(unsigned short ltsSetup,
+                                    const FaceType faceTypes[4],
+                                    real* timeDofs[4],
+                                    real (*derivativesBuffer)[yateto::computeFamilySize<tensor::dQ>()]) {
+  if constexpr (ReducedPrecisionDerivatives) {
+    for (unsigned face = 0; face < 4; ++face) {
+      if (faceTypes[face] != FaceType::outflow && faceTypes[face] != FaceType::dynamicRupture
+          && (ltsSetup >> face) % 2 == 1) {
+        loadDerivatives(timeDofs[face], derivativesBuffer[face]);
+        timeDofs[face] = derivativesBuffer[face];
+      }
+    }
+  }
+}
+
+} // namespace seissol::kernels
+
+#endif // KERNELS_TIMEBUFFERS_H_
@@ -101,6 +101,22 @@ namespace seissol {
                             real o_integrationBuffer[4][tensor::I::size()],
                             real * o_timeIntegrated[4]);
 
+      /**
+       * Checks if all faces of the cell are regular or periodic and all face neighbors provide time integrated buffers (bits 0-3 of the LTS setup are zero).
+       * The face neighbors of such a cell can be used without integration, and its local and neighboring integrals consist of the flux kernels only.
+       * The interior of a time cluster is sorted such that these cells are contiguous, see LtsLayout::sortClusteredInterior.
+       *
+       * @param i_cellInformation cell local information.
+       **/
+      inline bool isRegularGtsCell(const CellLocalInformation& i_cellInformation) {
+        for (const auto faceType : i_cellInformation.faceTypes) {
+          if (faceType != FaceType::regular && faceType != FaceType::periodic) {
+            return false;
+          }
+        }
+        return (i_cellInformation.ltsSetup & 0xF) == 0;
+      }
+
       void computeBatchedIntegrals(Time& i_time,
                                    const double i_timeStepStart,
                                    const double i_timeStepWidth,
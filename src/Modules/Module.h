@@ -66,6 +66,9 @@ private:
   /** The last time when syncPoint was called */
 	double m_lastSyncPoint;
 
+	/** The maximal deviation of a synchronization point from the regular interval */
+	double m_syncWindow;
+
 public:
 	/**
 	 * Possible priorites for modules
@@ -88,26 +91,55 @@ public:
 
 public:
 	Module()
-		: m_syncInterval(0), m_nextSyncPoint(0), m_lastSyncPoint(-std::numeric_limits<double>::infinity())
+		: m_syncInterval(0), m_nextSyncPoint(0), m_lastSyncPoint(-std::numeric_limits<double>::infinity()),
+		  m_syncWindow(0)
 	{ }
 
 	/**
 	 * Called by {@link Modules} at every synchronization point
 	 *
 	 * We have to ensure that this is "our" synchronization point before
-	 * calling {@link syncPoint}.
+	 * calling {@link syncPoint}. A synchronization point within the window of the
+	 * next regular synchronization point is accepted, such that other modules can
+	 * share it. The regular interval is not shifted by this.
 	 *
-	 * @return The next synchronization point for this module
+	 * @return The next regular synchronization point for this module
 	 */
 	double potentialSyncPoint(double currentTime, double timeTolerance, bool forceSyncPoint)
 	{
     if (std::abs(currentTime - m_lastSyncPoint) < timeTolerance) {
       int const rank = seissol::MPI::mpi.rank();
       logInfo(rank) << "Ignoring duplicate synchronisation point at time" << currentTime << "; the last sync point was at " << m_lastSyncPoint;
-    } else if (forceSyncPoint || std::abs(currentTime - m_nextSyncPoint) < timeTolerance) {
+    } else if (forceSyncPoint || std::abs(currentTime - m_nextSyncPoint) < m_syncWindow + timeTolerance) {
 			syncPoint(currentTime);
       m_lastSyncPoint = currentTime;
 			m_nextSyncPoint += m_syncInterval;
+			syncPointScheduled(m_nextSyncPoint);
+		}
+
+		return m_nextSyncPoint;
+	}
+
+	/**
+	 * Called by {@link Modules} during the time stepping for modules which do not
+	 * require synchronized clusters (see {@link requiresSynchronizedClusters}).
+	 *
+	 * The synchronization point is passed once all local clusters are beyond it, i.e. the
+	 * clusters have finished all time steps which start before it. If the clusters passed
+	 * several synchronization points at once, each of them is called once, in order.
+	 *
+	 * @param currentTime The time which all local clusters have reached
+	 * @return The next synchronization point for this module
+	 */
+	double passedSyncPoint(double currentTime, double timeTolerance)
+	{
+		if (currentTime > m_nextSyncPoint + timeTolerance) {
+			while (currentTime > m_nextSyncPoint + timeTolerance) {
+				syncPoint(m_nextSyncPoint);
+				m_lastSyncPoint = m_nextSyncPoint;
+				m_nextSyncPoint += m_syncInterval;
+			}
+			syncPointScheduled(m_nextSyncPoint);
 		}
 
 		return m_nextSyncPoint;
@@ -117,12 +149,34 @@ public:
 	 * Called by {@link Modules} before the simulation starts to set the synchronization point.
 	 *
 	 * This is only called for modules that register for the SYNCHRONIZATION_POINT hook.
+	 *
+	 * @param syncWindowFraction The allowed deviation of the synchronization points
+	 *  relative to the synchronization interval, has to be less than 0.5
 	 */
-	void setSimulationStartTime(double time)
+	void setSimulationStartTime(double time, double syncWindowFraction = 0)
 	{
 		assert(m_syncInterval > 0);
+		assert(syncWindowFraction >= 0 && syncWindowFraction < 0.5);
+		m_syncWindow = syncWindowFraction * m_syncInterval;
 		m_lastSyncPoint = time;
 		m_nextSyncPoint = time + m_syncInterval;
+		syncPointScheduled(m_nextSyncPoint);
+	}
+
+	/**
+	 * @return The next regular synchronization point
+	 */
+	double nextSyncPoint() const
+	{
+		return m_nextSyncPoint;
+	}
+
+	/**
+	 * @return The maximal deviation of a synchronization point from the regular one
+	 */
+	double syncWindow() const
+	{
+		return m_syncWindow;
 	}
 
 	//
@@ -201,6 +255,25 @@ public:
 	{
 	}
 
+	/**
+	 * Called whenever the next synchronization point of this module has been determined
+	 */
+	virtual void syncPointScheduled(double nextSyncPoint)
+	{
+	}
+
+	/**
+	 * Returns true if {@link syncPoint} reads the state of the time clusters, such that all clusters
+	 * have to stop at the synchronization point.
+	 *
+	 * Otherwise, {@link syncPoint} is called between two cluster updates as soon as all local clusters
+	 * passed the synchronization point, e.g. to flush data which was recorded during the time steps.
+	 */
+	virtual bool requiresSynchronizedClusters() const
+	{
+		return true;
+	}
+
 protected:
   double syncInterval() const {
     return m_syncInterval;
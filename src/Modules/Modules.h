@@ -45,10 +45,13 @@
 #include <limits>
 #include <map>
 #include <utility>
+#include <vector>
 
+#include "utils/env.h"
 #include "utils/logger.h"
 
 #include "Module.h"
+#include "SyncPointPlanning.h"
 
 namespace seissol
 {
@@ -98,14 +101,26 @@ enum Hook
 class Modules
 {
 private:
+	/**
+	 * Upper bound for the window of the synchronization points.
+	 * Windows of consecutive synchronization points of a module must not overlap.
+	 */
+	static constexpr double MaxSyncWindowFraction = 0.25;
+
 	std::multimap<int, Module*> m_hooks[MAX_HOOKS];
 
 	/** The hook that should be called next */
 	Hook m_nextHook;
 
+	/** The allowed deviation of synchronization points relative to the interval of a module */
+	double m_syncWindowFraction;
+
+	/** Number of synchronization points which were saved by sharing them between modules */
+	unsigned long m_coalescedSyncPoints;
+
 private:
 	Modules()
-		: m_nextHook(FIRST_HOOK)
+		: m_nextHook(FIRST_HOOK), m_syncWindowFraction(0), m_coalescedSyncPoints(0)
 	{
 	}
 
@@ -128,13 +143,54 @@ private:
 		m_nextHook = static_cast<Hook>(hook + 1);
 	}
 
-	double _callSyncHook(double currentTime, double timeTolerance, bool forceSyncPoint)
+	/**
+	 * Calls the modules whose window contains the current time and plans the next synchronization point,
+	 * see {@link modules::planSyncPoint}.
+	 *
+	 * @param fixedSyncPoint The next synchronization point which is not a module, i.e. the next checkpoint
+	 */
+	double _callSyncHook(double currentTime, double timeTolerance, bool forceSyncPoint, double fixedSyncPoint)
+	{
+		// The regular synchronization points of the modules called at this synchronization point
+		std::vector<double> regularSyncPoints;
+
+		for (std::multimap<int, Module*>::iterator it = m_hooks[SYNCHRONIZATION_POINT].begin();
+				it != m_hooks[SYNCHRONIZATION_POINT].end(); it++) {
+			// Modules without synchronized clusters are called from the time stepping, except for the final call
+			if (!forceSyncPoint && !it->second->requiresSynchronizedClusters())
+				continue;
+			double const regularSyncPoint = it->second->nextSyncPoint();
+			if (it->second->potentialSyncPoint(currentTime, timeTolerance, forceSyncPoint) != regularSyncPoint)
+				regularSyncPoints.push_back(regularSyncPoint);
+		}
+
+		if (forceSyncPoint) {
+			if (m_syncWindowFraction > 0)
+				logInfo(seissol::MPI::mpi.rank()) << "Sharing synchronization points between modules saved"
+					<< m_coalescedSyncPoints << "synchronizations.";
+		} else {
+			m_coalescedSyncPoints += modules::countSavedSyncPoints(regularSyncPoints, timeTolerance);
+		}
+
+		std::vector<modules::SyncWindow> windows;
+		for (std::multimap<int, Module*>::iterator it = m_hooks[SYNCHRONIZATION_POINT].begin();
+				it != m_hooks[SYNCHRONIZATION_POINT].end(); it++) {
+			if (it->second->requiresSynchronizedClusters())
+				windows.push_back({it->second->nextSyncPoint(), it->second->syncWindow()});
+		}
+
+		return modules::planSyncPoint(windows, fixedSyncPoint);
+	}
+
+	double _callPassiveSyncHook(double currentTime, double timeTolerance)
 	{
 		double nextSyncTime = std::numeric_limits<double>::max();
 
 		for (std::multimap<int, Module*>::iterator it = m_hooks[SYNCHRONIZATION_POINT].begin();
 				it != m_hooks[SYNCHRONIZATION_POINT].end(); it++) {
-			nextSyncTime = std::min(nextSyncTime, it->second->potentialSyncPoint(currentTime, timeTolerance, forceSyncPoint));
+			if (it->second->requiresSynchronizedClusters())
+				continue;
+			nextSyncTime = std::min(nextSyncTime, it->second->passedSyncPoint(currentTime, timeTolerance));
 		}
 
 		return nextSyncTime;
@@ -150,10 +206,17 @@ private:
 	{
 		assert(m_nextHook <= SYNCHRONIZATION_POINT);
 
+		m_syncWindowFraction = utils::Env::get<double>("SEISSOL_SYNC_POINT_WINDOW", 0.0);
+		if (m_syncWindowFraction < 0 || m_syncWindowFraction > MaxSyncWindowFraction) {
+			logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_SYNC_POINT_WINDOW has to be in [0," << MaxSyncWindowFraction
+				<< "], using" << std::clamp(m_syncWindowFraction, 0.0, MaxSyncWindowFraction);
+			m_syncWindowFraction = std::clamp(m_syncWindowFraction, 0.0, MaxSyncWindowFraction);
+		}
+
 		// Set the simulation time in all modules that are called at synchronization points
 		for (std::multimap<int, Module*>::iterator it = m_hooks[SYNCHRONIZATION_POINT].begin();
 				it != m_hooks[SYNCHRONIZATION_POINT].end(); it++) {
-			it->second->setSimulationStartTime(time);
+			it->second->setSimulationStartTime(time, m_syncWindowFraction);
 		}
 	}
 
@@ -190,13 +253,28 @@ public:
 	/**
 	 * @param currentTime The current simulation time.
 	 * @param timeTolerance The time tolerance for time comparison
+	 * @param fixedSyncPoint The next checkpoint time, which is shared by the modules whose window contains it
 	 * @return The next synchronization point
 	 *
 	 * @todo The time tolerance is global constant, maybe not necessary to pass it here
 	 */
-	static double callSyncHook(double currentTime, double timeTolerance, bool forceSyncPoint = false)
+	static double callSyncHook(double currentTime, double timeTolerance, bool forceSyncPoint = false,
+			double fixedSyncPoint = std::numeric_limits<double>::max())
+	{
+		return instance()._callSyncHook(currentTime, timeTolerance, forceSyncPoint, fixedSyncPoint);
+	}
+
+	/**
+	 * Calls the synchronization point of all modules which do not require synchronized clusters
+	 * and whose synchronization point was passed.
+	 *
+	 * @param currentTime The time which all local clusters have reached
+	 * @param timeTolerance The time tolerance for time comparison
+	 * @return The next synchronization point of these modules
+	 */
+	static double callPassiveSyncHook(double currentTime, double timeTolerance)
 	{
-		return instance()._callSyncHook(currentTime, timeTolerance, forceSyncPoint);
+		return instance()._callPassiveSyncHook(currentTime, timeTolerance);
 	}
 
 	/**
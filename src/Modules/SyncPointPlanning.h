@@ -0,0 +1,72 @@
+#ifndef SEISSOL_SYNCPOINTPLANNING_H
+#define SEISSOL_SYNCPOINTPLANNING_H
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace seissol::modules {
+
+/**
+ * The next regular synchronization point of a module and the maximal deviation from it
+ */
+struct SyncWindow {
+  double regularSyncPoint;
+  double window;
+};
+
+/**
+ * Plans the next synchronization point such that it is shared by as many modules as possible.
+ *
+ * The synchronization point has to be within the window with the earliest end. All windows
+ * which contain this end share the synchronization point, which is placed as close as possible
+ * to their regular synchronization points.
+ * The fixed synchronization point, e.g. the next checkpoint, is taken exactly if it is not after
+ * the earliest window end; all windows which contain it share it.
+ *
+ * @return The next synchronization point, std::numeric_limits<double>::max() if there is none
+ */
+inline double planSyncPoint(const std::vector<SyncWindow>& windows,
+                            double fixedSyncPoint = std::numeric_limits<double>::max()) {
+  double windowEnd = fixedSyncPoint;
+  for (const auto& window : windows) {
+    windowEnd = std::min(windowEnd, window.regularSyncPoint + window.window);
+  }
+
+  double windowStart = -std::numeric_limits<double>::max();
+  double earliestRegularSyncPoint = std::numeric_limits<double>::max();
+  if (fixedSyncPoint <= windowEnd) {
+    // the fixed synchronization point has no window, hence it determines the synchronization point
+    windowStart = fixedSyncPoint;
+    earliestRegularSyncPoint = fixedSyncPoint;
+  }
+  for (const auto& window : windows) {
+    if (window.regularSyncPoint - window.window <= windowEnd) {
+      windowStart = std::max(windowStart, window.regularSyncPoint - window.window);
+      earliestRegularSyncPoint = std::min(earliestRegularSyncPoint, window.regularSyncPoint);
+    }
+  }
+
+  return std::min(windowEnd, std::max(windowStart, earliestRegularSyncPoint));
+}
+
+/**
+ * Counts the synchronizations which are saved by calling modules with the given regular
+ * synchronization points at a single synchronization point.
+ *
+ * Without windows, every distinct regular synchronization point requires its own synchronization.
+ */
+inline unsigned long countSavedSyncPoints(std::vector<double> regularSyncPoints, double timeTolerance) {
+  std::sort(regularSyncPoints.begin(), regularSyncPoints.end());
+  unsigned long savedSyncPoints = 0;
+  for (std::size_t i = 1; i < regularSyncPoints.size(); ++i) {
+    if (regularSyncPoints[i] - regularSyncPoints[i - 1] >= timeTolerance) {
+      ++savedSyncPoints;
+    }
+  }
+  return savedSyncPoints;
+}
+
+} // namespace seissol::modules
+
+#endif // SEISSOL_SYNCPOINTPLANNING_H
@@ -164,42 +164,52 @@ void FlopCounter::printPerformanceSummary(double wallTime) {
 }
 void FlopCounter::incrementNonZeroFlopsLocal(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   nonZeroFlopsLocal += update;
 }
 void FlopCounter::incrementHardwareFlopsLocal(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   hardwareFlopsLocal += update;
 }
 void FlopCounter::incrementNonZeroFlopsNeighbor(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   nonZeroFlopsNeighbor += update;
 }
 void FlopCounter::incrementHardwareFlopsNeighbor(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   hardwareFlopsNeighbor += update;
 }
 void FlopCounter::incrementNonZeroFlopsOther(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   nonZeroFlopsOther += update;
 }
 void FlopCounter::incrementHardwareFlopsOther(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   hardwareFlopsOther += update;
 }
 void FlopCounter::incrementNonZeroFlopsDynamicRupture(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   nonZeroFlopsDynamicRupture += update;
 }
 void FlopCounter::incrementHardwareFlopsDynamicRupture(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   hardwareFlopsDynamicRupture += update;
 }
 void FlopCounter::incrementNonZeroFlopsPlasticity(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   nonZeroFlopsPlasticity += update;
 }
 void FlopCounter::incrementHardwareFlopsPlasticity(long long update) {
   assert(update >= 0);
+  #pragma omp atomic
   hardwareFlopsPlasticity += update;
 }
 }
@@ -42,6 +42,7 @@
 #include <cmath>
 #include <cstdint>
 #include <cstddef>
+#include <numeric>
 #ifdef USE_NETCDF
 #include <netcdf.h>
 #ifdef USE_MPI
@@ -53,8 +54,18 @@
 #include "Monitoring/Stopwatch.h"
 #include <utils/env.h>
 
+void seissol::LoopStatistics::mergeSamples() {
+  for (unsigned region = 0; region < m_times.size(); ++region) {
+    for (auto& samples : m_threadTimes[region]) {
+      m_times[region].insert(m_times[region].end(), samples.begin(), samples.end());
+      samples.clear();
+    }
+  }
+}
+
 #ifdef USE_MPI  
 void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
+  mergeSamples();
   const auto nRegions = m_times.size();
   constexpr int numberOfSumComponents = 5;
   auto sums = std::vector<double>(numberOfSumComponents * nRegions);
@@ -121,6 +132,7 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
   MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm);
 
   auto regressionCoeffs = std::vector<double>(2*nRegions);
+  m_costs.resize(nRegions);
   auto stderror = std::vector<double>(nRegions, 0.0);
   for (unsigned region = 0; region < nRegions; ++region) {
     const double x = getNumIters(region);
@@ -134,6 +146,7 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
     double const slope = (-x*y + N*xy) / det;
     regressionCoeffs[2 * region + 0] = constant;
     regressionCoeffs[2 * region + 1] = slope;
+    m_costs[region] = Cost{constant, slope};
 
     for (auto const& sample : m_times[region]) {
       if (sample.numIters > 0) {
@@ -159,6 +172,10 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
       const double x2 = getNumItersSquared(region);
       const double y = getTime(region);
       const double N = getNumberOfSamples(region);
+      if (N == 0) {
+        // e.g. the plasticity without plastic material
+        continue;
+      }
 
       double const xm = x / N;
       double const xv = x2 - 2*x*xm + xm*xm;
@@ -180,9 +197,33 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
     logInfo(rank) << "Total time spent in Dynamic Rupture iteration:"
                   << getTime(getRegion("computeDynamicRupture"));
   }
+
+  for (auto& counts : m_histograms) {
+    MPI_Allreduce(MPI_IN_PLACE, counts.data(), counts.size(), MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+  }
+  printHistograms(rank);
 }
 #endif
 
+void seissol::LoopStatistics::printHistograms(int rank) const {
+  if (rank != 0) {
+    return;
+  }
+  for (unsigned histogram = 0; histogram < m_histograms.size(); ++histogram) {
+    const auto& counts = m_histograms[histogram];
+    const auto total = std::accumulate(counts.begin(), counts.end(), 0ULL);
+    if (total > 0) {
+      logInfo(rank) << "Histogram of" << m_histogramNames[histogram] << "(total:" << total << "):";
+      for (unsigned bin = 0; bin < counts.size(); ++bin) {
+        if (counts[bin] > 0) {
+          logInfo(rank) << m_histogramNames[histogram] << "[" << bin << "]:" << counts[bin]
+                        << "(" << 100.0 * counts[bin] / total << "%)";
+        }
+      }
+    }
+  }
+}
+
 #ifdef USE_NETCDF
 static void check_err(const int stat, const int line, const char *file) {
   if (stat != NC_NOERR) {
@@ -211,7 +252,25 @@ nc_type type2nc() {
 }
 #endif
   
+void seissol::LoopStatistics::writeCosts(const std::string& fileName) const {
+  if (m_costs.empty()) {
+    return;
+  }
+  std::ofstream file(fileName);
+  file << "region,constant,perElement" << std::endl;
+  file << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (unsigned region = 0; region < m_costs.size(); ++region) {
+    // Regions without samples have no regression
+    if (m_includeInSummary[region] && std::isfinite(m_costs[region].constant) &&
+        std::isfinite(m_costs[region].perElement)) {
+      file << m_regions[region] << "," << m_costs[region].constant << "," << m_costs[region].perElement
+           << std::endl;
+    }
+  }
+}
+
 void seissol::LoopStatistics::writeSamples(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn) {
+  mergeSamples();
   if (isLoopStatisticsNetcdfOutputOn) {
     const auto loopStatFile = outputPrefix + "-loopStat-";
     const auto rank = MPI::mpi.rank();
@@ -42,9 +42,10 @@
 
 #include <cassert>
 #include <algorithm>
-#include <unordered_map>
 #include <fstream>
 #include <iomanip>
+#include <limits>
+#include <mutex>
 #include <time.h>
 #include <vector>
 
@@ -52,13 +53,23 @@
 #include <mpi.h>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace seissol {
 class LoopStatistics {
 public:
   void addRegion(std::string const& name, bool includeInSummary = true) {
+#ifdef _OPENMP
+    const auto numberOfThreads = static_cast<unsigned>(omp_get_max_threads());
+#else
+    const auto numberOfThreads = 1U;
+#endif
     m_regions.push_back(name);
-    m_begin.push_back(timespec{});
+    m_begin.emplace_back(numberOfThreads);
     m_times.emplace_back();
+    m_threadTimes.emplace_back(numberOfThreads);
     m_includeInSummary.push_back(includeInSummary);
   }
   
@@ -69,17 +80,20 @@ public:
     return std::distance(first, it);
   }
   
+  // begin/end may be called concurrently by time clusters running on different threads of
+  // the outer parallel region, hence begin times and samples are stored per OpenMP thread.
   void begin(unsigned region) {
-    clock_gettime(CLOCK_MONOTONIC, &m_begin[region]);
+    clock_gettime(CLOCK_MONOTONIC, &m_begin[region][threadSlot(region)]);
   }
   
   void end(unsigned region, unsigned numIterations, unsigned subRegion) {
     Sample sample;
     clock_gettime(CLOCK_MONOTONIC, &sample.end);
-    sample.begin = m_begin[region];
+    const auto slot = threadSlot(region);
+    sample.begin = m_begin[region][slot];
     sample.numIters = numIterations;
     sample.subRegion = subRegion;
-    m_times[region].push_back(sample);
+    m_threadTimes[region][slot].push_back(sample);
   }
 
   void addSample(unsigned region, unsigned numIters, unsigned subRegion,
@@ -89,14 +103,47 @@ public:
     sample.end = std::move(end);
     sample.numIters = numIters;
     sample.subRegion = subRegion;
-    m_times[region].push_back(sample);
+    m_threadTimes[region][threadSlot(region)].push_back(sample);
+  }
+
+  //! Histograms count events per bin, e.g. iteration counts of a solver, and are summed over all ranks.
+  //! Adding a histogram whose name exists already returns the existing histogram.
+  unsigned addHistogram(std::string const& name, unsigned numberOfBins) {
+    std::lock_guard lock(m_mutex);
+    auto first = m_histogramNames.cbegin();
+    auto it = std::find(first, m_histogramNames.cend(), name);
+    if (it != m_histogramNames.cend()) {
+      assert(m_histograms[std::distance(first, it)].size() == numberOfBins);
+      return std::distance(first, it);
+    }
+    m_histogramNames.push_back(name);
+    m_histograms.emplace_back(numberOfBins, 0);
+    return m_histograms.size() - 1;
+  }
+
+  unsigned getHistogram(std::string const& name) {
+    auto first = m_histogramNames.cbegin();
+    auto it = std::find(first, m_histogramNames.cend(), name);
+    assert(it != m_histogramNames.end());
+    return std::distance(first, it);
+  }
+
+  void addToHistogram(unsigned histogram, unsigned bin, unsigned long long count) {
+    std::lock_guard lock(m_mutex);
+    m_histograms[histogram][bin] += count;
   }
 
 #ifdef USE_MPI  
   void printSummary(MPI_Comm comm);
 #endif
 
+  //! Prints the histograms; printSummary sums them over all ranks and prints them
+  void printHistograms(int rank) const;
+
   void writeSamples(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn);
+
+  //! Writes the regression of printSummary as CSV, one line per region
+  void writeCosts(const std::string& fileName) const;
   
 private:
   struct Sample {
@@ -105,11 +152,39 @@ private:
     unsigned numIters;
     unsigned subRegion;
   };
+
+  //! Global linear regression of the time of a region over the number of iterations
+  struct Cost {
+    double constant;
+    double perElement;
+  };
+  
+  unsigned threadSlot(unsigned region) const {
+#ifdef _OPENMP
+    // Only called outside of nested parallel regions, hence the thread number is unique
+    assert(omp_get_level() <= 1);
+    const auto slot = static_cast<unsigned>(omp_get_thread_num());
+#else
+    const auto slot = 0U;
+#endif
+    assert(slot < m_threadTimes[region].size());
+    return slot;
+  }
+
+  //! Moves the samples of all threads to m_times
+  void mergeSamples();
   
-  std::vector<timespec> m_begin;
+  //! Guards the histograms
+  std::mutex m_mutex;
+  std::vector<std::vector<timespec>> m_begin;
   std::vector<std::string> m_regions;
   std::vector<std::vector<Sample>> m_times;
+  std::vector<std::vector<std::vector<Sample>>> m_threadTimes;
   std::vector<bool> m_includeInSummary;
+  std::vector<std::string> m_histogramNames;
+  std::vector<std::vector<unsigned long long>> m_histograms;
+  //! Computed by printSummary
+  std::vector<Cost> m_costs;
 };
 }
 
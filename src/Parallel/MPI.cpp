@@ -39,6 +39,7 @@
  */
 
 #include "MPI.h"
+#include "utils/env.h"
 #include "utils/stringutils.h"
 #include <unistd.h>
 #include <cstdlib>
@@ -124,4 +125,20 @@ void seissol::MPI::setDataTransferModeFromEnv() {
   }
 }
 
+void seissol::MPI::setPersistentRequestsFromEnv() {
+  setPersistentRequests(utils::Env::get<bool>("SEISSOL_MPI_PERSISTENT_REQUESTS", false));
+}
+
+void seissol::MPI::setPersistentRequests(bool requested) {
+  persistentRequests = requested;
+  if (persistentRequests && preferredDataTransferMode != DataTransferMode::Direct) {
+    logWarning(m_rank) << "Persistent MPI requests are only supported "
+                       << "with the `direct` MPI transfer mode.";
+    persistentRequests = false;
+  }
+  if (persistentRequests) {
+    logInfo(m_rank) << "Using persistent MPI requests for the copy and ghost layer exchange";
+  }
+}
+
 seissol::MPI seissol::MPI::mpi;
@@ -266,6 +266,20 @@ class MPI : public MPIBasic {
 
   enum class DataTransferMode { Direct, CopyInCopyOutDevice, CopyInCopyOutHost };
   DataTransferMode getPreferredDataTransferMode() { return preferredDataTransferMode; }
+  void setPreferredDataTransferMode(DataTransferMode mode) { preferredDataTransferMode = mode; }
+
+  void setPersistentRequestsFromEnv();
+
+  /**
+   * Uses persistent requests if requested and supported by the preferred data transfer mode.
+   * Call after the data transfer mode is set.
+   */
+  void setPersistentRequests(bool requested);
+
+  /**
+   * @return true if the copy/ghost layer exchange uses persistent requests
+   */
+  bool usePersistentRequests() const { return persistentRequests; }
 
   /** The only instance of the class */
   static MPI mpi;
@@ -275,6 +289,7 @@ class MPI : public MPIBasic {
   MPI_Comm m_sharedMemComm;
   MPI() : m_comm(MPI_COMM_NULL) {}
   DataTransferMode preferredDataTransferMode{DataTransferMode::Direct};
+  bool persistentRequests{false};
   std::vector<std::string> hostNames{};
 };
 
@@ -0,0 +1,37 @@
+#include "PersistentRequests.h"
+
+#ifdef USE_MPI
+namespace seissol::parallel {
+
+void initPersistentRequests(MeshStructure& meshStructure, int tagOffset, MPI_Comm comm) {
+  for (unsigned region = 0; region < meshStructure.numberOfRegions; ++region) {
+    MPI_Send_init(meshStructure.copyRegions[region],
+                  static_cast<int>(meshStructure.copyRegionSizes[region]),
+                  MPI_C_REAL,
+                  meshStructure.neighboringClusters[region][0],
+                  tagOffset + meshStructure.sendIdentifiers[region],
+                  comm,
+                  meshStructure.sendRequests + region);
+    MPI_Recv_init(meshStructure.ghostRegions[region],
+                  static_cast<int>(meshStructure.ghostRegionSizes[region]),
+                  MPI_C_REAL,
+                  meshStructure.neighboringClusters[region][0],
+                  tagOffset + meshStructure.receiveIdentifiers[region],
+                  comm,
+                  meshStructure.receiveRequests + region);
+  }
+}
+
+void freePersistentRequests(MeshStructure& meshStructure) {
+  for (unsigned region = 0; region < meshStructure.numberOfRegions; ++region) {
+    if (meshStructure.sendRequests[region] != MPI_REQUEST_NULL) {
+      MPI_Request_free(meshStructure.sendRequests + region);
+    }
+    if (meshStructure.receiveRequests[region] != MPI_REQUEST_NULL) {
+      MPI_Request_free(meshStructure.receiveRequests + region);
+    }
+  }
+}
+
+} // namespace seissol::parallel
+#endif // USE_MPI
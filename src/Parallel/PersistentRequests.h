@@ -0,0 +1,28 @@
+#ifndef SEISSOL_PERSISTENTREQUESTS_H
+#define SEISSOL_PERSISTENTREQUESTS_H
+
+#ifdef USE_MPI
+#include <mpi.h>
+
+#include "Initializer/typedefs.hpp"
+
+namespace seissol::parallel {
+
+/**
+ * Sets up one persistent send request per copy region and one persistent receive request per ghost
+ * region of a time cluster. Buffers, sizes, ranks and tags of the regions never change, such that
+ * the exchange only has to start the requests.
+ **/
+void initPersistentRequests(MeshStructure& meshStructure, int tagOffset, MPI_Comm comm);
+
+/**
+ * Frees the persistent requests of a time cluster and resets them to MPI_REQUEST_NULL.
+ * The requests must not be active, i.e. the last exchange has to be completed.
+ **/
+void freePersistentRequests(MeshStructure& meshStructure);
+
+} // namespace seissol::parallel
+
+#endif // USE_MPI
+
+#endif // SEISSOL_PERSISTENTREQUESTS_H
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <array>
 #include <numeric>
@@ -72,21 +73,80 @@ void seissol::physics::Planarwave::init(const CellMaterialData& materialData) {
   m_eigenvectors = eigendecomposition.vectors;
 }
 
+void seissol::physics::InitialField::evaluateBatch(const double* times,
+                                                   std::size_t numberOfTimes,
+                                                   PointsView points,
+                                                   const CellMaterialData& materialData,
+                                                   yateto::DenseTensorView<2,real,unsigned>* dofsQP) const {
+  for (std::size_t t = 0; t < numberOfTimes; ++t) {
+    evaluate(times[t], points, materialData, dofsQP[t]);
+  }
+}
+
 void seissol::physics::Planarwave::evaluate(double time,
-                                            std::vector<std::array<double, 3>> const& points,
+                                            PointsView points,
 					    const CellMaterialData& materialData,
                                             yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const
 {
-  dofsQP.setZero();
+  evaluateBatch(&time, 1, points, materialData, &dofsQP);
+}
+
+void seissol::physics::Planarwave::evaluateBatch(const double* times,
+                                                 std::size_t numberOfTimes,
+                                                 PointsView points,
+                                                 const CellMaterialData& materialData,
+                                                 yateto::DenseTensorView<2,real,unsigned>* dofsQP) const {
+  for (std::size_t t = 0; t < numberOfTimes; ++t) {
+    dofsQP[t].setZero();
+  }
+  addWave(times, numberOfTimes, points, {0.0, 0.0, 0.0}, false, dofsQP);
+}
+
+void seissol::physics::Planarwave::accumulateBatch(const double* times,
+                                                   std::size_t numberOfTimes,
+                                                   PointsView points,
+                                                   yateto::DenseTensorView<2,real,unsigned>* dofsQP) const {
+  addWave(times, numberOfTimes, points, {0.0, 0.0, 0.0}, false, dofsQP);
+}
+
+void seissol::physics::Planarwave::addWave(const double* times,
+                                           std::size_t numberOfTimes,
+                                           PointsView points,
+                                           const std::array<double, 3>& origin,
+                                           bool restrictToWavefront,
+                                           yateto::DenseTensorView<2,real,unsigned>* dofsQP) const {
+  // exp(i (omega t - k (x - o) + phase)) is split into a temporal and a spatial factor,
+  // such that the exponential is evaluated once per point instead of once per point, time and quantity.
+  constexpr std::size_t ChunkSize = 64;
+  double spatialPhase[ChunkSize];
+  std::complex<double> spatialFactor[ChunkSize];
 
   auto R = yateto::DenseTensorView<2,std::complex<double>>(const_cast<std::complex<double>*>(m_eigenvectors.data()), {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
   for (unsigned v = 0; v < m_varField.size(); ++v) {
     const auto omega =  m_lambdaA[m_varField[v]];
-    for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        dofsQP(i,j) += (R(j, m_varField[v]) * m_ampField[v] *
-                        std::exp(std::complex<double>(0.0, 1.0) * (
-                          omega * time - m_kVec[0]*points[i][0] - m_kVec[1]*points[i][1] - m_kVec[2]*points[i][2] + std::complex<double>(m_phase, 0)))).real();
+    for (std::size_t chunkStart = 0; chunkStart < points.size(); chunkStart += ChunkSize) {
+      const std::size_t chunkSize = std::min(ChunkSize, points.size() - chunkStart);
+      for (std::size_t i = 0; i < chunkSize; ++i) {
+        const auto& x = points[chunkStart + i];
+        spatialPhase[i] = m_phase
+                        - m_kVec[0]*(x[0] - origin[0])
+                        - m_kVec[1]*(x[1] - origin[1])
+                        - m_kVec[2]*(x[2] - origin[2]);
+        spatialFactor[i] = m_ampField[v] * std::exp(std::complex<double>(0.0, spatialPhase[i]));
+      }
+      for (std::size_t t = 0; t < numberOfTimes; ++t) {
+        const auto temporalFactor = std::exp(std::complex<double>(0.0, 1.0) * omega * times[t]);
+        // the imaginary part of the argument of the exponential, which locates the point relative to the wave front
+        const double temporalPhase = omega.real() * times[t];
+        for (unsigned j = 0; j < dofsQP[t].shape(1); ++j) {
+          const auto eigenvector = R(j, m_varField[v]) * temporalFactor;
+          for (std::size_t i = 0; i < chunkSize; ++i) {
+            const double phase = temporalPhase + spatialPhase[i];
+            if (!restrictToWavefront || (phase > -0.5*M_PI && phase < 1.5*M_PI)) {
+              dofsQP[t](chunkStart + i, j) += (eigenvector * spatialFactor[i]).real();
+            }
+          }
+        }
       }
     }
   }
@@ -106,24 +166,24 @@ seissol::physics::SuperimposedPlanarwave::SuperimposedPlanarwave(const CellMater
 }
 
 void seissol::physics::SuperimposedPlanarwave::evaluate( double time,
-                                                         std::vector<std::array<double, 3>> const& points,
+                                                         PointsView points,
                                                          const CellMaterialData& materialData,
                                                          yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const
 {
-  dofsQP.setZero();
- 
-  real dofsPW_data[tensor::dofsQP::size()];
-  yateto::DenseTensorView<2,real,unsigned> dofsPW = init::dofsQP::view::create(dofsPW_data);
+  evaluateBatch(&time, 1, points, materialData, &dofsQP);
+}
 
+void seissol::physics::SuperimposedPlanarwave::evaluateBatch(const double* times,
+                                                             std::size_t numberOfTimes,
+                                                             PointsView points,
+                                                             const CellMaterialData& materialData,
+                                                             yateto::DenseTensorView<2,real,unsigned>* dofsQP) const {
+  for (std::size_t t = 0; t < numberOfTimes; ++t) {
+    dofsQP[t].setZero();
+  }
+  // add the planar waves directly to the result
   for (int pw = 0; pw < 3; pw++) {
-    //evaluate each planarwave
-    m_pw.at(pw).evaluate(time, points, materialData, dofsPW);
-    //and add results together
-    for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        dofsQP(i,j) += dofsPW(i,j);
-      }
-    }
+    m_pw.at(pw).accumulateBatch(times, numberOfTimes, points, dofsQP);
   }
 }
 
@@ -145,28 +205,21 @@ seissol::physics::TravellingWave::TravellingWave(const CellMaterialData& materia
 }
 
 void seissol::physics::TravellingWave::evaluate(double time,
-				       	        std::vector<std::array<double, 3>> const& points,
+				       	        PointsView points,
 				       	        const CellMaterialData& materialData,
 				       	        yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
-  dofsQp.setZero();
+  evaluateBatch(&time, 1, points, materialData, &dofsQp);
+}
 
-  auto R = yateto::DenseTensorView<2,std::complex<double>>(const_cast<std::complex<double>*>(m_eigenvectors.data()), {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
-  for (unsigned v = 0; v < m_varField.size(); ++v) {
-    const auto omega =  m_lambdaA[m_varField[v]];
-    for (unsigned j = 0; j < dofsQp.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        auto arg = std::complex<double>(0.0, 1.0) * (
-                          omega * time
-                        - m_kVec[0]*(points[i][0] - m_origin[0]) 
-                        - m_kVec[1]*(points[i][1] - m_origin[1]) 
-                        - m_kVec[2]*(points[i][2] - m_origin[2]) 
-                        + m_phase);
-        if(arg.imag() > -0.5*M_PI && arg.imag() < 1.5*M_PI) {
-          dofsQp(i,j) += (R(j,m_varField[v]) * m_ampField[v] * std::exp(arg)).real();
-        }
-      }
-    }
+void seissol::physics::TravellingWave::evaluateBatch(const double* times,
+                                                     std::size_t numberOfTimes,
+                                                     PointsView points,
+                                                     const CellMaterialData& materialData,
+                                                     yateto::DenseTensorView<2,real,unsigned>* dofsQp) const {
+  for (std::size_t t = 0; t < numberOfTimes; ++t) {
+    dofsQp[t].setZero();
   }
+  addWave(times, numberOfTimes, points, m_origin, true, dofsQp);
 }
 
 seissol::physics::PressureInjection::PressureInjection(const seissol::initializer::parameters::InitializationParameters initializationParameters)
@@ -182,7 +235,7 @@ seissol::physics::PressureInjection::PressureInjection(const seissol::initialize
 }
 
 void seissol::physics::PressureInjection::evaluate(double time,
-					           std::vector<std::array<double, 3>> const& points,
+					           PointsView points,
 					           const CellMaterialData& materialData,
 					           yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
   const auto o_1 = m_parameters.origin[0];
@@ -215,7 +268,7 @@ void seissol::physics::PressureInjection::evaluate(double time,
 }
 
 void seissol::physics::ScholteWave::evaluate(double time,
-					     std::vector<std::array<double, 3>> const& points,
+					     PointsView points,
 					     const CellMaterialData& materialData,
 					     yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
 #ifndef USE_ANISOTROPIC
@@ -255,7 +308,7 @@ void seissol::physics::ScholteWave::evaluate(double time,
 }
 
 void seissol::physics::SnellsLaw::evaluate(double time,
-					   std::vector<std::array<double, 3>> const& points,
+					   PointsView points,
 					   const CellMaterialData& materialData,
 					   yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
 #ifndef USE_ANISOTROPIC
@@ -303,98 +356,97 @@ seissol::physics::Ocean::Ocean(int mode, double gravitationalAcceleration)
   }
 }
 void seissol::physics::Ocean::evaluate(double time,
-                                       std::vector<std::array<double, 3>> const& points,
+                                       PointsView points,
                                        const CellMaterialData& materialData,
                                        yateto::DenseTensorView<2,real,unsigned>& dofsQp) const {
+  evaluateBatch(&time, 1, points, materialData, &dofsQp);
+}
+
+void seissol::physics::Ocean::evaluateBatch(const double* times,
+                                            std::size_t numberOfTimes,
+                                            PointsView points,
+                                            const CellMaterialData& materialData,
+                                            yateto::DenseTensorView<2,real,unsigned>* dofsQp) const {
 #ifndef USE_ANISOTROPIC
+  const auto g = gravitationalAcceleration;
+  if (std::abs(g - 9.81e-3) > 10e-15) {
+    logError() << "Ocean scenario only supports g=9.81e-3 currently!";
+  }
+  if (materialData.local.mu != 0.0) {
+    logError() << "Ocean scenario only works for acoustic material (mu = 0.0)!";
+  }
+  const double pi = std::acos(-1);
+  const double rho = materialData.local.rho;
+
+  const double Lx = 10.0; // km
+  const double Ly = 10.0; // km
+  const double k_x = pi / Lx; // 1/km
+  const double k_y = pi / Ly; // 1/km
+
+  constexpr auto k_stars = std::array<double, 3>{
+    0.4433813748841239,
+    1.5733628061766445,
+    4.713305873881573
+  };
+
+  // Note: Could be computed on the fly but it's better to pre-compute them with higher precision!
+  constexpr auto omegas = std::array<double, 3>{
+    0.0425599572628432,
+    2.4523337594491745,
+    7.1012991617572165
+  };
+
+  const auto k_star = k_stars[mode];
+  const auto omega = omegas[mode];
+
+  const auto B = g * k_star / (omega * omega);
+  constexpr auto scalingFactor = 1;
+
+  // The spatial factors are evaluated once per point and reused for all times
   for (size_t i = 0; i < points.size(); ++i) {
     const auto x = points[i][0];
     const auto y = points[i][1];
     const auto z = points[i][2];
-    const auto t = time;
 
-    const auto g = gravitationalAcceleration;
-    if (std::abs(g - 9.81e-3) > 10e-15) {
-      logError() << "Ocean scenario only supports g=9.81e-3 currently!";
-    }
-    if (materialData.local.mu != 0.0) {
-      logError() << "Ocean scenario only works for acoustic material (mu = 0.0)!";
-    }
-    const double pi = std::acos(-1);
-    const double rho = materialData.local.rho;
-
-    const double Lx = 10.0; // km
-    const double Ly = 10.0; // km
-    const double k_x = pi / Lx; // 1/km
-    const double k_y = pi / Ly; // 1/km
-
-    constexpr auto k_stars = std::array<double, 3>{
-      0.4433813748841239,
-      1.5733628061766445,
-      4.713305873881573
-    };
-
-    // Note: Could be computed on the fly but it's better to pre-compute them with higher precision!
-    constexpr auto omegas = std::array<double, 3>{
-      0.0425599572628432,
-      2.4523337594491745,
-      7.1012991617572165
-    };
-
-    const auto k_star = k_stars[mode];
-    const auto omega = omegas[mode];
-
-    const auto B = g * k_star / (omega * omega);
-    constexpr auto scalingFactor = 1;
-
-    // Shear stresses are zero for elastic
-    dofsQp(i, 3) = 0.0;
-    dofsQp(i, 4) = 0.0;
-    dofsQp(i, 5) = 0.0;
+    const auto sinX = std::sin(k_x * x);
+    const auto cosX = std::cos(k_x * x);
+    const auto sinY = std::sin(k_y * y);
+    const auto cosY = std::cos(k_y * y);
 
+    double depthPressure;
+    double depthVelocity;
     if (mode == 0) {
       // Gravity mode
-      const auto pressure = -std::sin(k_x * x) * std::sin(k_y * y) * std::sin(omega * t) *
-                            (std::sinh(k_star * z) + B * std::cosh(k_star * z));
-      dofsQp(i, 0) = scalingFactor * pressure;
-      dofsQp(i, 1) = scalingFactor * pressure;
-      dofsQp(i, 2) = scalingFactor * pressure;
-
-      dofsQp(i, 6) =
-          scalingFactor * (k_x / (omega * rho)) * std::cos(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::sinh(k_star * z)
-           + B * std::cosh(k_star * z));
-      dofsQp(i, 7) =
-          scalingFactor * (k_y / (omega * rho)) * std::sin(k_x * x) * std::cos(k_y * y) * std::cos(omega * t) *
-          (std::sinh(k_star * z)
-           + B * std::cosh(k_star * z));
-      dofsQp(i, 8) =
-          scalingFactor * (k_star / (omega * rho)) * std::sin(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::cosh(k_star * z)
-           + B * std::sinh(k_star * z));
+      depthPressure = std::sinh(k_star * z) + B * std::cosh(k_star * z);
+      depthVelocity = std::cosh(k_star * z) + B * std::sinh(k_star * z);
     } else {
       // Elastic-acoustic mode
-      const auto pressure = -std::sin(k_x * x) * std::sin(k_y * y) * std::sin(omega * t) *
-                            (std::sin(k_star * z) + B * std::cos(k_star * z));
-      dofsQp(i, 0) = scalingFactor * pressure;
-      dofsQp(i, 1) = scalingFactor * pressure;
-      dofsQp(i, 2) = scalingFactor * pressure;
-      dofsQp(i, 6) =
-          scalingFactor * (k_x / (omega * rho)) * std::cos(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::sin(k_star * z)
-           + B * std::cos(k_star * z));
-      dofsQp(i, 7) =
-          scalingFactor * (k_y / (omega * rho)) * std::sin(k_x * x) * std::cos(k_y * y) * std::cos(omega * t) *
-          (std::sin(k_star * z)
-           + B * std::cos(k_star * z));
-      dofsQp(i, 8) =
-          scalingFactor * (k_star / (omega * rho)) * std::sin(k_x * x) * std::sin(k_y * y) * std::cos(omega * t) *
-          (std::cos(k_star * z)
-           - B * std::sin(k_star * z));
+      depthPressure = std::sin(k_star * z) + B * std::cos(k_star * z);
+      depthVelocity = std::cos(k_star * z) - B * std::sin(k_star * z);
     }
 
+    for (size_t t = 0; t < numberOfTimes; ++t) {
+      const auto sinT = std::sin(omega * times[t]);
+      const auto cosT = std::cos(omega * times[t]);
+
+      // Shear stresses are zero for elastic
+      dofsQp[t](i, 3) = 0.0;
+      dofsQp[t](i, 4) = 0.0;
+      dofsQp[t](i, 5) = 0.0;
+
+      const auto pressure = -sinX * sinY * sinT * depthPressure;
+      dofsQp[t](i, 0) = scalingFactor * pressure;
+      dofsQp[t](i, 1) = scalingFactor * pressure;
+      dofsQp[t](i, 2) = scalingFactor * pressure;
+
+      dofsQp[t](i, 6) = scalingFactor * (k_x / (omega * rho)) * cosX * sinY * cosT * depthPressure;
+      dofsQp[t](i, 7) = scalingFactor * (k_y / (omega * rho)) * sinX * cosY * cosT * depthPressure;
+      dofsQp[t](i, 8) = scalingFactor * (k_star / (omega * rho)) * sinX * sinY * cosT * depthVelocity;
+    }
   }
 #else
-  dofsQp.setZero();
+  for (size_t t = 0; t < numberOfTimes; ++t) {
+    dofsQp[t].setZero();
+  }
 #endif
 }
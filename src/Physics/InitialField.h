@@ -4,6 +4,7 @@
 #include <vector>
 #include <array>
 #include <complex>
+#include <cstddef>
 #include "Initializer/typedefs.hpp"
 #include <Kernels/precision.hpp>
 #include <generated_code/init.h>
@@ -11,19 +12,48 @@
 
 namespace seissol {
   namespace physics {
+    //! Non-owning view of evaluation points in global coordinates, e.g. of a stack array or a vector
+    class PointsView {
+    public:
+      PointsView(const std::array<double, 3>* points, std::size_t numberOfPoints)
+        : m_points(points), m_numberOfPoints(numberOfPoints) {}
+      PointsView(std::vector<std::array<double, 3>> const& points)
+        : PointsView(points.data(), points.size()) {}
+      template<std::size_t N>
+      PointsView(std::array<std::array<double, 3>, N> const& points)
+        : PointsView(points.data(), N) {}
+
+      const std::array<double, 3>& operator[](std::size_t i) const { return m_points[i]; }
+      std::size_t size() const { return m_numberOfPoints; }
+    private:
+      const std::array<double, 3>* m_points;
+      std::size_t m_numberOfPoints;
+    };
+
     class InitialField {
     public:
       virtual ~InitialField() = default;
       virtual void evaluate(double time,
-                            std::vector<std::array<double, 3>> const& points,
+                            PointsView points,
                             const CellMaterialData& materialData,
                             yateto::DenseTensorView<2,real,unsigned>& dofsQP) const = 0;
+
+      /**
+       * Evaluates the field at the same points for several times, where dofsQP[t] receives the values at times[t].
+       * The output is owned by the caller, hence no memory is allocated.
+       * The default implementation evaluates the times one after another.
+       **/
+      virtual void evaluateBatch(const double* times,
+                                 std::size_t numberOfTimes,
+                                 PointsView points,
+                                 const CellMaterialData& materialData,
+                                 yateto::DenseTensorView<2,real,unsigned>* dofsQP) const;
     };
 
     class ZeroField : public InitialField {
     public:
       void evaluate(double,
-                    std::vector<std::array<double, 3>> const&,
+                    PointsView,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override {
         dofsQP.setZero();
@@ -36,7 +66,7 @@ namespace seissol {
       PressureInjection(const seissol::initializer::parameters::InitializationParameters initializationParameters);
 
       void evaluate(double,
-                    std::vector<std::array<double, 3>> const&,
+                    PointsView,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
     private:
@@ -58,10 +88,30 @@ namespace seissol {
                         std::array<double, 3> kVec = {M_PI, M_PI, M_PI});
 
       void evaluate( double time,
-                     std::vector<std::array<double, 3>> const& points,
+                     PointsView points,
                      const CellMaterialData& materialData,
                      yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const override;
+
+      void evaluateBatch(const double* times,
+                         std::size_t numberOfTimes,
+                         PointsView points,
+                         const CellMaterialData& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>* dofsQP) const override;
+
+      //! Adds the wave to the values in dofsQP
+      void accumulateBatch(const double* times,
+                           std::size_t numberOfTimes,
+                           PointsView points,
+                           yateto::DenseTensorView<2,real,unsigned>* dofsQP) const;
     protected:
+      //! Adds the wave to dofsQP; if restrictToWavefront, only the part within one wave length behind the wave front through origin
+      void addWave(const double* times,
+                   std::size_t numberOfTimes,
+                   PointsView points,
+                   const std::array<double, 3>& origin,
+                   bool restrictToWavefront,
+                   yateto::DenseTensorView<2,real,unsigned>* dofsQP) const;
+
       std::vector<int> m_varField;
       std::vector<std::complex<double>> m_ampField;
       const double m_phase;
@@ -79,9 +129,15 @@ namespace seissol {
       SuperimposedPlanarwave(const CellMaterialData& materialData, real phase = 0.0);
 
       void evaluate( double time,
-                     std::vector<std::array<double, 3>> const& points,
+                     PointsView points,
                      const CellMaterialData& materialData,
                      yateto::DenseTensorView<2,real,unsigned>& dofsQP ) const override;
+
+      void evaluateBatch(const double* times,
+                         std::size_t numberOfTimes,
+                         PointsView points,
+                         const CellMaterialData& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>* dofsQP) const override;
     private:
       const std::array<std::array<double, 3>, 3>  m_kVec;
       const double                                m_phase;
@@ -94,9 +150,15 @@ namespace seissol {
       TravellingWave(const CellMaterialData& materialData, const TravellingWaveParameters& travellingWaveParameters);
 
       void evaluate(double time,
-                    std::vector<std::array<double, 3>> const& points,
+                    PointsView points,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+
+      void evaluateBatch(const double* times,
+                         std::size_t numberOfTimes,
+                         PointsView points,
+                         const CellMaterialData& materialData,
+                         yateto::DenseTensorView<2,real,unsigned>* dofsQP) const override;
       private:
       std::array<double, 3> m_origin;
     };
@@ -105,7 +167,7 @@ namespace seissol {
     public:
       ScholteWave() = default;
       void evaluate(double time,
-                    std::vector<std::array<double, 3>> const& points,
+                    PointsView points,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
     };
@@ -113,7 +175,7 @@ namespace seissol {
     public:
       SnellsLaw() = default;
       void evaluate(double time,
-                    std::vector<std::array<double, 3>> const& points,
+                    PointsView points,
                     const CellMaterialData& materialData,
                     yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
     };
@@ -134,9 +196,14 @@ namespace seissol {
       public:
           Ocean(int mode, double gravitationalAcceleration);
           void evaluate(double time,
-                        std::vector<std::array<double, 3>> const& points,
+                        PointsView points,
                         const CellMaterialData& materialData,
                         yateto::DenseTensorView<2,real,unsigned>& dofsQP) const override;
+          void evaluateBatch(const double* times,
+                             std::size_t numberOfTimes,
+                             PointsView points,
+                             const CellMaterialData& materialData,
+                             yateto::DenseTensorView<2,real,unsigned>* dofsQP) const override;
       };
   }
 }
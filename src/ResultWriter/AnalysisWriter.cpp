@@ -115,7 +115,7 @@ void AnalysisWriter::printAnalysis(double simulationTime) {
 
     // Note: We iterate over mesh cells by id to avoid
     // cells that are duplicates.
-    std::vector<std::array<double, 3>> quadraturePointsXyz(numQuadPoints);
+    std::array<std::array<double, 3>, numQuadPoints> quadraturePointsXyz;
 
     alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
     alignas(ALIGNMENT) real analyticalSolutionData[numQuadPoints*numberOfQuantities];
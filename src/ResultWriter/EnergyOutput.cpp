@@ -342,14 +342,16 @@ void EnergyOutput::computeVolumeEnergies() {
 #endif
 
     if (isPlasticityEnabled) {
-      // plastic moment
-      real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
+      // plastic moment, cells without plastic strain have not yielded yet
+      const real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
+      if (pstrainCell != nullptr) {
 #ifdef USE_ANISOTROPIC
-      real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
+        real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
 #else
-      real mu = material.local.mu;
+        real mu = material.local.mu;
 #endif
-      totalPlasticMoment += mu * volume * pstrainCell[6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
+        totalPlasticMoment += mu * volume * pstrainCell[6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
+      }
     }
   }
 }
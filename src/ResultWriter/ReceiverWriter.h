@@ -84,6 +84,8 @@ namespace seissol::writer {
       // Hooks
       //
       void syncPoint(double) override;
+      //! The receivers are recorded during the time steps, the sync point only writes them
+      bool requiresSynchronizedClusters() const override { return false; }
 
     private:
       [[nodiscard]] std::string fileName(unsigned pointId) const;
@@ -0,0 +1,35 @@
+#include "WaveFieldSnapshot.h"
+
+#include <algorithm>
+#include <cassert>
+
+seissol::writer::WaveFieldSnapshot::WaveFieldSnapshot(const real* dofs, std::size_t numberOfCells)
+    : dofs(dofs), numberOfCells(numberOfCells) {
+  snapshotDofs = static_cast<real*>(
+      allocator.allocateMemory(numberOfCells * tensor::Q::size() * sizeof(real), ALIGNMENT));
+}
+
+void seissol::writer::WaveFieldSnapshot::activate(double newTimeTolerance) {
+  active = true;
+  timeTolerance = newTimeTolerance;
+}
+
+void seissol::writer::WaveFieldSnapshot::schedule(double newTime) {
+  time = newTime;
+  numberOfEvaluatedCells = 0;
+}
+
+std::size_t seissol::writer::WaveFieldSnapshot::cellIndex(const real* cellDofs) const {
+  assert(cellDofs >= dofs);
+  return static_cast<std::size_t>(cellDofs - dofs) / tensor::Q::size();
+}
+
+void seissol::writer::WaveFieldSnapshot::evaluate(kernels::Time& timeKernel,
+                                                  double stepStart,
+                                                  const real* derivatives,
+                                                  std::size_t cell) {
+  assert(time >= stepStart - timeTolerance);
+  // Output times within the tolerance before the step are evaluated at its start
+  const double timeInStep = std::max(0.0, time - stepStart);
+  timeKernel.computeTaylorExpansion(timeInStep, 0.0, derivatives, cellDofs(cell));
+}
@@ -0,0 +1,84 @@
+#ifndef SEISSOL_WAVEFIELDSNAPSHOT_H
+#define SEISSOL_WAVEFIELDSNAPSHOT_H
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+
+#include "Initializer/typedefs.hpp"
+#include "Initializer/MemoryAllocator.h"
+#include "Kernels/Time.h"
+
+namespace seissol::writer {
+
+/**
+ * Degrees of freedom of all cells at one output time, assembled without synchronizing the time clusters.
+ *
+ * The snapshot has the same layout as the degrees of freedom of the LTS tree. Every time cluster
+ * evaluates the Taylor expansion of its cells in the time step which contains the output time and
+ * stores the result here. The wave field writer writes the snapshot once all clusters passed the output time.
+ *
+ * Time step n of a cluster covers the output times in [t_n - tolerance, t_{n+1} - tolerance),
+ * hence all output times before (correction time - tolerance) are evaluated by the cluster.
+ **/
+class WaveFieldSnapshot {
+ private:
+  memory::ManagedAllocator allocator;
+
+  //! degrees of freedom of the LTS tree, which define the layout of the snapshot
+  const real* dofs;
+
+  real* snapshotDofs;
+
+  std::size_t numberOfCells;
+
+  //! true if the time clusters evaluate the snapshot
+  bool active = false;
+
+  double timeTolerance = 0.0;
+
+  double time = std::numeric_limits<double>::infinity();
+
+  std::atomic<std::size_t> numberOfEvaluatedCells{0};
+
+ public:
+  WaveFieldSnapshot(const real* dofs, std::size_t numberOfCells);
+
+  void activate(double newTimeTolerance);
+
+  [[nodiscard]] bool isActive() const { return active; }
+
+  //! Sets the next output time; has to be called while no cluster computes
+  void schedule(double newTime);
+
+  [[nodiscard]] double getTime() const { return time; }
+
+  //! true if the step [stepStart, stepStart + stepSize) evaluates the snapshot
+  [[nodiscard]] bool isInStep(double stepStart, double stepSize) const {
+    return active && time >= stepStart - timeTolerance && time < stepStart + stepSize - timeTolerance;
+  }
+
+  //! Index of the first cell of the given degrees of freedom in the layout of the LTS tree
+  [[nodiscard]] std::size_t cellIndex(const real* cellDofs) const;
+
+  [[nodiscard]] real* cellDofs(std::size_t cell) { return snapshotDofs + cell * tensor::Q::size(); }
+
+  /**
+   * Stores the Taylor expansion of the time derivatives of a cell at the output time.
+   * The derivatives have to be computed in the step which starts at stepStart and contains the output time.
+   **/
+  void evaluate(kernels::Time& timeKernel, double stepStart, const real* derivatives, std::size_t cell);
+
+  void addEvaluatedCells(std::size_t count) { numberOfEvaluatedCells += count; }
+
+  //! Number of cells which have been evaluated for the scheduled time
+  [[nodiscard]] std::size_t getNumberOfEvaluatedCells() const { return numberOfEvaluatedCells; }
+
+  [[nodiscard]] bool isComplete() const { return numberOfEvaluatedCells == numberOfCells; }
+
+  [[nodiscard]] const real* getDofs() const { return snapshotDofs; }
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_WAVEFIELDSNAPSHOT_H
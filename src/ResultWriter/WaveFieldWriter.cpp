@@ -47,6 +47,7 @@
 #include "Geometry/refinement/MeshRefiner.h"
 #include "Monitoring/instrumentation.hpp"
 #include <Modules/Modules.h>
+#include "utils/env.h"
 
 void seissol::writer::WaveFieldWriter::setUp() {
   setExecutor(m_executor);
@@ -151,7 +152,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
                                             const seissol::geometry::MeshReader& meshReader,
                                             const std::vector<unsigned>& LtsClusteringData,
                                             const real* dofs,
-                                            const real* pstrain,
+                                            const real* const* pstrain,
                                             const real* integrals,
                                             unsigned int* map,
                                             const seissol::initializer::parameters::WaveFieldOutputParameters& parameters,
@@ -430,7 +431,26 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
   delete meshRefiner;
 }
 
-void seissol::writer::WaveFieldWriter::write(double time) {
+seissol::writer::WaveFieldSnapshot*
+    seissol::writer::WaveFieldWriter::createSnapshot(std::size_t numberOfCells) {
+  if (!m_enabled || !utils::Env::get<bool>("SEISSOL_SYNC_FREE_WAVEFIELD_OUTPUT", false)) {
+    return nullptr;
+  }
+  const int rank = seissol::MPI::mpi.rank();
+  const bool writesPlasticStrain =
+      std::any_of(m_outputFlags + m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES,
+                  m_outputFlags + m_numVariables,
+                  [](bool flag) { return flag; });
+  if (writesPlasticStrain || m_integrals != nullptr) {
+    logInfo(rank) << "Plastic strain and integrated quantities cannot be evaluated between time steps."
+                  << "The wave field output synchronizes the time clusters.";
+    return nullptr;
+  }
+  m_snapshot = std::make_unique<WaveFieldSnapshot>(m_dofs, numberOfCells);
+  return m_snapshot.get();
+}
+
+void seissol::writer::WaveFieldWriter::write(double time, const real* dofs) {
   SCOREP_USER_REGION("WaveFieldWriter_write", SCOREP_USER_REGION_TYPE_FUNCTION);
 
   if (!m_enabled)
@@ -457,7 +477,7 @@ void seissol::writer::WaveFieldWriter::write(double time) {
         async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
             real*>(nextId);
     if (i < m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) {
-      m_variableSubsampler->get(m_dofs, m_map, i, managedBuffer);
+      m_variableSubsampler->get(dofs, m_map, i, managedBuffer);
     } else {
       m_variableSubsamplerPStrain->get(
           m_pstrain,
@@ -511,4 +531,22 @@ void seissol::writer::WaveFieldWriter::write(double time) {
 
 void seissol::writer::WaveFieldWriter::simulationStart() { syncPoint(0.0); }
 
-void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) { write(currentTime); }
+void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) {
+  if (m_snapshot != nullptr && m_snapshot->getNumberOfEvaluatedCells() > 0) {
+    // Called once all clusters passed the output time
+    if (!m_snapshot->isComplete()) {
+      logError() << "The wave field snapshot at time" << currentTime << "is incomplete:"
+                 << m_snapshot->getNumberOfEvaluatedCells() << "cells were evaluated.";
+    }
+    write(currentTime, m_snapshot->getDofs());
+  } else {
+    // The clusters are synchronized, e.g. at the start or the end of the simulation
+    write(currentTime);
+  }
+}
+
+void seissol::writer::WaveFieldWriter::syncPointScheduled(double nextSyncPoint) {
+  if (m_snapshot != nullptr) {
+    m_snapshot->schedule(nextSyncPoint);
+  }
+}
@@ -59,6 +59,7 @@
 #include "Checkpoint/DynStruct.h"
 #include "Geometry/refinement/VariableSubSampler.h"
 #include "Monitoring/Stopwatch.h"
+#include "WaveFieldSnapshot.h"
 #include "WaveFieldWriterExecutor.h"
 #include <Modules/Module.h>
 
@@ -122,8 +123,8 @@ class WaveFieldWriter
   /** Pointer to the degrees of freedom */
   const real* m_dofs;
 
-  /** Pointer to the plastic strain */
-  const real* m_pstrain;
+  /** Pointers to the plastic strain of each cell, null for cells which have not yielded */
+  const real* const* m_pstrain;
 
   /** Pointer to the integrals */
   const real* m_integrals;
@@ -134,6 +135,9 @@ class WaveFieldWriter
   /** The stopwatch for the frontend */
   Stopwatch m_stopwatch;
 
+  /** The wave field at the next output time, evaluated by the time clusters (optional) */
+  std::unique_ptr<WaveFieldSnapshot> m_snapshot;
+
   /** Checks if a vertex given by the vertexCoords lies inside the boxBounds */
   /*   The boxBounds is in the format: xMin, xMax, yMin, yMax, zMin, zMax */
   bool vertexInBox(const double* const boxBounds, const double* const vertexCoords) {
@@ -194,17 +198,31 @@ class WaveFieldWriter
             const seissol::geometry::MeshReader& meshReader,
             const std::vector<unsigned>& LtsClusteringData,
             const real* dofs,
-            const real* pstrain,
+            const real* const* pstrain,
             const real* integrals,
             unsigned int* map,
             const seissol::initializer::parameters::WaveFieldOutputParameters& parameters,
             xdmfwriter::BackendType backend,
             const std::string& backupTimeStamp);
 
+  /**
+   * Creates the snapshot which lets the time clusters evaluate the wave field at the output times,
+   * if requested via SEISSOL_SYNC_FREE_WAVEFIELD_OUTPUT.
+   *
+   * @param numberOfCells The number of cells with degrees of freedom
+   * @return The snapshot or nullptr, if the output requires synchronized clusters
+   */
+  WaveFieldSnapshot* createSnapshot(std::size_t numberOfCells);
+
   /**
    * Write a time step
    */
-  void write(double time);
+  void write(double time) { write(time, m_dofs); }
+
+  /**
+   * Write a time step from the given degrees of freedom (in the layout of the LTS tree)
+   */
+  void write(double time, const real* dofs);
 
   /**
    * Close wave field writer and free resources
@@ -240,6 +258,12 @@ class WaveFieldWriter
   void simulationStart();
 
   void syncPoint(double currentTime);
+
+  void syncPointScheduled(double nextSyncPoint) override;
+
+  bool requiresSynchronizedClusters() const override {
+    return m_snapshot == nullptr || !m_snapshot->isActive();
+  }
 };
 
 } // namespace writer
@@ -90,6 +90,7 @@ bool seissol::SeisSol::init(int argc, char* argv[]) {
   logInfo(rank) << "Using MPI with #ranks:" << MPI::mpi.size();
   // TODO (Ravil, David): switch to reading MPI options from the parameter-file.
   MPI::mpi.setDataTransferModeFromEnv();
+  MPI::mpi.setPersistentRequestsFromEnv();
 #endif
 #ifdef _OPENMP
   pinning.checkEnvVariables();
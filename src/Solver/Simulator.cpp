@@ -109,7 +109,7 @@ void seissol::Simulator::simulate() {
   // NOTE: This will not call the module specific implementation of the synchronization hook
   // since the current time is the simulation start time. We only use this function here to
   // get correct upcoming time. To be on the safe side, we use zero time tolerance.
-  upcomingTime = std::min( upcomingTime, Modules::callSyncHook(m_currentTime, 0.0) );
+  upcomingTime = std::min( upcomingTime, Modules::callSyncHook(m_currentTime, 0.0, false, m_checkPointTime + m_checkPointInterval) );
   upcomingTime = std::min( upcomingTime, std::abs(m_checkPointTime + m_checkPointInterval) );
 
   while( m_finalTime > m_currentTime + l_timeTolerance ) {
@@ -125,8 +125,13 @@ void seissol::Simulator::simulate() {
     // Set new upcoming time (might by overwritten by any of the modules)
     upcomingTime = m_finalTime;
 
-    // Check all synchronization point hooks
-    upcomingTime = std::min(upcomingTime, Modules::callSyncHook(m_currentTime, l_timeTolerance));
+    // Check all synchronization point hooks; the modules may share the synchronization point of the next
+    // checkpoint, which is the one after the current time if a checkpoint is written below
+    double nextCheckPointTime = m_checkPointTime + m_checkPointInterval;
+    if (std::abs(m_currentTime - nextCheckPointTime) < l_timeTolerance) {
+      nextCheckPointTime += m_checkPointInterval;
+    }
+    upcomingTime = std::min(upcomingTime, Modules::callSyncHook(m_currentTime, l_timeTolerance, false, nextCheckPointTime));
 
     // write checkpoint if required
     if( std::abs( m_currentTime - ( m_checkPointTime + m_checkPointInterval ) ) < l_timeTolerance ) {
@@ -3,6 +3,8 @@
 #include <list>
 #include "Initializer/typedefs.hpp"
 #include "AbstractTimeCluster.h"
+#include "CopyRegionProgress.h"
+#include "GhostMessageAggregator.h"
 
 
 namespace seissol::time_stepping {
@@ -20,7 +22,7 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
   virtual void receiveGhostLayer() = 0;
 
   bool testQueue(MPI_Request* requests, std::list<unsigned int>& regions);
-  bool testForCopyLayerSends();
+  virtual bool testForCopyLayerSends();
   virtual bool testForGhostLayerReceives() = 0;
 
   void start() override;
@@ -43,5 +45,11 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
   void reset() override;
   ActResult act() override;
 
+  //! Lets the ghost cluster send copy regions as soon as they are published; ignored if not supported
+  virtual void setCopyRegionProgress(const CopyRegionProgress* /*progress*/) {}
+
+  //! Lets the ghost cluster exchange its regions via the aggregator; ignored if not supported
+  virtual void setMessageAggregator(GhostMessageAggregator* /*aggregator*/) {}
+
 };
 } // namespace seissol::time_stepping
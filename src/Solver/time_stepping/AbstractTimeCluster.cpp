@@ -1,4 +1,5 @@
 #include <iostream>
+#include <algorithm>
 #include <cassert>
 #include "utils/logger.h"
 
@@ -17,6 +18,12 @@ AbstractTimeCluster::AbstractTimeCluster(double maxTimeStepSize, long timeStepRa
   ct.timeStepRate = timeStepRate;
 }
 
+bool AbstractTimeCluster::announcesPrediction(const NeighborCluster& neighbor, long predictionsSinceLastSync) const {
+  // Maybe check also how many steps neighbor has to sync!
+  const bool justBeforeSync = ct.stepsUntilSync <= predictionsSinceLastSync;
+  return justBeforeSync || predictionsSinceLastSync >= neighbor.ct.nextCorrectionSteps();
+}
+
 ActorAction AbstractTimeCluster::getNextLegalAction() {
   processMessages();
   switch (state) {
@@ -78,11 +85,7 @@ void AbstractTimeCluster::unsafePerformAction(ActorAction action) {
       ct.predictionTime += timeStepSize();
 
       for (auto &neighbor : neighbors) {
-        // Maybe check also how many steps neighbor has to sync!
-        const bool justBeforeSync = ct.stepsUntilSync <= ct.predictionsSinceLastSync;
-        const bool sendMessage = justBeforeSync
-                                 || ct.predictionsSinceLastSync >= neighbor.ct.nextCorrectionSteps();
-        if (sendMessage) {
+        if (announcesPrediction(neighbor, ct.predictionsSinceLastSync)) {
           AdvancedPredictionTimeMessage message{};
           message.time = ct.predictionTime;
           message.stepsSinceSync = ct.predictionsSinceLastSync;
@@ -192,6 +195,8 @@ void AbstractTimeCluster::connect(AbstractTimeCluster &other) {
   other.neighbors.emplace_back(ct.maxTimeStepSize, ct.timeStepRate);
   neighbors.back().inbox = std::make_shared<MessageQueue>();
   other.neighbors.back().inbox = std::make_shared<MessageQueue>();
+  neighbors.back().inbox->setOnPush([this]() { wakeup(); });
+  other.neighbors.back().inbox->setOnPush([&other]() { other.wakeup(); });
   neighbors.back().outbox = other.neighbors.back().inbox;
   other.neighbors.back().outbox = neighbors.back().inbox;
 }
@@ -202,6 +207,27 @@ void AbstractTimeCluster::setSyncTime(double newSyncTime) {
   syncTime = newSyncTime;
 }
 
+void AbstractTimeCluster::wakeup() {
+  awake.store(true);
+  if (wakeupListener) {
+    wakeupListener();
+  }
+}
+
+bool AbstractTimeCluster::consumeWakeup() {
+  return awake.exchange(false);
+}
+
+void AbstractTimeCluster::setWakeupListener(std::function<void()> listener) {
+  wakeupListener = std::move(listener);
+}
+
+bool AbstractTimeCluster::hasPendingMessages() const {
+  return std::any_of(neighbors.begin(), neighbors.end(), [](const NeighborCluster& neighbor) {
+    return neighbor.inbox->hasMessages();
+  });
+}
+
 bool AbstractTimeCluster::synced() const {
   return state == ActorState::Synced;
 }
@@ -222,7 +248,7 @@ void AbstractTimeCluster::reset() {
     neighbor.ct.stepsSinceLastSync = 0;
     neighbor.ct.predictionsSinceLastSync = 0;
   }
-
+  awake.store(true);
 }
 
 ActorPriority AbstractTimeCluster::getPriority() const {
@@ -245,6 +271,10 @@ void AbstractTimeCluster::setCorrectionTime(double time) {
   ct.correctionTime = time;
 }
 
+double AbstractTimeCluster::getCorrectionTime() const {
+  return ct.correctionTime;
+}
+
 long AbstractTimeCluster::getTimeStepRate() {
   return timeStepRate;
 }
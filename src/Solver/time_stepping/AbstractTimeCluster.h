@@ -1,9 +1,11 @@
 #ifndef SEISSOL_ACTOR_H
 #define SEISSOL_ACTOR_H
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <functional>
 #include "ActorState.h"
 
 namespace seissol::time_stepping {
@@ -15,6 +17,10 @@ private:
   const std::chrono::seconds timeout = std::chrono::minutes(15);
   bool alreadyPrintedTimeOut = false;
 
+  //! true if a message arrived or the state changed since the scheduler last looked at this actor
+  std::atomic<bool> awake{true};
+  std::function<void()> wakeupListener;
+
 protected:
   ActorState state = ActorState::Synced;
   ClusterTimes ct;
@@ -23,6 +29,9 @@ protected:
 
   [[nodiscard]] double timeStepSize() const;
 
+  //! true if a prediction which reaches predictionsSinceLastSync is announced to the neighbor
+  [[nodiscard]] bool announcesPrediction(const NeighborCluster& neighbor, long predictionsSinceLastSync) const;
+
   void unsafePerformAction(ActorAction action);
   AbstractTimeCluster(double maxTimeStepSize, long timeStepRate);
 
@@ -54,6 +63,18 @@ public:
   virtual void setPriority(ActorPriority priority);
 
   void connect(AbstractTimeCluster& other);
+
+  /**
+   * Marks the cluster as (possibly) able to act and informs the wake-up listener.
+   * Called whenever a neighbor pushes a message into one of our inboxes.
+   */
+  void wakeup();
+
+  //! Returns true (once) if the cluster was woken up since the last call.
+  bool consumeWakeup();
+  void setWakeupListener(std::function<void()> listener);
+  [[nodiscard]] bool hasPendingMessages() const;
+
   void setSyncTime(double newSyncTime);
 
   [[nodiscard]] ActorState getState() const;
@@ -62,6 +83,7 @@ public:
 
   void setPredictionTime(double time);
   void setCorrectionTime(double time);
+  [[nodiscard]] double getCorrectionTime() const;
 
   long getTimeStepRate();
 
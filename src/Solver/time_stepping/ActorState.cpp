@@ -35,9 +35,18 @@ std::string actorStateToString(ActorState state) {
 }
 
 
+void MessageQueue::setOnPush(std::function<void()> callback) {
+  onPush = std::move(callback);
+}
+
 void MessageQueue::push(const Message& message) {
-  std::lock_guard lock{mutex};
-  queue.push(message);
+  {
+    std::lock_guard lock{mutex};
+    queue.push(message);
+  }
+  if (onPush) {
+    onPush();
+  }
 }
 
 Message MessageQueue::pop() {
@@ -48,13 +57,33 @@ Message MessageQueue::pop() {
 }
 
 bool MessageQueue::hasMessages() const {
+  std::lock_guard lock{mutex};
   return !queue.empty();
 }
 
 size_t MessageQueue::size() const {
+  std::lock_guard lock{mutex};
   return queue.size();
 }
 
+void WakeupSignal::notify() {
+  {
+    std::lock_guard lock{mutex};
+    ++generation;
+  }
+  condition.notify_all();
+}
+
+unsigned long WakeupSignal::currentGeneration() {
+  std::lock_guard lock{mutex};
+  return generation;
+}
+
+void WakeupSignal::waitFor(unsigned long seenGeneration, std::chrono::microseconds timeout) {
+  std::unique_lock lock{mutex};
+  condition.wait_for(lock, timeout, [&]() { return generation != seenGeneration; });
+}
+
 double ClusterTimes::nextCorrectionTime(double syncTime) const {
   return std::min(syncTime, correctionTime + maxTimeStepSize);
 }
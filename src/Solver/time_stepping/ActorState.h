@@ -1,6 +1,9 @@
 #ifndef SEISSOL_ACTORSTATE_H
 #define SEISSOL_ACTORSTATE_H
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <queue>
 #include <variant>
@@ -26,12 +29,16 @@ inline std::ostream& operator<<(std::ostream& stream, const Message& message);
 class MessageQueue {
  private:
   std::queue<Message> queue;
-  std::mutex mutex;
+  mutable std::mutex mutex;
+  std::function<void()> onPush;
 
  public:
   MessageQueue() = default;
   ~MessageQueue() = default;
 
+  //! Called after every push, e.g. to wake up the receiving actor.
+  void setOnPush(std::function<void()> callback);
+
   void push(Message const& message);
 
   Message pop();
@@ -41,6 +48,26 @@ class MessageQueue {
   [[nodiscard]] size_t size() const;
 };
 
+/**
+ * Lets a scheduler sleep until one of its actors received a message.
+ * Messages may be pushed from the communication thread, hence the generation counter
+ * is protected by a mutex to avoid lost wake-ups.
+ */
+class WakeupSignal {
+ private:
+  std::mutex mutex;
+  std::condition_variable condition;
+  unsigned long generation = 0;
+
+ public:
+  void notify();
+
+  [[nodiscard]] unsigned long currentGeneration();
+
+  //! Blocks until notify() was called after seenGeneration was read, or until the timeout expired.
+  void waitFor(unsigned long seenGeneration, std::chrono::microseconds timeout);
+};
+
 enum class ActorState {
   Corrected,
   Predicted,
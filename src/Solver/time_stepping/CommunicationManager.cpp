@@ -16,12 +16,21 @@ void seissol::time_stepping::AbstractCommunicationManager::reset(double newSyncT
   }
 }
 
+void seissol::time_stepping::AbstractCommunicationManager::setMessageAggregator(
+    seissol::time_stepping::GhostMessageAggregator* aggregator) {
+  messageAggregator = aggregator;
+}
+
 bool seissol::time_stepping::AbstractCommunicationManager::poll() {
   bool finished = true;
   for (auto& ghostCluster : ghostClusters) {
     ghostCluster->act();
     finished = finished && ghostCluster->synced();
   }
+  // Sends all regions which were scheduled by the ghost clusters above
+  if (messageAggregator != nullptr) {
+    messageAggregator->progress();
+  }
   return finished;
 }
 
@@ -42,6 +51,10 @@ void seissol::time_stepping::SerialCommunicationManager::progression() {
   poll();
 }
 
+bool seissol::time_stepping::SerialCommunicationManager::requiresPolling() const {
+  return true;
+}
+
 seissol::time_stepping::ThreadedCommunicationManager::ThreadedCommunicationManager(
     seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters,
     const seissol::parallel::Pinning* pinning)
@@ -60,6 +73,10 @@ bool seissol::time_stepping::ThreadedCommunicationManager::checkIfFinished() con
   return isFinished.load();
 }
 
+bool seissol::time_stepping::ThreadedCommunicationManager::requiresPolling() const {
+  return false;
+}
+
 void seissol::time_stepping::ThreadedCommunicationManager::reset(double newSyncTime) {
   // Send signal to comm. thread to finish and wait.
   shouldReset.store(true);
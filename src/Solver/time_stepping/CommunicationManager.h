@@ -7,6 +7,7 @@
 #include <vector>
 #include <Parallel/Pin.h>
 #include "Solver/time_stepping/AbstractGhostTimeCluster.h"
+#include "Solver/time_stepping/GhostMessageAggregator.h"
 
 
 namespace seissol::time_stepping {
@@ -15,7 +16,11 @@ public:
   using ghostClusters_t = std::vector<std::unique_ptr<AbstractGhostTimeCluster>>;
   virtual void progression() = 0;
   [[nodiscard]] virtual bool checkIfFinished() const = 0;
+  //! true if progression() must be called regularly for the ghost clusters to make progress
+  [[nodiscard]] virtual bool requiresPolling() const = 0;
   virtual void reset(double newSyncTime);
+  //! The aggregator is progressed after the ghost clusters
+  void setMessageAggregator(GhostMessageAggregator* aggregator);
 
   virtual ~AbstractCommunicationManager() = default;
 
@@ -23,6 +28,7 @@ protected:
   explicit AbstractCommunicationManager(ghostClusters_t ghostClusters);
   bool poll();
   ghostClusters_t ghostClusters;
+  GhostMessageAggregator* messageAggregator = nullptr;
 
 };
 
@@ -31,6 +37,7 @@ public:
   explicit SerialCommunicationManager(ghostClusters_t ghostClusters);
   void progression() override;
   [[nodiscard]] bool checkIfFinished() const override;
+  [[nodiscard]] bool requiresPolling() const override;
 };
 
 class ThreadedCommunicationManager : public AbstractCommunicationManager {
@@ -39,6 +46,7 @@ public:
                                const parallel::Pinning* pinning);
   void progression() override;
   [[nodiscard]] bool checkIfFinished() const override;
+  [[nodiscard]] bool requiresPolling() const override;
   void reset(double newSyncTime) override;
 
   ~ThreadedCommunicationManager() override;
@@ -0,0 +1,46 @@
+#include "CopyRegionProgress.h"
+
+namespace seissol::time_stepping {
+
+CopyRegionProgress::CopyRegionProgress(const MeshStructure& meshStructure)
+    : readySteps(std::make_unique<std::atomic<long>[]>(meshStructure.numberOfRegions)) {
+  unsigned int offset = 0;
+  for (unsigned int region = 0; region < meshStructure.numberOfRegions; ++region) {
+    offset += meshStructure.numberOfCopyRegionCells[region];
+    regionEnds.push_back(offset);
+    regionClusters.push_back(meshStructure.neighboringClusters[region][1]);
+    readySteps[region].store(-1);
+  }
+}
+
+unsigned int CopyRegionProgress::numberOfRegions() const {
+  return regionEnds.size();
+}
+
+unsigned int CopyRegionProgress::regionEnd(unsigned int region) const {
+  return regionEnds[region];
+}
+
+int CopyRegionProgress::regionCluster(unsigned int region) const {
+  return regionClusters[region];
+}
+
+void CopyRegionProgress::setProgressionCallback(std::function<void()> callback) {
+  progressionCallback = std::move(callback);
+}
+
+void CopyRegionProgress::publish(unsigned int region, long predictionsSinceStart) {
+  readySteps[region].store(predictionsSinceStart, std::memory_order_release);
+}
+
+void CopyRegionProgress::progress() const {
+  if (progressionCallback) {
+    progressionCallback();
+  }
+}
+
+long CopyRegionProgress::getReadySteps(unsigned int region) const {
+  return readySteps[region].load(std::memory_order_acquire);
+}
+
+} // namespace seissol::time_stepping
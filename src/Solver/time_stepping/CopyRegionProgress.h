@@ -0,0 +1,55 @@
+#ifndef SEISSOL_COPYREGIONPROGRESS_H
+#define SEISSOL_COPYREGIONPROGRESS_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Initializer/typedefs.hpp"
+
+namespace seissol::time_stepping {
+
+/**
+ * Progress of the local integration in a copy layer, region by region.
+ * The cells of the copy layer are ordered by communication region. The copy layer cluster
+ * publishes each region as soon as its buffers and derivatives are final, such that the ghost
+ * clusters can send it before the whole copy layer is finished.
+ **/
+class CopyRegionProgress {
+ private:
+  //! end of each copy region in the cells of the copy layer
+  std::vector<unsigned int> regionEnds;
+
+  //! the global cluster id of the receiving cluster of each region
+  std::vector<int> regionClusters;
+
+  //! predictionsSinceStart of the copy layer cluster for which the region is ready to be sent
+  std::unique_ptr<std::atomic<long>[]> readySteps;
+
+  //! called after each published region, e.g. to progress MPI without communication thread
+  std::function<void()> progressionCallback;
+
+ public:
+  explicit CopyRegionProgress(const MeshStructure& meshStructure);
+
+  [[nodiscard]] unsigned int numberOfRegions() const;
+
+  [[nodiscard]] unsigned int regionEnd(unsigned int region) const;
+
+  [[nodiscard]] int regionCluster(unsigned int region) const;
+
+  void setProgressionCallback(std::function<void()> callback);
+
+  //! Marks the region as ready to be sent for the prediction which ends after predictionsSinceStart steps
+  void publish(unsigned int region, long predictionsSinceStart);
+
+  //! Calls the progression callback, if any
+  void progress() const;
+
+  [[nodiscard]] long getReadySteps(unsigned int region) const;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_COPYREGIONPROGRESS_H
@@ -3,37 +3,108 @@
 
 
 namespace seissol::time_stepping {
+void DirectGhostTimeCluster::sendCopyRegion(unsigned int region) {
+  if (messageAggregator != nullptr && messageAggregator->isAggregated(globalClusterId, region)) {
+    messageAggregator->send(globalClusterId, region);
+  } else if (usePersistentRequests) {
+    MPI_Start(meshStructure->sendRequests + region);
+  } else {
+    MPI_Isend(meshStructure->copyRegions[region],
+              static_cast<int>(meshStructure->copyRegionSizes[region]),
+              MPI_C_REAL,
+              meshStructure->neighboringClusters[region][0],
+              timeData + meshStructure->sendIdentifiers[region],
+              seissol::MPI::mpi.comm(),
+              meshStructure->sendRequests + region
+             );
+  }
+  sendQueue.push_back(region);
+}
+
+bool DirectGhostTimeCluster::testAggregatedQueue(MPI_Request* requests,
+                                                 std::list<unsigned int>& regions,
+                                                 bool (GhostMessageAggregator::*isCompleted)(int, unsigned) const) {
+  for (auto region = regions.begin(); region != regions.end();) {
+    int testSuccess = 0;
+    if (messageAggregator->isAggregated(globalClusterId, *region)) {
+      testSuccess = (messageAggregator->*isCompleted)(globalClusterId, *region) ? 1 : 0;
+    } else {
+      MPI_Test(&requests[*region], &testSuccess, MPI_STATUS_IGNORE);
+    }
+    if (testSuccess) {
+      region = regions.erase(region);
+    } else {
+      ++region;
+    }
+  }
+  return regions.empty();
+}
+
 void DirectGhostTimeCluster::sendCopyLayer() {
   SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
   assert(ct.correctionTime > lastSendTime);
   lastSendTime = ct.correctionTime;
   for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
     if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
-     MPI_Isend(meshStructure->copyRegions[region],
-                static_cast<int>(meshStructure->copyRegionSizes[region]),
-                MPI_C_REAL,
-                meshStructure->neighboringClusters[region][0],
-                timeData + meshStructure->sendIdentifiers[region],
-                seissol::MPI::mpi.comm(),
-                meshStructure->sendRequests + region
-               );
-      sendQueue.push_back(region);
+      if (copyRegionProgress != nullptr) {
+        lastSentSteps[region] = copyRegionProgress->getReadySteps(region);
+        if (isSentEarly[region]) {
+          isSentEarly[region] = false;
+          continue;
+        }
+      }
+      sendCopyRegion(region);
     }
   }
 }
 
+void DirectGhostTimeCluster::sendPublishedCopyRegions() {
+  SCOREP_USER_REGION( "sendPublishedCopyRegions", SCOREP_USER_REGION_TYPE_FUNCTION )
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      const auto readySteps = copyRegionProgress->getReadySteps(region);
+      if (readySteps > lastSentSteps[region]) {
+        // The previous send of this region has been completed, as the copy layer cluster
+        // may only predict again after this ghost cluster corrected.
+        sendCopyRegion(region);
+        lastSentSteps[region] = readySteps;
+        isSentEarly[region] = true;
+      }
+    }
+  }
+}
+
+ActResult DirectGhostTimeCluster::act() {
+  if (copyRegionProgress != nullptr) {
+    sendPublishedCopyRegions();
+  }
+  return AbstractGhostTimeCluster::act();
+}
+
+void DirectGhostTimeCluster::setCopyRegionProgress(const CopyRegionProgress* progress) {
+  copyRegionProgress = progress;
+  lastSentSteps.assign(meshStructure->numberOfRegions, -1);
+  isSentEarly.assign(meshStructure->numberOfRegions, false);
+}
+
 void DirectGhostTimeCluster::receiveGhostLayer() {
   SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
   assert(ct.predictionTime >= lastSendTime);
   for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
     if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
-      MPI_Irecv(meshStructure->ghostRegions[region],
-                static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                MPI_C_REAL,
-                meshStructure->neighboringClusters[region][0],
-                timeData + meshStructure->receiveIdentifiers[region],
-                seissol::MPI::mpi.comm(),
-                meshStructure->receiveRequests + region);
+      if (messageAggregator != nullptr && messageAggregator->isAggregated(globalClusterId, region)) {
+        messageAggregator->receive(globalClusterId, region);
+      } else if (usePersistentRequests) {
+        MPI_Start(meshStructure->receiveRequests + region);
+      } else {
+        MPI_Irecv(meshStructure->ghostRegions[region],
+                  static_cast<int>(meshStructure->ghostRegionSizes[region]),
+                  MPI_C_REAL,
+                  meshStructure->neighboringClusters[region][0],
+                  timeData + meshStructure->receiveIdentifiers[region],
+                  seissol::MPI::mpi.comm(),
+                  meshStructure->receiveRequests + region);
+      }
       receiveQueue.push_back(region);
     }
   }
@@ -41,9 +112,24 @@ void DirectGhostTimeCluster::receiveGhostLayer() {
 
 bool DirectGhostTimeCluster::testForGhostLayerReceives() {
   SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
+  if (messageAggregator != nullptr) {
+    return testAggregatedQueue(meshStructure->receiveRequests, receiveQueue, &GhostMessageAggregator::isReceiveCompleted);
+  }
   return testQueue(meshStructure->receiveRequests, receiveQueue);
 }
 
+bool DirectGhostTimeCluster::testForCopyLayerSends() {
+  SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
+  if (messageAggregator != nullptr) {
+    return testAggregatedQueue(meshStructure->sendRequests, sendQueue, &GhostMessageAggregator::isSendCompleted);
+  }
+  return testQueue(meshStructure->sendRequests, sendQueue);
+}
+
+void DirectGhostTimeCluster::setMessageAggregator(GhostMessageAggregator* aggregator) {
+  messageAggregator = aggregator;
+}
+
 DirectGhostTimeCluster::DirectGhostTimeCluster(double maxTimeStepSize,
                                                int timeStepRate,
                                                int globalTimeClusterId,
@@ -53,5 +139,6 @@ DirectGhostTimeCluster::DirectGhostTimeCluster(double maxTimeStepSize,
                                timeStepRate,
                                globalTimeClusterId,
                                otherGlobalTimeClusterId,
-                               meshStructure) {}
+                               meshStructure),
+      usePersistentRequests(seissol::MPI::mpi.usePersistentRequests()) {}
 } // namespace seissol::time_stepping
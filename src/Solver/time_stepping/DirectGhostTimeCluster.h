@@ -1,16 +1,38 @@
 #pragma once
 
 #include <list>
+#include <vector>
 #include "Initializer/typedefs.hpp"
 #include "Solver/time_stepping/AbstractGhostTimeCluster.h"
 
 
 namespace seissol::time_stepping {
 class DirectGhostTimeCluster : public AbstractGhostTimeCluster {
+private:
+  //! if true, the requests of the mesh structure are persistent and only need to be started
+  const bool usePersistentRequests;
+
+  GhostMessageAggregator* messageAggregator = nullptr;
+
+  const CopyRegionProgress* copyRegionProgress = nullptr;
+  //! published steps of the copy layer which were sent last, per region
+  std::vector<long> lastSentSteps;
+  //! true if the region was sent before the corresponding prediction message arrived
+  std::vector<bool> isSentEarly;
+
+  void sendCopyRegion(unsigned int region);
+  //! testQueue for a mix of aggregated and direct regions
+  bool testAggregatedQueue(MPI_Request* requests,
+                           std::list<unsigned int>& regions,
+                           bool (GhostMessageAggregator::*isCompleted)(int, unsigned) const);
+
 protected:
+  //! Sends the copy regions which were published since their last send
+  void sendPublishedCopyRegions();
   virtual void sendCopyLayer();
   virtual void receiveGhostLayer();
   virtual bool testForGhostLayerReceives();
+  bool testForCopyLayerSends() override;
 
 public:
     DirectGhostTimeCluster(double maxTimeStepSize,
@@ -18,6 +40,10 @@ public:
                            int globalTimeClusterId,
                            int otherGlobalTimeClusterId,
                            const MeshStructure* meshStructure);
+
+  ActResult act() override;
+  void setCopyRegionProgress(const CopyRegionProgress* progress) override;
+  void setMessageAggregator(GhostMessageAggregator* aggregator) override;
 };
 } // namespace seissol::time_stepping
 
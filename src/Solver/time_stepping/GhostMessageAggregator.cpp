@@ -0,0 +1,265 @@
+#include "GhostMessageAggregator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <map>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+namespace seissol::time_stepping {
+
+GhostMessageAggregator::GhostMessageAggregator(const std::vector<const MeshStructure*>& meshStructures)
+    : sendSlots(meshStructures.size()), receiveSlots(meshStructures.size()),
+      sendCompleted(meshStructures.size()), receiveCompleted(meshStructures.size()),
+      aggregatedRegions(meshStructures.size()) {
+  const auto numberOfGlobalClusters = static_cast<int>(meshStructures.size());
+  // Tags above the ones of the direct messages, see LtsLayout for the identifiers
+  const int tagOffset = timeData + numberOfGlobalClusters * numberOfGlobalClusters;
+
+  for (unsigned mask = 0; mask < NumberOfMasks; ++mask) {
+    headers[mask] = static_cast<real>(mask);
+  }
+
+  std::map<std::pair<int, int>, std::size_t> sendMessageIds;
+  std::map<std::pair<int, int>, std::size_t> receiveMessageIds;
+  for (int localCluster = 0; localCluster < numberOfGlobalClusters; ++localCluster) {
+    const auto* meshStructure = meshStructures[localCluster];
+    if (meshStructure == nullptr) {
+      continue;
+    }
+    sendCompleted[localCluster].assign(meshStructure->numberOfRegions, true);
+    receiveCompleted[localCluster].assign(meshStructure->numberOfRegions, true);
+    for (unsigned region = 0; region < meshStructure->numberOfRegions; ++region) {
+      const int rank = meshStructure->neighboringClusters[region][0];
+      const int otherCluster = meshStructure->neighboringClusters[region][1];
+      // The constituent index and the mask bit of a region are derived from the cluster difference
+      if (std::abs(otherCluster - localCluster) > 1) {
+        logError() << "Ghost message aggregation requires that cluster" << localCluster
+                   << "only exchanges regions with the clusters" << localCluster - 1 << "to"
+                   << localCluster + 1 << ", but it exchanges with cluster" << otherCluster
+                   << "of rank" << rank << ".";
+      }
+
+      // Messages are identified by the rank and the sending cluster, the constituents by the receiving cluster
+      const auto sendKey = std::make_pair(rank, localCluster);
+      if (sendMessageIds.find(sendKey) == sendMessageIds.end()) {
+        sendMessageIds[sendKey] = sendMessages.size();
+        auto& message = sendMessages.emplace_back();
+        message.rank = rank;
+        message.tag = tagOffset + localCluster;
+        message.datatypes.fill(MPI_DATATYPE_NULL);
+      }
+      const Slot sendSlot{sendMessageIds[sendKey], static_cast<unsigned>(otherCluster - localCluster + 1)};
+      sendMessages[sendSlot.message].constituents[sendSlot.constituent] =
+          Constituent{meshStructure->copyRegions[region],
+                      meshStructure->copyRegionSizes[region],
+                      localCluster,
+                      region};
+      sendSlots[localCluster].push_back(sendSlot);
+
+      const auto receiveKey = std::make_pair(rank, otherCluster);
+      if (receiveMessageIds.find(receiveKey) == receiveMessageIds.end()) {
+        receiveMessageIds[receiveKey] = receiveMessages.size();
+        auto& message = receiveMessages.emplace_back();
+        message.rank = rank;
+        message.tag = tagOffset + otherCluster;
+      }
+      const Slot receiveSlot{receiveMessageIds[receiveKey],
+                             static_cast<unsigned>(localCluster - otherCluster + 1)};
+      receiveMessages[receiveSlot.message].constituents[receiveSlot.constituent] =
+          Constituent{meshStructure->ghostRegions[region],
+                      meshStructure->ghostRegionSizes[region],
+                      localCluster,
+                      region};
+      receiveSlots[localCluster].push_back(receiveSlot);
+    }
+  }
+
+  // Channels with a single region are not aggregated, but sent directly from and to the region
+  auto isAggregatedMessage = [](const auto& message) {
+    return std::count_if(message.constituents.begin(),
+                         message.constituents.end(),
+                         [](const Constituent& constituent) { return constituent.data != nullptr; }) > 1;
+  };
+  for (int localCluster = 0; localCluster < numberOfGlobalClusters; ++localCluster) {
+    for (const auto& slot : sendSlots[localCluster]) {
+      aggregatedRegions[localCluster].push_back(isAggregatedMessage(sendMessages[slot.message]));
+    }
+  }
+  std::size_t numberOfChannels = 0;
+  for (auto& message : receiveMessages) {
+    if (isAggregatedMessage(message)) {
+      unsigned maxSize = 1;
+      for (const auto& constituent : message.constituents) {
+        maxSize += constituent.size;
+      }
+      message.staging.resize(maxSize);
+      postReceive(message);
+      ++numberOfChannels;
+    }
+  }
+
+  logInfo(MPI::mpi.rank()) << "Aggregating ghost messages of" << numberOfChannels << "receive channels.";
+}
+
+MPI_Datatype GhostMessageAggregator::getDatatype(SendMessage& message, unsigned mask) {
+  auto& datatype = message.datatypes[mask];
+  if (datatype == MPI_DATATYPE_NULL) {
+    std::vector<int> blockLengths;
+    std::vector<MPI_Aint> displacements;
+    MPI_Aint address;
+    MPI_Get_address(&headers[mask], &address);
+    blockLengths.push_back(1);
+    displacements.push_back(address);
+    for (unsigned i = 0; i < MaxConstituents; ++i) {
+      if ((mask & (1U << i)) != 0) {
+        MPI_Get_address(message.constituents[i].data, &address);
+        blockLengths.push_back(static_cast<int>(message.constituents[i].size));
+        displacements.push_back(address);
+      }
+    }
+    MPI_Type_create_hindexed(static_cast<int>(blockLengths.size()),
+                             blockLengths.data(),
+                             displacements.data(),
+                             MPI_C_REAL,
+                             &datatype);
+    MPI_Type_commit(&datatype);
+  }
+  return datatype;
+}
+
+void GhostMessageAggregator::postReceive(ReceiveMessage& message) {
+  MPI_Irecv(message.staging.data(),
+            static_cast<int>(message.staging.size()),
+            MPI_C_REAL,
+            message.rank,
+            message.tag,
+            MPI::mpi.comm(),
+            &message.request);
+}
+
+void GhostMessageAggregator::unpack(ReceiveMessage& message) {
+  const auto mask = static_cast<unsigned>(message.staging[0]);
+  const real* data = message.staging.data() + 1;
+  for (unsigned i = 0; i < MaxConstituents; ++i) {
+    if ((mask & (1U << i)) == 0) {
+      continue;
+    }
+    const auto& constituent = message.constituents[i];
+    if (message.waiting[i]) {
+      assert(message.arrived[i].empty());
+      std::copy_n(data, constituent.size, constituent.data);
+      message.waiting[i] = false;
+      receiveCompleted[constituent.localClusterId][constituent.region] = true;
+    } else {
+      message.arrived[i].emplace_back(data, data + constituent.size);
+    }
+    data += constituent.size;
+  }
+}
+
+void GhostMessageAggregator::send(int globalClusterId, unsigned region) {
+  const auto& slot = sendSlots[globalClusterId][region];
+  auto& message = sendMessages[slot.message];
+  assert((message.pendingMask & (1U << slot.constituent)) == 0);
+  message.pendingMask |= 1U << slot.constituent;
+  sendCompleted[globalClusterId][region] = false;
+}
+
+bool GhostMessageAggregator::isAggregated(int globalClusterId, unsigned region) const {
+  return aggregatedRegions[globalClusterId][region] != 0;
+}
+
+bool GhostMessageAggregator::isSendCompleted(int globalClusterId, unsigned region) const {
+  return sendCompleted[globalClusterId][region] != 0;
+}
+
+void GhostMessageAggregator::receive(int globalClusterId, unsigned region) {
+  const auto& slot = receiveSlots[globalClusterId][region];
+  auto& message = receiveMessages[slot.message];
+  assert(!message.waiting[slot.constituent]);
+  auto& arrived = message.arrived[slot.constituent];
+  if (arrived.empty()) {
+    message.waiting[slot.constituent] = true;
+    receiveCompleted[globalClusterId][region] = false;
+  } else {
+    const auto& constituent = message.constituents[slot.constituent];
+    std::copy(arrived.front().begin(), arrived.front().end(), constituent.data);
+    arrived.pop_front();
+    receiveCompleted[globalClusterId][region] = true;
+  }
+}
+
+bool GhostMessageAggregator::isReceiveCompleted(int globalClusterId, unsigned region) const {
+  return receiveCompleted[globalClusterId][region] != 0;
+}
+
+void GhostMessageAggregator::progress() {
+  SCOREP_USER_REGION("GhostMessageAggregator::progress", SCOREP_USER_REGION_TYPE_FUNCTION)
+  for (auto& message : sendMessages) {
+    if (message.pendingMask != 0) {
+      // The datatype includes the header, which only depends on the mask
+      MPI_Request request;
+      MPI_Isend(MPI_BOTTOM,
+                1,
+                getDatatype(message, message.pendingMask),
+                message.rank,
+                message.tag,
+                MPI::mpi.comm(),
+                &request);
+      message.requests.emplace_back(request, message.pendingMask);
+      message.pendingMask = 0;
+    }
+    for (auto request = message.requests.begin(); request != message.requests.end();) {
+      int testSuccess = 0;
+      MPI_Test(&request->first, &testSuccess, MPI_STATUS_IGNORE);
+      if (testSuccess) {
+        for (unsigned i = 0; i < MaxConstituents; ++i) {
+          if ((request->second & (1U << i)) != 0) {
+            const auto& constituent = message.constituents[i];
+            sendCompleted[constituent.localClusterId][constituent.region] = true;
+          }
+        }
+        request = message.requests.erase(request);
+      } else {
+        ++request;
+      }
+    }
+  }
+
+  for (auto& message : receiveMessages) {
+    if (message.request == MPI_REQUEST_NULL) {
+      continue;
+    }
+    int testSuccess = 1;
+    // Several messages of the same channel may have arrived
+    while (testSuccess) {
+      MPI_Test(&message.request, &testSuccess, MPI_STATUS_IGNORE);
+      if (testSuccess) {
+        unpack(message);
+        postReceive(message);
+      }
+    }
+  }
+}
+
+void GhostMessageAggregator::freeResources() {
+  for (auto& message : receiveMessages) {
+    if (message.request != MPI_REQUEST_NULL) {
+      MPI_Cancel(&message.request);
+      MPI_Wait(&message.request, MPI_STATUS_IGNORE);
+    }
+  }
+  for (auto& message : sendMessages) {
+    assert(message.requests.empty());
+    for (auto& datatype : message.datatypes) {
+      if (datatype != MPI_DATATYPE_NULL) {
+        MPI_Type_free(&datatype);
+      }
+    }
+  }
+}
+
+} // namespace seissol::time_stepping
@@ -0,0 +1,125 @@
+#ifndef SEISSOL_GHOSTMESSAGEAGGREGATOR_H
+#define SEISSOL_GHOSTMESSAGEAGGREGATOR_H
+
+#include <array>
+#include <deque>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "Initializer/typedefs.hpp"
+
+namespace seissol::time_stepping {
+
+/**
+ * Aggregates the copy regions which are sent to the same rank by the same local cluster.
+ *
+ * A local cluster g exchanges copy regions with at most three clusters of a neighboring rank,
+ * namely g-1, g and g+1. Each of these regions is sent by a separate ghost cluster. The aggregator
+ * collects the regions which are sent within one progress() call and sends them as a single message.
+ * The message starts with a header which contains a bit mask of the included regions.
+ *
+ * Sends do not copy: the message is described by an MPI datatype with the absolute addresses of the
+ * header and the copy regions, which is cached per bit mask. Regions which are the only ones of
+ * their (rank, cluster) pair are not aggregated at all, such that they keep the contiguous path
+ * without header and staging buffer.
+ * Receives are posted once per (rank, cluster) pair into a staging buffer. On arrival, each region is
+ * copied directly to its ghost region if the ghost cluster already waits for it, and queued otherwise.
+ *
+ * All functions have to be called from the same thread, i.e. the thread which progresses the ghost clusters.
+ **/
+class GhostMessageAggregator {
+ private:
+  static constexpr unsigned MaxConstituents = 3;
+  static constexpr unsigned NumberOfMasks = 1U << MaxConstituents;
+
+  //! a copy or ghost region of a message
+  struct Constituent {
+    real* data = nullptr;
+    unsigned size = 0;
+    int localClusterId = -1;
+    unsigned region = 0;
+  };
+
+  struct SendMessage {
+    int rank;
+    int tag;
+    std::array<Constituent, MaxConstituents> constituents{};
+    //! regions which were sent by the ghost clusters, but not by the aggregator
+    unsigned pendingMask = 0;
+    std::array<MPI_Datatype, NumberOfMasks> datatypes{};
+    std::list<std::pair<MPI_Request, unsigned>> requests;
+  };
+
+  struct ReceiveMessage {
+    int rank;
+    int tag;
+    std::array<Constituent, MaxConstituents> constituents{};
+    std::vector<real> staging;
+    MPI_Request request = MPI_REQUEST_NULL;
+    //! regions which arrived before the ghost cluster posted its receive
+    std::array<std::deque<std::vector<real>>, MaxConstituents> arrived;
+    //! regions for which the ghost cluster posted a receive which did not arrive yet
+    std::array<bool, MaxConstituents> waiting{};
+  };
+
+  //! position of a region of a mesh structure in the messages
+  struct Slot {
+    std::size_t message;
+    unsigned constituent;
+  };
+
+  std::vector<SendMessage> sendMessages;
+  std::vector<ReceiveMessage> receiveMessages;
+
+  //! slots of the regions, indexed by global cluster id and region
+  std::vector<std::vector<Slot>> sendSlots;
+  std::vector<std::vector<Slot>> receiveSlots;
+
+  //! completion of the regions, indexed by global cluster id and region
+  std::vector<std::vector<char>> sendCompleted;
+  std::vector<std::vector<char>> receiveCompleted;
+
+  //! true if the region is exchanged with other regions in one message, indexed by global cluster id and region
+  std::vector<std::vector<char>> aggregatedRegions;
+
+  //! the header of a message with the given mask; the addresses have to be fixed for the cached datatypes
+  std::array<real, NumberOfMasks> headers{};
+
+  MPI_Datatype getDatatype(SendMessage& message, unsigned mask);
+  void postReceive(ReceiveMessage& message);
+  void unpack(ReceiveMessage& message);
+
+ public:
+  /**
+   * @param meshStructures the mesh structure of each local cluster, indexed by global cluster id.
+   *        Entries of global clusters which do not exist on this rank are nullptr.
+   **/
+  explicit GhostMessageAggregator(const std::vector<const MeshStructure*>& meshStructures);
+
+  GhostMessageAggregator(const GhostMessageAggregator&) = delete;
+  GhostMessageAggregator& operator=(const GhostMessageAggregator&) = delete;
+
+  //! false if the region is the only one of its channel and has to be exchanged directly by the ghost cluster
+  [[nodiscard]] bool isAggregated(int globalClusterId, unsigned region) const;
+
+  //! Schedules the copy region for sending with the next progress()
+  void send(int globalClusterId, unsigned region);
+
+  [[nodiscard]] bool isSendCompleted(int globalClusterId, unsigned region) const;
+
+  //! Marks the ghost region as ready to receive the next message
+  void receive(int globalClusterId, unsigned region);
+
+  [[nodiscard]] bool isReceiveCompleted(int globalClusterId, unsigned region) const;
+
+  //! Sends the scheduled regions and tests for finished sends and arrived messages
+  void progress();
+
+  //! Cancels the posted receives and frees the datatypes; has to be called before MPI is finalized
+  void freeResources();
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_GHOSTMESSAGEAGGREGATOR_H
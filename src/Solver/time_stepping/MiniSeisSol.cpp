@@ -43,6 +43,9 @@
 #include <Kernels/Time.h>
 #include <Kernels/Local.h>
 #include <Monitoring/Stopwatch.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include "utils/env.h"
 
 #ifdef ACL_DEVICE
@@ -87,12 +90,39 @@ Config getConfig() {
   }
   return config;
 }
+
+initializers::Layer& setupInterior(initializers::LTSTree& ltsTree,
+                                   initializers::LTS& lts,
+                                   bool usePlasticity,
+                                   int numElements) {
+  lts.addTo(ltsTree, usePlasticity);
+  ltsTree.setNumberOfTimeClusters(1);
+  ltsTree.fixate();
+
+  initializers::TimeCluster& cluster = ltsTree.child(0);
+  cluster.child<Ghost>().setNumberOfCells(0);
+  cluster.child<Copy>().setNumberOfCells(0);
+  cluster.child<Interior>().setNumberOfCells(numElements);
+
+  ltsTree.allocateVariables();
+  ltsTree.touchVariables();
+
+  initializers::Layer& layer = cluster.child<Interior>();
+
+  layer.setBucketSize(lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
+  ltsTree.allocateBuckets();
+
+  fakeData(lts, layer);
+  return layer;
+}
 } // namespace seissol::mini
 
 
 void seissol::localIntegration(GlobalData* globalData,
                                initializers::LTS& lts,
-                               initializers::Layer& layer) {
+                               initializers::Layer& layer,
+                               unsigned numberOfCells) {
+  assert(numberOfCells <= layer.getNumberOfCells());
   kernels::Local localKernel;
   localKernel.setHostGlobalData(globalData);
   kernels::Time  timeKernel;
@@ -107,7 +137,7 @@ void seissol::localIntegration(GlobalData* globalData,
 #ifdef _OPENMP
   #pragma omp parallel for private(tmp) schedule(static)
 #endif
-  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
     auto data = loader.entry(cell);
     timeKernel.computeAder(miniSeisSolTimeStep,
                            data,
@@ -210,6 +240,20 @@ void seissol::fakeData(initializers::LTS& lts,
   fillWithStuff(reinterpret_cast<real*>(localIntegration), sizeof(LocalIntegrationData)/sizeof(real) * layer.getNumberOfCells());
   fillWithStuff(reinterpret_cast<real*>(neighboringIntegration), sizeof(NeighboringIntegrationData)/sizeof(real) * layer.getNumberOfCells());
 
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  // All faces share one set of Godunov states; the face geometry has to be a valid orthonormal basis
+  static FaceGodunovStates godunovStates;
+  fillWithStuff(reinterpret_cast<real*>(&godunovStates), sizeof(FaceGodunovStates)/sizeof(real));
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    for (auto& face : neighboringIntegration[cell].faces) {
+      face = FaceFluxSolverData{&godunovStates, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, 1.0};
+    }
+  }
+#endif
+
 #ifdef USE_POROELASTIC
 #ifdef _OPENMP
   #pragma omp parallel for schedule(static)
@@ -224,30 +268,13 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
   initializers::LTSTree ltsTree;
   initializers::LTS     lts;
 
-  lts.addTo(ltsTree, usePlasticity);
-  ltsTree.setNumberOfTimeClusters(1);
-  ltsTree.fixate();
-
   auto config = mini::getConfig();
   const auto rank = seissol::MPI::mpi.rank();
   logInfo(rank) << "miniSeisSol configured with"
                 << config.numElements << "elements and"
                 << config.numRepeats << "repeats per process";
 
-  initializers::TimeCluster& cluster = ltsTree.child(0);
-  cluster.child<Ghost>().setNumberOfCells(0);
-  cluster.child<Copy>().setNumberOfCells(0);
-  cluster.child<Interior>().setNumberOfCells(config.numElements);
-
-  ltsTree.allocateVariables();
-  ltsTree.touchVariables();
-  
-  initializers::Layer& layer = cluster.child<Interior>();
-  
-  layer.setBucketSize(lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer.getNumberOfCells());
-  ltsTree.allocateBuckets();
-
-  fakeData(lts, layer);
+  initializers::Layer& layer = mini::setupInterior(ltsTree, lts, usePlasticity, config.numElements);
 
 #ifdef ACL_DEVICE
   seissol::initializers::MemoryManager::deriveRequiredScratchpadMemoryForWp(ltsTree, lts);
@@ -271,7 +298,7 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
 #else
   auto* globalData = memoryManager.getGlobalDataOnHost();
   auto runBenchmark = [globalData, &lts, &layer]() {
-    localIntegration(globalData, lts, layer);
+    localIntegration(globalData, lts, layer, layer.getNumberOfCells());
   };
   auto syncBenchmark = []() {};
 #endif
@@ -288,3 +315,63 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
 
   return stopwatch.stop();
 }
+
+double seissol::miniSeisSolClusterOverhead(initializers::MemoryManager& memoryManager,
+                                           bool usePlasticity) {
+  const auto rank = seissol::MPI::mpi.rank();
+#ifdef ACL_DEVICE
+  logWarning(rank) << "The fixed cost per cluster time step cannot be measured on GPUs and is ignored.";
+  return 0.0;
+#else
+  initializers::LTSTree ltsTree;
+  initializers::LTS     lts;
+
+  auto config = mini::getConfig();
+  initializers::Layer& layer = mini::setupInterior(ltsTree, lts, usePlasticity, config.numElements);
+  auto* globalData = memoryManager.getGlobalDataOnHost();
+
+  auto timePerStep = [&](unsigned numberOfCells, unsigned numRepeats) {
+    localIntegration(globalData, lts, layer, numberOfCells);
+    Stopwatch stopwatch;
+    stopwatch.start();
+    for (unsigned t = 0; t < numRepeats; ++t) {
+      localIntegration(globalData, lts, layer, numberOfCells);
+    }
+    return stopwatch.stop() / numRepeats;
+  };
+
+  // Least-squares fit of time = constant + perElement * numberOfCells over cluster sizes, as in
+  // LoopStatistics::printSummary. Smaller clusters are repeated more often to reduce noise.
+  constexpr unsigned MaxRepeatFactor = 1000;
+  const unsigned maxNumberOfCells = config.numElements;
+  double x = 0.0, x2 = 0.0, xy = 0.0, y = 0.0, N = 0.0;
+  for (unsigned numberOfCells = maxNumberOfCells; numberOfCells > 0; numberOfCells /= 8) {
+    const unsigned numRepeats =
+        config.numRepeats * std::min(maxNumberOfCells / numberOfCells, MaxRepeatFactor);
+    const double time = timePerStep(numberOfCells, numRepeats);
+    x += numberOfCells;
+    x2 += static_cast<double>(numberOfCells) * static_cast<double>(numberOfCells);
+    xy += numberOfCells * time;
+    y += time;
+    N += 1.0;
+  }
+  const double det = N * x2 - x * x;
+  const double constant = (x2 * y - x * xy) / det;
+  const double perElement = (-x * y + N * xy) / det;
+
+  // The fixed cost is measured in units of the cost of an element
+  double overhead = constant / perElement;
+  if (!std::isfinite(overhead) || overhead < 0.0) {
+    overhead = 0.0;
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &overhead, 1, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+  overhead /= seissol::MPI::mpi.size();
+#endif
+
+  logInfo(rank) << "miniSeisSol: The fixed cost per cluster time step corresponds to" << overhead
+                << "elements.";
+  return overhead;
+#endif
+}
@@ -46,7 +46,8 @@
 namespace seissol {
   void localIntegration(GlobalData* globalData,
                         initializers::LTS& lts,
-                        initializers::Layer& layer);
+                        initializers::Layer& layer,
+                        unsigned numberOfCells);
 
   void localIntegrationOnDevice(CompoundGlobalData& globalData,
                                 initializers::LTS& lts,
@@ -60,6 +61,13 @@ namespace seissol {
                 FaceType faceTp = FaceType::regular);
   
   double miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity);
+
+  /**
+   * Measures the fixed cost of a time step of a cluster, e.g. the overhead of the parallel
+   * region and the low thread utilization of small clusters, in units of the cost of an element.
+   * The result is the same on all ranks.
+   */
+  double miniSeisSolClusterOverhead(initializers::MemoryManager& memoryManager, bool usePlasticity);
   constexpr real miniSeisSolTimeStep = 1.0;
 } //namespace seissol
 
@@ -0,0 +1,102 @@
+#include "NeighborIntegrationCache.h"
+
+#include <map>
+#include <utility>
+
+#include "Kernels/Time.h"
+#include "Kernels/TimeBuffers.h"
+
+namespace seissol::time_stepping {
+
+NeighborIntegrationCache::NeighborIntegrationCache(const CellLocalInformation* cellInformation,
+                                                   real* const (*faceNeighbors)[4],
+                                                   unsigned numberOfCells) {
+  // Same conditions as in TimeCommon::computeIntegrals
+  auto isIntegrated = [&](unsigned cell, unsigned face) {
+    const auto& information = cellInformation[cell];
+    return information.faceTypes[face] != FaceType::outflow
+           && information.faceTypes[face] != FaceType::dynamicRupture
+           && (information.ltsSetup >> face) % 2 == 1;
+  };
+  auto key = [&](unsigned cell, unsigned face) {
+    const bool expandedAtStart = (cellInformation[cell].ltsSetup >> (face + 4)) % 2 == 1;
+    return std::make_pair(static_cast<const real*>(faceNeighbors[cell][face]), expandedAtStart);
+  };
+
+  std::map<std::pair<const real*, bool>, std::size_t> numberOfConsumers;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      if (isIntegrated(cell, face)) {
+        ++numberOfConsumers[key(cell, face)];
+      }
+    }
+  }
+
+  std::map<std::pair<const real*, bool>, std::size_t> entryIds;
+  for (const auto& [derivatives, consumers] : numberOfConsumers) {
+    if (consumers > 1) {
+      entryIds[derivatives] = entries.size();
+      entries.push_back(Entry{derivatives.first, derivatives.second, nullptr});
+    }
+  }
+  if (entries.empty()) {
+    return;
+  }
+
+  auto* timeIntegrated = static_cast<real*>(
+      allocator.allocateMemory(entries.size() * tensor::I::size() * sizeof(real), ALIGNMENT));
+  for (auto& entry : entries) {
+    entry.timeIntegrated = timeIntegrated;
+    timeIntegrated += tensor::I::size();
+  }
+
+  cachedFaces.resize(numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      cachedFaces[cell][face] = nullptr;
+      if (isIntegrated(cell, face)) {
+        const auto entry = entryIds.find(key(cell, face));
+        if (entry != entryIds.end()) {
+          cachedFaces[cell][face] = entries[entry->second].timeIntegrated;
+        }
+      }
+    }
+  }
+}
+
+void NeighborIntegrationCache::integrate(kernels::Time& time, double subTimeStart, double timeStepWidth) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    const auto& entry = entries[i];
+    const real* derivatives = entry.derivatives;
+    alignas(ALIGNMENT) real convertedDerivatives[kernels::ReducedPrecisionDerivatives ? yateto::computeFamilySize<tensor::dQ>() : 1];
+    if constexpr (kernels::ReducedPrecisionDerivatives) {
+      kernels::loadDerivatives(derivatives, convertedDerivatives);
+      derivatives = convertedDerivatives;
+    }
+    time.computeIntegral(entry.expandedAtStart ? subTimeStart : 0.0,
+                         subTimeStart,
+                         subTimeStart + timeStepWidth,
+                         derivatives,
+                         entry.timeIntegrated);
+  }
+}
+
+unsigned short NeighborIntegrationCache::useCachedIntegrals(unsigned cell,
+                                                            unsigned short ltsSetup,
+                                                            real* timeDofs[4]) const {
+  if (entries.empty()) {
+    return ltsSetup;
+  }
+  for (unsigned face = 0; face < 4; ++face) {
+    if (cachedFaces[cell][face] != nullptr) {
+      timeDofs[face] = cachedFaces[cell][face];
+      ltsSetup &= ~(1U << face);
+    }
+  }
+  return ltsSetup;
+}
+
+} // namespace seissol::time_stepping
@@ -0,0 +1,63 @@
+#ifndef SEISSOL_NEIGHBORINTEGRATIONCACHE_H
+#define SEISSOL_NEIGHBORINTEGRATIONCACHE_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "Initializer/typedefs.hpp"
+#include "Initializer/MemoryAllocator.h"
+
+namespace seissol::kernels {
+class Time;
+} // namespace seissol::kernels
+
+namespace seissol::time_stepping {
+
+/**
+ * Time integrated DOFs of face neighbors which provide time derivatives to several faces of a layer.
+ *
+ * In the neighboring integration, a face whose neighbor provides derivatives integrates them over the
+ * time step of the cell. A cell with a large time step next to several cells with a smaller time step
+ * is hence integrated once per face. The cache integrates such derivatives once per correction, and
+ * all faces read the result. Derivatives which are integrated by a single face are not cached, as
+ * their integration in the cell loop stays in the per-thread buffer.
+ **/
+class NeighborIntegrationCache {
+ private:
+  memory::ManagedAllocator allocator;
+
+  struct Entry {
+    const real* derivatives;
+    //! true if the derivatives are expanded around the start of the sub-interval, see bits 4-7 of the LTS setup
+    bool expandedAtStart;
+    real* timeIntegrated;
+  };
+  std::vector<Entry> entries;
+
+  //! cached time integrated DOFs of each face of the layer, nullptr if the face is not cached
+  std::vector<std::array<real*, 4>> cachedFaces;
+
+ public:
+  NeighborIntegrationCache(const CellLocalInformation* cellInformation,
+                           real* const (*faceNeighbors)[4],
+                           unsigned numberOfCells);
+
+  //! Number of derivatives which are shared by several faces
+  [[nodiscard]] std::size_t numberOfEntries() const { return entries.size(); }
+
+  //! Integrates the shared derivatives over [subTimeStart, subTimeStart + timeStepWidth], see TimeCommon::computeIntegrals
+  void integrate(kernels::Time& time, double subTimeStart, double timeStepWidth);
+
+  /**
+   * Replaces the derivatives of the cached faces of the cell by their time integrated DOFs.
+   *
+   * @param timeDofs the face neighbors of the cell, which are replaced for cached faces.
+   * @return the LTS setup of the cell, in which the cached faces are marked as time integrated.
+   **/
+  unsigned short useCachedIntegrals(unsigned cell, unsigned short ltsSetup, real* timeDofs[4]) const;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_NEIGHBORINTEGRATIONCACHE_H
@@ -0,0 +1,15 @@
+#include <utility>
+
+#include "PassedSyncPoints.h"
+
+namespace seissol::time_stepping {
+
+PassedSyncPoints::PassedSyncPoints(SyncHook syncHook) : syncHook(std::move(syncHook)) {}
+
+void PassedSyncPoints::update(double minCorrectionTime, double timeTolerance) {
+  if (minCorrectionTime > nextSyncTime + timeTolerance) {
+    nextSyncTime = syncHook(minCorrectionTime, timeTolerance);
+  }
+}
+
+} // namespace seissol::time_stepping
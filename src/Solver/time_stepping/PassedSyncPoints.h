@@ -0,0 +1,48 @@
+#ifndef SEISSOL_PASSEDSYNCPOINTS_H
+#define SEISSOL_PASSEDSYNCPOINTS_H
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace seissol::time_stepping {
+
+/**
+ * Calls the synchronization points of the modules which do not require synchronized clusters,
+ * once all local clusters passed them, i.e. between two cluster updates.
+ **/
+class PassedSyncPoints {
+ public:
+  //! Calls all passed synchronization points and returns the next one, see Modules::callPassiveSyncHook
+  using SyncHook = std::function<double(double currentTime, double timeTolerance)>;
+
+ private:
+  SyncHook syncHook;
+
+  //! next synchronization point of the hook
+  double nextSyncTime = -std::numeric_limits<double>::infinity();
+
+ public:
+  explicit PassedSyncPoints(SyncHook syncHook);
+
+  //! Calls the hook if all clusters passed the next synchronization point
+  template <typename ClusterPointer>
+  void update(const std::vector<ClusterPointer>& clusters, double timeTolerance) {
+    if (clusters.empty()) {
+      return;
+    }
+    double minCorrectionTime = std::numeric_limits<double>::infinity();
+    for (const auto& cluster : clusters) {
+      minCorrectionTime = std::min(minCorrectionTime, cluster->getCorrectionTime());
+    }
+    update(minCorrectionTime, timeTolerance);
+  }
+
+  //! Calls the hook if the time reached by all clusters passed the next synchronization point
+  void update(double minCorrectionTime, double timeTolerance);
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_PASSEDSYNCPOINTS_H
@@ -0,0 +1,41 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+#include "ThreadGroups.h"
+
+namespace seissol::time_stepping {
+
+std::vector<int> partitionThreads(const std::vector<double>& costs, int numThreads) {
+  const auto numItems = static_cast<int>(costs.size());
+  assert(numItems > 0 && numItems <= numThreads);
+
+  auto totalCost = std::accumulate(costs.begin(), costs.end(), 0.0);
+  auto cost = [&](int item) { return totalCost > 0.0 ? costs[item] : 1.0; };
+  if (totalCost <= 0.0) {
+    totalCost = numItems;
+  }
+
+  std::vector<int> threads(numItems, 1);
+  std::vector<double> deficit(numItems);
+  auto remaining = numThreads - numItems;
+  for (int item = 0; item < numItems; ++item) {
+    const auto ideal = numThreads * cost(item) / totalCost;
+    const auto extra = std::min(remaining, std::max(0, static_cast<int>(std::floor(ideal)) - 1));
+    threads[item] += extra;
+    remaining -= extra;
+    deficit[item] = ideal - threads[item];
+  }
+
+  // Largest remainder method for the threads which are left over
+  for (; remaining > 0; --remaining) {
+    const auto item = std::distance(deficit.begin(), std::max_element(deficit.begin(), deficit.end()));
+    ++threads[item];
+    deficit[item] -= 1.0;
+  }
+  return threads;
+}
+
+} // namespace seissol::time_stepping
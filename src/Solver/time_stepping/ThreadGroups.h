@@ -0,0 +1,17 @@
+#ifndef SEISSOL_THREADGROUPS_H
+#define SEISSOL_THREADGROUPS_H
+
+#include <vector>
+
+namespace seissol::time_stepping {
+
+/**
+ * Splits numThreads threads into one sub-team per work item, proportional to the given costs.
+ * Every item gets at least one thread and all threads are handed out, hence costs.size() must
+ * not exceed numThreads.
+ **/
+std::vector<int> partitionThreads(const std::vector<double>& costs, int numThreads);
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_THREADGROUPS_H
@@ -84,6 +84,7 @@
 #include <Monitoring/FlopCounter.hpp>
 #include <Monitoring/instrumentation.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -151,6 +152,7 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
+  m_regionComputePlasticity = m_loopStatistics->getRegion("computePlasticity");
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -217,12 +219,21 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
 #endif
   for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
     unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+    const real* derivativesPlus = timeDerivativePlus[face];
+    const real* derivativesMinus = timeDerivativeMinus[face];
+    alignas(ALIGNMENT) real convertedDerivatives[kernels::ReducedPrecisionDerivatives ? 2 : 1][yateto::computeFamilySize<tensor::dQ>()];
+    if constexpr (kernels::ReducedPrecisionDerivatives) {
+      kernels::loadDerivatives(derivativesPlus, convertedDerivatives[0]);
+      kernels::loadDerivatives(derivativesMinus, convertedDerivatives[1]);
+      derivativesPlus = convertedDerivatives[0];
+      derivativesMinus = convertedDerivatives[1];
+    }
     m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
                                                   m_globalDataOnHost,
                                                   &godunovData[face],
                                                   &drEnergyOutput[face],
-                                                  timeDerivativePlus[face],
-                                                  timeDerivativeMinus[face],
+                                                  derivativesPlus,
+                                                  derivativesMinus,
                                                   qInterpolatedPlus[face],
                                                   qInterpolatedMinus[face],
                                                   timeDerivativePlus[prefetchFace],
@@ -318,17 +329,67 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::i
   }
 }
 
+unsigned int seissol::time_stepping::TimeCluster::getNumberOfLocalIntegrationChunks() const {
+  // The cells of the copy layer are ordered by communication region. If requested, every region
+  // is processed as a chunk and published for sending as soon as it is finished.
+  return copyRegionProgress != nullptr ? copyRegionProgress->numberOfRegions() + 1 : 1;
+}
+
+unsigned int seissol::time_stepping::TimeCluster::getLocalIntegrationChunkEnd(seissol::initializers::Layer& layerData,
+                                                                              unsigned int chunk) const {
+  return chunk + 1 < getNumberOfLocalIntegrationChunks() ? copyRegionProgress->regionEnd(chunk)
+                                                         : layerData.getNumberOfCells();
+}
+
+#ifdef HOST_CELL_BATCH
+void seissol::time_stepping::TimeCluster::packCellBatches(seissol::initializers::Layer& layerData) {
+  kernels::LocalData::Loader loader;
+  loader.load(*m_lts, layerData);
+
+  // the batches of computeLocalIntegration which are full, i.e. which do not reach the end of their chunk
+  std::vector<unsigned int> batchBegins;
+  unsigned int chunkBegin = 0;
+  for (unsigned int chunk = 0; chunk < getNumberOfLocalIntegrationChunks(); ++chunk) {
+    const unsigned int chunkEnd = getLocalIntegrationChunkEnd(layerData, chunk);
+    for (unsigned int batchBegin = chunkBegin; batchBegin + kernels::CellBatchSize <= chunkEnd;
+         batchBegin += kernels::CellBatchSize) {
+      batchBegins.push_back(batchBegin);
+    }
+    chunkBegin = chunkEnd;
+  }
+
+  cellBatchMatrices.resize(batchBegins.size());
+  cellBatchMatricesOfCell.assign(layerData.getNumberOfCells(), nullptr);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t batch = 0; batch < batchBegins.size(); ++batch) {
+    if (m_localKernel.packCellBatchMatrices(loader, batchBegins[batch], cellBatchMatrices[batch])) {
+      cellBatchMatricesOfCell[batchBegins[batch]] = &cellBatchMatrices[batch];
+    }
+  }
+  hasPackedCellBatches = true;
+}
+#endif
+
 #ifndef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   m_loopStatistics->begin(m_regionComputeLocalIntegration);
 
-  // local integration buffer
-  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
+  // local integration buffers, one per cell of a batch
+  real l_integrationBuffer[kernels::CellBatchSize][tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
 
-  // pointer for the call of the ADER-function
-  real* l_bufferPointer;
+  // pointers for the call of the ADER-function
+  real* l_bufferPointer[kernels::CellBatchSize];
+
+  // derivatives of cells which do not store them, needed for the wave field snapshot,
+  // or of cells which store them in reduced precision
+  real l_snapshotDerivatives[kernels::CellBatchSize][yateto::computeFamilySize<tensor::dQ>()] __attribute__((aligned(ALIGNMENT)));
+  real* l_cellDerivatives[kernels::CellBatchSize];
+  const bool evaluatesSnapshot = waveFieldSnapshot != nullptr
+                                 && waveFieldSnapshot->isInStep(ct.correctionTime, timeStepSize());
 
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
@@ -338,74 +399,171 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
   loader.load(*m_lts, i_layerData);
   kernels::LocalTmp tmp{};
 
+  const unsigned int numberOfChunks = getNumberOfLocalIntegrationChunks();
+  const long predictionsAfterStep = ct.predictionsSinceStart + ct.timeStepRate;
+
+#ifdef HOST_CELL_BATCH
+  // The star matrices and flux solvers do not change, hence their batches are packed once
+  if (useFusedLocalKernel && !hasPackedCellBatches) {
+    packCellBatches(i_layerData);
+  }
+#endif
+
 #ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer, tmp) schedule(static)
+  #pragma omp parallel private(l_bufferPointer, l_integrationBuffer, l_snapshotDerivatives, l_cellDerivatives, tmp)
 #endif
-  for (unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++) {
-    auto data = loader.entry(l_cell);
-
-    // We need to check, whether we can overwrite the buffer or if it is
-    // needed by some other time cluster.
-    // If we cannot overwrite the buffer, we compute everything in a temporary
-    // local buffer and accumulate the results later in the shared buffer.
-    const bool buffersProvided = (data.cellInformation.ltsSetup >> 8) % 2 == 1; // buffers are provided
-    const bool resetMyBuffers = buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
-
-    if (resetMyBuffers) {
-      // assert presence of the buffer
-      assert(buffers[l_cell] != nullptr);
-
-      l_bufferPointer = buffers[l_cell];
-    } else {
-      // work on local buffer
-      l_bufferPointer = l_integrationBuffer;
-    }
+  {
+    unsigned int chunkBegin = 0;
+    for (unsigned int chunk = 0; chunk < numberOfChunks; ++chunk) {
+      const unsigned int chunkEnd = getLocalIntegrationChunkEnd(i_layerData, chunk);
+      // Cells are processed in batches of CellBatchSize cells, which is 1 unless the batched kernel is built
+      const unsigned int numberOfBatches = (chunkEnd - chunkBegin + kernels::CellBatchSize - 1) / kernels::CellBatchSize;
+#ifdef _OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (unsigned int batch = 0; batch < numberOfBatches; ++batch) {
+        const unsigned int batchBegin = chunkBegin + batch * kernels::CellBatchSize;
+        const unsigned int batchSize = std::min(kernels::CellBatchSize, chunkEnd - batchBegin);
+
+        for (unsigned int lane = 0; lane < batchSize; ++lane) {
+          const unsigned int l_cell = batchBegin + lane;
+          const auto& cellInformation = loader.entry(l_cell).cellInformation;
+
+          // We need to check, whether we can overwrite the buffer or if it is
+          // needed by some other time cluster.
+          // If we cannot overwrite the buffer, we compute everything in a temporary
+          // local buffer and accumulate the results later in the shared buffer.
+          const bool buffersProvided = (cellInformation.ltsSetup >> 8) % 2 == 1; // buffers are provided
+          const bool resetMyBuffers = buffersProvided && ( (cellInformation.ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
+
+          // Buffers in reduced precision are always written from the local buffer
+          if (resetMyBuffers && !kernels::ReducedPrecisionBuffers) {
+            // assert presence of the buffer
+            assert(buffers[l_cell] != nullptr);
+
+            l_bufferPointer[lane] = buffers[l_cell];
+          } else {
+            // work on local buffer
+            l_bufferPointer[lane] = l_integrationBuffer[lane];
+          }
+
+          l_cellDerivatives[lane] = derivatives[l_cell];
+          if ((evaluatesSnapshot && l_cellDerivatives[lane] == nullptr)
+              || (kernels::ReducedPrecisionDerivatives && l_cellDerivatives[lane] != nullptr)) {
+            l_cellDerivatives[lane] = l_snapshotDerivatives[lane];
+          }
+        }
 
-    m_timeKernel.computeAder(timeStepSize(),
-                             data,
-                             tmp,
-                             l_bufferPointer,
-                             derivatives[l_cell],
-                             true);
-
-    // Compute local integrals (including some boundary conditions)
-    CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
-    m_localKernel.computeIntegral(l_bufferPointer,
-                                  data,
-                                  tmp,
-                                  &materialData[l_cell],
-                                  &boundaryMapping[l_cell],
-                                  ct.correctionTime,
-                                  timeStepSize()
-    );
+        bool batchFused = false;
+#ifdef HOST_CELL_BATCH
+        const kernels::Local::CellBatchMatrices* batchMatrices =
+            useFusedLocalKernel && batchSize == kernels::CellBatchSize ? cellBatchMatricesOfCell[batchBegin] : nullptr;
+        if (batchMatrices != nullptr) {
+          m_localKernel.computeFusedIntegralBatched(timeStepSize(),
+                                                    loader,
+                                                    batchBegin,
+                                                    *batchMatrices,
+                                                    l_bufferPointer,
+                                                    l_cellDerivatives);
+          batchFused = true;
+        }
+#endif
 
-    for (unsigned face = 0; face < 4; ++face) {
-      auto& curFaceDisplacements = data.faceDisplacements[face];
-      // Note: Displacement for freeSurfaceGravity is computed in Time.cpp
-      if (curFaceDisplacements != nullptr
-          && data.cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity) {
-        kernel::addVelocity addVelocityKrnl;
-
-        addVelocityKrnl.V3mTo2nFace = m_globalDataOnHost->V3mTo2nFace;
-        addVelocityKrnl.selectVelocity = init::selectVelocity::Values;
-        addVelocityKrnl.faceDisplacement = data.faceDisplacements[face];
-        addVelocityKrnl.I = l_bufferPointer;
-        addVelocityKrnl.execute(face);
+        for (unsigned int lane = 0; lane < batchSize; ++lane) {
+          const unsigned int l_cell = batchBegin + lane;
+          auto data = loader.entry(l_cell);
+          real* cellDerivatives = l_cellDerivatives[lane];
+
+          // The fused kernel stores the derivatives before it updates the DOFs, hence the snapshot works either way
+          const bool fused = batchFused
+                             || (useFusedLocalKernel && m_localKernel.computeFusedIntegral(timeStepSize(),
+                                                                                           data,
+                                                                                           tmp,
+                                                                                           l_bufferPointer[lane],
+                                                                                           cellDerivatives));
+          if (!fused) {
+            m_timeKernel.computeAder(timeStepSize(),
+                                     data,
+                                     tmp,
+                                     l_bufferPointer[lane],
+                                     cellDerivatives,
+                                     true);
+          }
+
+          if (evaluatesSnapshot) {
+            waveFieldSnapshot->evaluate(m_timeKernel, ct.correctionTime, cellDerivatives, snapshotCellOffset + l_cell);
+          }
+
+          if (kernels::ReducedPrecisionDerivatives && derivatives[l_cell] != nullptr) {
+            kernels::storeDerivatives(cellDerivatives, derivatives[l_cell]);
+          }
+
+          if (!fused && kernels::TimeCommon::isRegularGtsCell(data.cellInformation)) {
+            // The interior is sorted by face types and LTS setup, hence this branch changes rarely from cell to cell
+            m_localKernel.computeRegularIntegral(l_bufferPointer[lane], data, tmp);
+          } else if (!fused) {
+            // Compute local integrals (including some boundary conditions)
+            CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
+            m_localKernel.computeIntegral(l_bufferPointer[lane],
+                                          data,
+                                          tmp,
+                                          &materialData[l_cell],
+                                          &boundaryMapping[l_cell],
+                                          ct.correctionTime,
+                                          timeStepSize()
+            );
+          }
+
+          for (unsigned face = 0; face < 4; ++face) {
+            auto& curFaceDisplacements = data.faceDisplacements[face];
+            // Note: Displacement for freeSurfaceGravity is computed in Time.cpp
+            if (curFaceDisplacements != nullptr
+                && data.cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity) {
+              kernel::addVelocity addVelocityKrnl;
+
+              addVelocityKrnl.V3mTo2nFace = m_globalDataOnHost->V3mTo2nFace;
+              addVelocityKrnl.selectVelocity = init::selectVelocity::Values;
+              addVelocityKrnl.faceDisplacement = data.faceDisplacements[face];
+              addVelocityKrnl.I = l_bufferPointer[lane];
+              addVelocityKrnl.execute(face);
+            }
+          }
+
+          // TODO: Integrate this step into the kernel
+          // We've used a temporary buffer -> need to accumulate update in
+          // shared buffer.
+          const bool buffersProvided = (data.cellInformation.ltsSetup >> 8) % 2 == 1;
+          if (buffersProvided && l_bufferPointer[lane] == l_integrationBuffer[lane]) {
+            assert(buffers[l_cell] != nullptr);
+
+            const bool resetMyBuffers = (data.cellInformation.ltsSetup >> 10) % 2 == 0 || resetBuffers;
+            if (resetMyBuffers) {
+              kernels::storeBuffer(l_integrationBuffer[lane], buffers[l_cell]);
+            } else {
+              kernels::accumulateBuffer(l_integrationBuffer[lane], buffers[l_cell]);
+            }
+          }
+        }
       }
-    }
-
-    // TODO: Integrate this step into the kernel
-    // We've used a temporary buffer -> need to accumulate update in
-    // shared buffer.
-    if (!resetMyBuffers && buffersProvided) {
-      assert(buffers[l_cell] != nullptr);
 
-      for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
-        buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
+      // The implicit barrier of the loop above guarantees that the region is complete
+      if (chunk + 1 < numberOfChunks && completesCopyRegion(chunk)) {
+#ifdef _OPENMP
+        #pragma omp master
+#endif
+        {
+          copyRegionProgress->publish(chunk, predictionsAfterStep);
+          copyRegionProgress->progress();
+        }
       }
+      chunkBegin = chunkEnd;
     }
   }
 
+  if (evaluatesSnapshot) {
+    waveFieldSnapshot->addEvaluatedCells(i_layerData.getNumberOfCells());
+  }
+
   m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_profilingId);
 }
 #else // ACL_DEVICE
@@ -546,6 +704,65 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol:
     computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
   }
 }
+
+unsigned seissol::time_stepping::TimeCluster::computePlasticity(seissol::initializers::Layer& layerData) {
+  SCOREP_USER_REGION( "computePlasticity", SCOREP_USER_REGION_TYPE_FUNCTION )
+  m_loopStatistics->begin(m_regionComputePlasticity);
+
+  const unsigned numberOfCells = layerData.getNumberOfCells();
+  real (*dofs)[tensor::Q::size()] = layerData.var(m_lts->dofs);
+  PlasticityData* plasticity = layerData.var(m_lts->plasticity);
+  real** pstrain = layerData.var(m_lts->pstrain);
+
+  updateRelaxTime();
+
+  // Mark the cells which may yield; the screening only reads the modal stresses
+  plasticityCandidates.resize(numberOfCells);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    plasticityCandidates[cell] = seissol::kernels::Plasticity::isBelowYieldSurface(&plasticity[cell], dofs[cell]) ? 0 : 1;
+  }
+
+  // Compact the marked cells in place, which only overwrites flags that were already visited
+  unsigned numberOfCandidates = 0;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (plasticityCandidates[cell] != 0) {
+      plasticityCandidates[numberOfCandidates++] = cell;
+    }
+  }
+
+  unsigned numberOfYieldingCells = 0;
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) reduction(+:numberOfYieldingCells)
+#endif
+  for (unsigned candidate = 0; candidate < numberOfCandidates; ++candidate) {
+    const unsigned cell = plasticityCandidates[candidate];
+    // Cells which have not yielded yet start from zero plastic strain and only get a slot if they yield now
+    alignas(ALIGNMENT) real unyieldedPstrain[seissol::initializers::PlasticStrainTable::SlotSize];
+    real* cellPstrain = pstrain[cell];
+    if (cellPstrain == nullptr) {
+      std::fill_n(unyieldedPstrain, seissol::initializers::PlasticStrainTable::SlotSize, static_cast<real>(0.0));
+      cellPstrain = unyieldedPstrain;
+    }
+    const unsigned yielded = seissol::kernels::Plasticity::computePlasticity(m_oneMinusIntegratingFactor,
+                                                                             timeStepSize(),
+                                                                             m_tv,
+                                                                             m_globalDataOnHost,
+                                                                             &plasticity[cell],
+                                                                             dofs[cell],
+                                                                             cellPstrain);
+    if (yielded != 0 && pstrain[cell] == nullptr) {
+      pstrain[cell] = plasticStrainTable->acquire();
+      std::copy_n(unyieldedPstrain, seissol::initializers::PlasticStrainTable::SlotSize, pstrain[cell]);
+    }
+    numberOfYieldingCells += yielded;
+  }
+
+  m_loopStatistics->end(m_regionComputePlasticity, numberOfCells, m_profilingId);
+  return numberOfYieldingCells;
+}
 #else // ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData,
                                                                          double subTimeStart) {
@@ -840,6 +1057,48 @@ unsigned int TimeCluster::getGlobalClusterId() const {
 LayerType TimeCluster::getLayerType() const {
   return layerType;
 }
+
+unsigned int TimeCluster::getNumberOfCells() const {
+  return m_clusterData->getNumberOfCells();
+}
+
+bool TimeCluster::hasDynamicRuptureFaces() const {
+  return dynamicRuptureScheduler->hasDynamicRuptureFaces();
+}
+
+void TimeCluster::setThreadOffset(int offset) {
+  threadOffset = offset;
+}
+
+void TimeCluster::connectGhost(AbstractTimeCluster& ghost, int otherGlobalClusterId) {
+  connect(ghost);
+  ghostNeighbors.push_back({neighbors.size() - 1, otherGlobalClusterId});
+}
+
+void TimeCluster::setCopyRegionProgress(CopyRegionProgress* progress) {
+  assert(layerType == Copy);
+  assert(progress == nullptr || progress->numberOfRegions() == 0 ||
+         progress->regionEnd(progress->numberOfRegions() - 1) == m_clusterData->getNumberOfCells());
+  copyRegionProgress = progress;
+}
+
+void TimeCluster::setWaveFieldSnapshot(writer::WaveFieldSnapshot* snapshot) {
+  waveFieldSnapshot = snapshot;
+  if (snapshot != nullptr && m_clusterData->getNumberOfCells() > 0) {
+    snapshotCellOffset = snapshot->cellIndex(m_clusterData->var(m_lts->dofs)[0]);
+  }
+}
+
+bool TimeCluster::completesCopyRegion(unsigned int region) const {
+  // A region is sent once the prediction is announced to the corresponding ghost cluster
+  const auto otherGlobalClusterId = copyRegionProgress->regionCluster(region);
+  for (const auto& ghost : ghostNeighbors) {
+    if (ghost.otherGlobalClusterId == otherGlobalClusterId) {
+      return announcesPrediction(neighbors[ghost.neighborIndex], ct.predictionsSinceLastSync + ct.timeStepRate);
+    }
+  }
+  return false;
+}
 void TimeCluster::setReceiverTime(double receiverTime) {
   m_receiverTime = receiverTime;
 }
@@ -76,11 +76,14 @@
 #include <list>
 #endif
 
+#include <algorithm>
+
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
 #include <utils/logger.h>
 #include <Initializer/LTS.h>
 #include <Initializer/tree/LTSTree.hpp>
+#include <Initializer/PlasticStrainTable.h>
 
 #include <Kernels/Time.h>
 #include <Kernels/Local.h>
@@ -89,11 +92,15 @@
 #include <Kernels/Plasticity.h>
 #include <Kernels/PointSourceCluster.h>
 #include <Kernels/TimeCommon.h>
+#include <Kernels/TimeBuffers.h>
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <Monitoring/LoopStatistics.h>
 #include <Monitoring/ActorStateStatistics.h>
+#include <ResultWriter/WaveFieldSnapshot.h>
 
 #include "AbstractTimeCluster.h"
+#include "CopyRegionProgress.h"
+#include "NeighborIntegrationCache.h"
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -193,6 +200,7 @@ private:
     unsigned        m_regionComputeLocalIntegration;
     unsigned        m_regionComputeNeighboringIntegration;
     unsigned        m_regionComputeDynamicRupture;
+    unsigned        m_regionComputePlasticity;
 
     kernels::ReceiverCluster* m_receiverCluster;
 
@@ -231,6 +239,17 @@ private:
      **/
     void computeLocalIntegration( seissol::initializers::Layer&  i_layerData, bool resetBuffers);
 
+    //! number of chunks of the local integration, which are the copy regions if they are published early
+    unsigned int getNumberOfLocalIntegrationChunks() const;
+
+    //! end of the given chunk of the local integration; a chunk starts at the end of the previous one
+    unsigned int getLocalIntegrationChunkEnd(seissol::initializers::Layer& layerData, unsigned int chunk) const;
+
+#ifdef HOST_CELL_BATCH
+    //! packs the matrices of all full cell batches of the local integration, see cellBatchMatricesOfCell
+    void packCellBatches(seissol::initializers::Layer& layerData);
+#endif
+
     /**
      * Computes the contribution of the neighboring cells to the boundary integral.
      *
@@ -247,6 +266,19 @@ private:
 
     void computeLocalIntegrationFlops(seissol::initializers::Layer& layerData);
 #ifndef ACL_DEVICE
+    /**
+     * Applies the plasticity to all cells of the layer after the neighboring integration.
+     *
+     * All cells are screened for yielding first; the full yield check with the stress adjustment
+     * then runs on the compacted list of the cells which did not pass the screening.
+     *
+     * @return number of cells with plastic yielding.
+     **/
+    unsigned computePlasticity(seissol::initializers::Layer& layerData);
+
+    //! Cells of the layer which did not pass the plasticity screening, see computePlasticity
+    std::vector<unsigned> plasticityCandidates;
+
     template<bool usePlasticity>
     std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializers::Layer& i_layerData,
                                                                       double subTimeStart) {
@@ -258,43 +290,33 @@ private:
       real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
       CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
       CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
-      PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
-      real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = i_layerData.var(m_lts->pstrain);
       unsigned numberOTetsWithPlasticYielding = 0;
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
 
+      if (neighborIntegrationCache == nullptr) {
+        neighborIntegrationCache = std::make_unique<NeighborIntegrationCache>(cellInformation,
+                                                                              faceNeighbors,
+                                                                              i_layerData.getNumberOfCells());
+      }
+      const NeighborIntegrationCache* cache = neighborIntegrationCache.get();
+      neighborIntegrationCache->integrate(m_timeKernel, subTimeStart, timeStepSize());
+
       real *l_timeIntegrated[4];
       real *l_faceNeighbors_prefetch[4];
+      real *l_timeDofs[4];
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
+#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch, l_timeDofs) shared(cellInformation, loader, faceNeighbors, i_layerData, drMapping, subTimeStart, cache)
 #endif
       for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
         auto data = loader.entry(l_cell);
-        seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
-                                                       data.cellInformation.ltsSetup,
-                                                       data.cellInformation.faceTypes,
-                                                       subTimeStart,
-                                                       timeStepSize(),
-                                                       faceNeighbors[l_cell],
 #ifdef _OPENMP
-                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+        auto& integrationBuffer = *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[(threadOffset + omp_get_thread_num())*4*tensor::I::size()]));
 #else
-            *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
+        auto& integrationBuffer = *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS);
 #endif
-                                                       l_timeIntegrated);
-
-        l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][1] :
-                                      drMapping[l_cell][1].godunov;
-        l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][2] :
-                                      drMapping[l_cell][2].godunov;
-        l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][3] :
-                                      drMapping[l_cell][3].godunov;
 
         // fourth face's prefetches
         if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
@@ -305,28 +327,73 @@ private:
           l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
         }
 
-        m_neighborKernel.computeNeighborsIntegral( data,
-                                                   drMapping[l_cell],
-                                                   l_timeIntegrated, l_faceNeighbors_prefetch
-        );
-
-        if constexpr (usePlasticity) {
-          updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             timeStepSize(),
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs,
-                                                                                             pstrain[l_cell] );
+        // The interior is sorted by face types and LTS setup, hence this branch changes rarely from cell to cell
+        if (seissol::kernels::TimeCommon::isRegularGtsCell(data.cellInformation)) {
+          // all face neighbors provide time integrated buffers
+          l_faceNeighbors_prefetch[0] = faceNeighbors[l_cell][1];
+          l_faceNeighbors_prefetch[1] = faceNeighbors[l_cell][2];
+          l_faceNeighbors_prefetch[2] = faceNeighbors[l_cell][3];
+
+          if constexpr (seissol::kernels::ReducedPrecisionBuffers) {
+            std::copy_n(faceNeighbors[l_cell], 4, l_timeDofs);
+            seissol::kernels::loadNeighborBuffers(data.cellInformation.ltsSetup, data.cellInformation.faceTypes, l_timeDofs, integrationBuffer);
+            m_neighborKernel.computeRegularNeighborsIntegral(data, l_timeDofs, l_faceNeighbors_prefetch);
+          } else {
+            m_neighborKernel.computeRegularNeighborsIntegral(data, faceNeighbors[l_cell], l_faceNeighbors_prefetch);
+          }
+        } else {
+          std::copy_n(faceNeighbors[l_cell], 4, l_timeDofs);
+          // The buffers are converted before the cache replaces derivatives, which clears the corresponding bits of the LTS setup
+          seissol::kernels::loadNeighborBuffers(data.cellInformation.ltsSetup, data.cellInformation.faceTypes, l_timeDofs, integrationBuffer);
+          const unsigned short ltsSetup = cache->useCachedIntegrals(l_cell, data.cellInformation.ltsSetup, l_timeDofs);
+          alignas(ALIGNMENT) real convertedDerivatives[seissol::kernels::ReducedPrecisionDerivatives ? 4 : 1][yateto::computeFamilySize<tensor::dQ>()];
+          seissol::kernels::loadNeighborDerivatives(ltsSetup, data.cellInformation.faceTypes, l_timeDofs, convertedDerivatives);
+          seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
+                                                         ltsSetup,
+                                                         data.cellInformation.faceTypes,
+                                                         subTimeStart,
+                                                         timeStepSize(),
+                                                         l_timeDofs,
+                                                         integrationBuffer,
+                                                         l_timeIntegrated);
+
+          l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][1] :
+                                        drMapping[l_cell][1].godunov;
+          l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][2] :
+                                        drMapping[l_cell][2].godunov;
+          l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][3] :
+                                        drMapping[l_cell][3].godunov;
+
+          m_neighborKernel.computeNeighborsIntegral( data,
+                                                     drMapping[l_cell],
+                                                     l_timeIntegrated, l_faceNeighbors_prefetch
+          );
         }
+      }
+
+      // The plasticity is measured in its own region, see computePlasticity
+      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+
+      if constexpr (usePlasticity) {
+        numberOTetsWithPlasticYielding = computePlasticity(i_layerData);
+      }
+
 #ifdef INTEGRATE_QUANTITIES
+      // The quantities are integrated after the plasticity has adjusted the stresses
+      real (*dofs)[tensor::Q::size()] = i_layerData.var(m_lts->dofs);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
         seissol::SeisSol::main.postProcessor().integrateQuantities( m_timeStepWidth,
                                                               i_layerData,
                                                               l_cell,
                                                               dofs[l_cell] );
-#endif // INTEGRATE_QUANTITIES
       }
+#endif // INTEGRATE_QUANTITIES
 
       const long long nonZeroFlopsPlasticity =
           i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
@@ -335,8 +402,6 @@ private:
           i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
           numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
 
-      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
-
       return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
     }
 #endif // ACL_DEVICE
@@ -376,6 +441,48 @@ private:
 
   DynamicRuptureScheduler* dynamicRuptureScheduler;
 
+  //! offset of the first thread of the (sub-)team working on this cluster, used for thread-local buffers
+  int threadOffset = 0;
+
+  //! region-wise progress of the local integration, only set for copy layers with early sends
+  CopyRegionProgress* copyRegionProgress = nullptr;
+
+  //! true if the time derivatives and the local integral are computed by a single kernel where possible
+  bool useFusedLocalKernel = false;
+
+#ifdef HOST_CELL_BATCH
+  //! interleaved matrices of the full cell batches of the local integration, packed with the first prediction
+  std::vector<kernels::Local::CellBatchMatrices> cellBatchMatrices;
+
+  //! matrices of the batch which starts at a cell, nullptr if no batch starts there or if it has an unsupported cell
+  std::vector<const kernels::Local::CellBatchMatrices*> cellBatchMatricesOfCell;
+
+  bool hasPackedCellBatches = false;
+#endif
+
+  //! assigns the plastic strain slots of cells on their first yield, only used on the host
+  seissol::initializers::PlasticStrainTable* plasticStrainTable = nullptr;
+
+#ifndef ACL_DEVICE
+  //! derivatives of face neighbors which are integrated by several faces of this cluster, set up with the first correction
+  std::unique_ptr<NeighborIntegrationCache> neighborIntegrationCache;
+#endif
+
+  //! wave field at the next output time, evaluated in the time step which contains the output time
+  writer::WaveFieldSnapshot* waveFieldSnapshot = nullptr;
+  //! index of the first cell of this cluster in the snapshot
+  std::size_t snapshotCellOffset = 0;
+
+  struct GhostNeighbor {
+    std::size_t neighborIndex;
+    int otherGlobalClusterId;
+  };
+  //! neighbors which represent ghost clusters, i.e. which send the copy regions of this cluster
+  std::vector<GhostNeighbor> ghostNeighbors;
+
+  //! true if the upcoming prediction completes the data of the copy region, which is then sent
+  [[nodiscard]] bool completesCopyRegion(unsigned int region) const;
+
   void printTimeoutMessage(std::chrono::seconds timeSinceLastUpdate) override;
 
 public:
@@ -435,7 +542,40 @@ public:
   [[nodiscard]] unsigned int getClusterId() const;
   [[nodiscard]] unsigned int getGlobalClusterId() const;
   [[nodiscard]] LayerType getLayerType() const;
+  [[nodiscard]] unsigned int getNumberOfCells() const;
+  [[nodiscard]] bool hasDynamicRuptureFaces() const;
   void setReceiverTime(double receiverTime);
+
+  /**
+   * Sets the id of the first thread of the OpenMP (sub-)team which computes this cluster.
+   * Needs to be set if several clusters are computed concurrently by nested teams.
+   */
+  void setThreadOffset(int offset);
+
+  /**
+   * Connects this (copy layer) cluster with the ghost cluster which sends its copy regions to otherGlobalClusterId.
+   */
+  void connectGhost(AbstractTimeCluster& ghost, int otherGlobalClusterId);
+
+  /**
+   * Processes the copy layer region by region and publishes each region as soon as it is ready to be sent.
+   */
+  void setCopyRegionProgress(CopyRegionProgress* progress);
+
+  /**
+   * Computes the ADER predictor and the local integral of regular cells by a single kernel.
+   */
+  void setUseFusedLocalKernel(bool useFused) { useFusedLocalKernel = useFused; }
+
+  /**
+   * Sets the table which provides the plastic strain of cells which yield for the first time.
+   */
+  void setPlasticStrainTable(seissol::initializers::PlasticStrainTable* table) { plasticStrainTable = table; }
+
+  /**
+   * Lets the local integration evaluate the wave field at the output time of the snapshot.
+   */
+  void setWaveFieldSnapshot(writer::WaveFieldSnapshot* snapshot);
 };
 
 #endif
@@ -43,17 +43,29 @@
 
 #include "TimeManager.h"
 #include "CommunicationManager.h"
+#include "ThreadGroups.h"
 #include <Initializer/preProcessorMacros.hpp>
 #include <Initializer/time_stepping/common.hpp>
 #include "SeisSol.h"
+#include "Modules/Modules.h"
 #include <ResultWriter/ClusteringWriter.h>
+#include "utils/env.h"
+
+#include <algorithm>
+#include <numeric>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 seissol::time_stepping::TimeManager::TimeManager():
-  m_logUpdates(std::numeric_limits<unsigned int>::max())
+  m_logUpdates(std::numeric_limits<unsigned int>::max()),
+  passedSyncPoints(&Modules::callPassiveSyncHook)
 {
   m_loopStatistics.addRegion("computeLocalIntegration");
   m_loopStatistics.addRegion("computeNeighboringIntegration");
   m_loopStatistics.addRegion("computeDynamicRupture");
+  m_loopStatistics.addRegion("computePlasticity");
 
   actorStateStatisticsManager = ActorStateStatisticsManager();
 }
@@ -66,6 +78,7 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
                                                       initializers::MemoryManager& memoryManager,
                                                       bool usePlasticity) {
   SCOREP_USER_REGION( "addClusters", SCOREP_USER_REGION_TYPE_FUNCTION );
+  m_frictionSolver = memoryManager.getFrictionLaw();
   std::vector<std::unique_ptr<AbstractGhostTimeCluster>> ghostClusters;
   // assert non-zero pointers
   assert( i_meshStructure         != NULL );
@@ -73,6 +86,38 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
   // store the time stepping
   m_timeStepping = i_timeStepping;
 
+  useConcurrentClusters = utils::Env::get<bool>("SEISSOL_CONCURRENT_CLUSTERS", false);
+#if defined(ACL_DEVICE) || !defined(_OPENMP)
+  if (useConcurrentClusters) {
+    logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_CONCURRENT_CLUSTERS is only supported for CPU builds with OpenMP, ignoring it.";
+    useConcurrentClusters = false;
+  }
+#else
+  numberOfThreads = omp_get_max_threads();
+  if (useConcurrentClusters) {
+    logInfo(seissol::MPI::mpi.rank()) << "Computing ready time clusters concurrently on sub-teams of" << numberOfThreads << "threads.";
+    omp_set_max_active_levels(2);
+  }
+#endif
+
+#if defined(USE_MPI) && !defined(ACL_DEVICE)
+  useChunkedCopyLayer = utils::Env::get<bool>("SEISSOL_CHUNKED_COPY_LAYER", false)
+                        && MPI::mpi.getPreferredDataTransferMode() == MPI::DataTransferMode::Direct;
+  if (useChunkedCopyLayer) {
+    logInfo(seissol::MPI::mpi.rank()) << "Sending copy regions as soon as their local integration is finished.";
+  }
+  const bool aggregateGhostMessages = utils::Env::get<bool>("SEISSOL_AGGREGATE_GHOST_MESSAGES", false)
+                                      && MPI::mpi.getPreferredDataTransferMode() == MPI::DataTransferMode::Direct;
+  std::vector<const MeshStructure*> globalMeshStructures(m_timeStepping.numberOfGlobalClusters, nullptr);
+#endif
+
+#ifndef ACL_DEVICE
+  const bool useFusedLocalKernel = utils::Env::get<bool>("SEISSOL_FUSED_LOCAL_KERNEL", false);
+  if (useFusedLocalKernel) {
+    logInfo(seissol::MPI::mpi.rank()) << "Computing the time derivatives and the local integral by a fused kernel.";
+  }
+#endif
+
   auto clusteringWriter = writer::ClusteringWriter(memoryManager.getOutputPrefix());
 
   bool foundDynamicRuptureCluster = false;
@@ -133,6 +178,10 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
           &m_loopStatistics,
           &actorStateStatisticsManager.addCluster(profilingId))
       );
+#ifndef ACL_DEVICE
+      clusters.back()->setUseFusedLocalKernel(useFusedLocalKernel);
+      clusters.back()->setPlasticStrainTable(&memoryManager.getPlasticStrainTable());
+#endif
 
       const auto clusterSize = layerData->getNumberOfCells();
       const auto dynRupSize = type == Copy ? dynRupCopyData->getNumberOfCells()
@@ -171,6 +220,12 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
     // Create ghost time clusters for MPI
     const auto preferredDataTransferMode = MPI::mpi.getPreferredDataTransferMode();
     const int globalClusterId = static_cast<int>(m_timeStepping.clusterIds[localClusterId]);
+    globalMeshStructures[globalClusterId] = meshStructure;
+    CopyRegionProgress* copyRegionProgress = nullptr;
+    if (useChunkedCopyLayer && meshStructure->numberOfRegions > 0) {
+      copyRegionProgress = copyRegionProgresses.emplace_back(std::make_unique<CopyRegionProgress>(*meshStructure)).get();
+      copy->setCopyRegionProgress(copyRegionProgress);
+    }
     for (unsigned int otherGlobalClusterId = 0; otherGlobalClusterId < m_timeStepping.numberOfGlobalClusters; ++otherGlobalClusterId) {
       const bool hasNeighborRegions = std::any_of(meshStructure->neighboringClusters,
                                                   meshStructure->neighboringClusters + meshStructure->numberOfRegions,
@@ -193,10 +248,11 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
                                                          otherGlobalClusterId,
                                                          meshStructure,
                                                          preferredDataTransferMode);
+        ghostCluster->setCopyRegionProgress(copyRegionProgress);
         ghostClusters.push_back(std::move(ghostCluster));
 
         // Connect with previous copy layer.
-        ghostClusters.back()->connect(*copy);
+        copy->connectGhost(*ghostClusters.back(), static_cast<int>(otherGlobalClusterId));
       }
     }
 #endif
@@ -220,6 +276,20 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
 
   std::sort(ghostClusters.begin(), ghostClusters.end(), rateSorter);
 
+#if defined(USE_MPI) && !defined(ACL_DEVICE)
+  if (aggregateGhostMessages) {
+    messageAggregator = std::make_unique<GhostMessageAggregator>(globalMeshStructures);
+    for (auto& ghostCluster : ghostClusters) {
+      ghostCluster->setMessageAggregator(messageAggregator.get());
+    }
+  }
+#endif
+
+  for (const auto& cluster : clusters) {
+    cluster->setWakeupListener([this]() { wakeupSignal.notify(); });
+  }
+  costPerCell.assign(clusters.size(), 0.0);
+
 #ifdef USE_COMM_THREAD
   bool useCommthread = true;
 #else
@@ -236,7 +306,15 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
                                                                           );
   } else {
     communicationManager = std::make_unique<SerialCommunicationManager>(std::move(ghostClusters));
+    // Without communication thread, published copy regions are only sent if MPI is progressed in between.
+    // Concurrent clusters would progress MPI from several threads, hence they rely on the main loop.
+    if (!useConcurrentClusters) {
+      for (auto& copyRegionProgress : copyRegionProgresses) {
+        copyRegionProgress->setProgressionCallback([this]() { communicationManager->progression(); });
+      }
+    }
   }
+  communicationManager->setMessageAggregator(messageAggregator.get());
 
 }
 
@@ -267,7 +345,8 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
 
   communicationManager->reset(synchronizationTime);
 
-  seissol::MPI::mpi.barrier(seissol::MPI::mpi.comm());
+  // No barrier: the clusters agree on the time only through the messages of their neighbors.
+  // Receives for the next interval are posted in RestartAfterSync, earlier messages are queued by MPI.
 #ifdef ACL_DEVICE
   device::DeviceInstance &device = device::DeviceInstance::getInstance();
   device.api->putProfilingMark("advanceInTime", device::ProfilingColors::Blue);
@@ -281,61 +360,179 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  // Event-driven scheduling: a cluster is only re-evaluated if one of its neighbors sent it a
+  // message or if it changed its own state. Clusters without pending work are skipped instead of
+  // polled, and the main thread sleeps while the communication thread makes progress.
+  auto tryAct = [](TimeCluster* cluster) {
+    if (!cluster->consumeWakeup()) {
+      return false;
+    }
+    const auto result = cluster->act();
+    if (result.isStateChanged || cluster->hasPendingMessages()) {
+      cluster->wakeup();
+    }
+    return result.isStateChanged;
+  };
+
+  auto lastActivity = std::chrono::steady_clock::now();
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
-    finished = true;
+    const auto seenGeneration = wakeupSignal.currentGeneration();
     communicationManager->progression();
 
-    // Update all high priority clusters
-    std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
-      if (cluster->getNextLegalAction() == ActorAction::Predict) {
-        communicationManager->progression();
-        cluster->act();
-      }
-    });
-    std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
-      if (cluster->getNextLegalAction() != ActorAction::Predict && cluster->getNextLegalAction() != ActorAction::Nothing) {
-        communicationManager->progression();
-        cluster->act();
+    bool acted = false;
+    if (useConcurrentClusters) {
+      acted = actConcurrently();
+    } else {
+      // Update all high priority clusters which are ready
+      for (auto* cluster : highPrioClusters) {
+        if (tryAct(cluster)) {
+          acted = true;
+          communicationManager->progression();
+        }
       }
-    });
 
-    // Update one low priority cluster
-    if (auto predictable = std::find_if(
-          lowPrioClusters.begin(), lowPrioClusters.end(), [](auto& c) {
-            return c->getNextLegalAction() == ActorAction::Predict;
-          }
-      );
-        predictable != lowPrioClusters.end()) {
-      (*predictable)->act();
-    } else {
-    }
-    if (auto correctable = std::find_if(
-          lowPrioClusters.begin(), lowPrioClusters.end(), [](auto& c) {
-            return c->getNextLegalAction() != ActorAction::Predict && c->getNextLegalAction() != ActorAction::Nothing;
-          }
-      );
-        correctable != lowPrioClusters.end()) {
-      (*correctable)->act();
-    } else {
+      // Update one low priority cluster, such that the copy layers are served again afterwards
+      for (auto* cluster : lowPrioClusters) {
+        if (tryAct(cluster)) {
+          acted = true;
+          break;
+        }
+      }
     }
+
     finished = std::all_of(clusters.begin(), clusters.end(),
                            [](auto& c) {
       return c->synced();
     });
     finished &= communicationManager->checkIfFinished();
+
+    if (!acted && !finished) {
+      const auto now = std::chrono::steady_clock::now();
+      if (now - lastActivity > IdleRecheckInterval) {
+        // Safety net: re-evaluate every cluster once in a while (this also reports time-outs)
+        for (auto& cluster : clusters) {
+          cluster->wakeup();
+        }
+        lastActivity = now;
+      } else if (!communicationManager->requiresPolling()) {
+        wakeupSignal.waitFor(seenGeneration, IdleWaitTimeout);
+      }
+    } else {
+      lastActivity = std::chrono::steady_clock::now();
+    }
+
+    if (acted) {
+      passedSyncPoints.update(clusters, getTimeTolerance());
+    }
   }
 #ifdef ACL_DEVICE
   device.api->popLastProfilingMark();
 #endif
 }
 
+bool seissol::time_stepping::TimeManager::actConcurrently() {
+  // Collect the clusters which are ready, copy layers first.
+  // Copy and interior layer of the same cluster share their dynamic rupture scheduler, and all
+  // clusters share the friction solver and fault output, hence they are never run concurrently.
+  std::vector<std::size_t> batch;
+  std::vector<bool> isLocalClusterBusy(m_timeStepping.numberOfLocalClusters, false);
+  bool isDynamicRuptureBusy = false;
+  for (auto priority : {ActorPriority::High, ActorPriority::Low}) {
+    for (std::size_t i = 0; i < clusters.size() && batch.size() < static_cast<std::size_t>(numberOfThreads); ++i) {
+      auto* cluster = clusters[i].get();
+      if (cluster->getPriority() != priority || isLocalClusterBusy[cluster->getClusterId()]) {
+        continue;
+      }
+      if (!cluster->consumeWakeup()) {
+        continue;
+      }
+      const auto action = cluster->getNextLegalAction();
+      if (action == ActorAction::Nothing) {
+        if (cluster->hasPendingMessages()) {
+          cluster->wakeup();
+        }
+        continue;
+      }
+      const bool needsDynamicRupture = cluster->hasDynamicRuptureFaces() && action == ActorAction::Correct;
+      if (needsDynamicRupture && isDynamicRuptureBusy) {
+        // Retry in the next pass
+        cluster->wakeup();
+        continue;
+      }
+      isLocalClusterBusy[cluster->getClusterId()] = true;
+      isDynamicRuptureBusy |= needsDynamicRupture;
+      batch.push_back(i);
+    }
+  }
+  if (batch.empty()) {
+    return false;
+  }
+
+  // Clusters without measurement are assumed to be as expensive as the average measured cluster
+  double knownCost = 0.0;
+  int numberOfKnownCosts = 0;
+  for (auto i : batch) {
+    if (costPerCell[i] > 0.0) {
+      knownCost += costPerCell[i];
+      ++numberOfKnownCosts;
+    }
+  }
+  const double defaultCost = numberOfKnownCosts > 0 ? knownCost / numberOfKnownCosts : 1.0;
+  std::vector<double> costs;
+  for (auto i : batch) {
+    const auto cost = costPerCell[i] > 0.0 ? costPerCell[i] : defaultCost;
+    costs.push_back(std::max(clusters[i]->getNumberOfCells(), 1U) * cost);
+  }
+  const auto threads = partitionThreads(costs, numberOfThreads);
+  std::vector<int> threadOffsets(batch.size(), 0);
+  std::partial_sum(threads.begin(), threads.end() - 1, threadOffsets.begin() + 1);
+
+  std::vector<char> isStateChanged(batch.size(), false);
+#ifdef _OPENMP
+  #pragma omp parallel for num_threads(batch.size()) schedule(static, 1)
+#endif
+  for (std::size_t j = 0; j < batch.size(); ++j) {
+#ifdef _OPENMP
+    // Nested parallel regions of this cluster use its sub-team
+    omp_set_num_threads(threads[j]);
+#endif
+    auto* cluster = clusters[batch[j]].get();
+    cluster->setThreadOffset(threadOffsets[j]);
+    const auto begin = std::chrono::steady_clock::now();
+    const auto result = cluster->act();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+    if (result.isStateChanged || cluster->hasPendingMessages()) {
+      cluster->wakeup();
+    }
+    if (result.isStateChanged && cluster->getNumberOfCells() > 0) {
+      const double measured = elapsed.count() / cluster->getNumberOfCells();
+      auto& cost = costPerCell[batch[j]];
+      cost = cost > 0.0 ? 0.5 * (cost + measured) : measured;
+    }
+    isStateChanged[j] = result.isStateChanged;
+  }
+
+  return std::any_of(isStateChanged.begin(), isStateChanged.end(), [](auto changed) { return changed; });
+}
+
 void seissol::time_stepping::TimeManager::printComputationTime(
     const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn) {
   actorStateStatisticsManager.addToLoopStatistics(m_loopStatistics);
+  if (m_frictionSolver != nullptr) {
+    m_frictionSolver->addToLoopStatistics(m_loopStatistics);
+  }
 #ifdef USE_MPI
   m_loopStatistics.printSummary(MPI::mpi.comm());
+#else
+  m_loopStatistics.printHistograms(MPI::mpi.rank());
 #endif
+  // The regression of the summary is global, such that one rank suffices.
+  // It can be used as measured vertex weights of a subsequent run.
+  if (MPI::mpi.rank() == 0) {
+    m_loopStatistics.writeCosts(outputPrefix + "-loopStat-costs.csv");
+  }
 
   m_loopStatistics.writeSamples(outputPrefix, isLoopStatisticsNetcdfOutputOn);
 }
@@ -362,6 +559,28 @@ void seissol::time_stepping::TimeManager::setReceiverClusters(writer::ReceiverWr
   }
 }
 
+void seissol::time_stepping::TimeManager::setWaveFieldSnapshot(writer::WaveFieldSnapshot& snapshot, double interval) {
+  const auto rank = seissol::MPI::mpi.rank();
+#if defined(ACL_DEVICE) || defined(USE_STP)
+  logInfo(rank) << "Sync-free wave field output is not supported by this build; the output synchronizes the time clusters.";
+#else
+  // The snapshot holds a single output time. It is rescheduled once all clusters passed the output
+  // time; until then, the clusters drift apart by at most about one time step of the largest cluster.
+  const double largestTimeStepSize = m_timeStepping.globalCflTimeStepWidths[m_timeStepping.numberOfGlobalClusters - 1];
+  const double minimumInterval = 2 * largestTimeStepSize;
+  if (interval < minimumInterval) {
+    logInfo(rank) << "The wave field output interval is below" << minimumInterval
+                  << "; the output synchronizes the time clusters.";
+    return;
+  }
+  logInfo(rank) << "Evaluating the wave field output in the time steps, without synchronization.";
+  snapshot.activate(getTimeTolerance());
+  for (auto& cluster : clusters) {
+    cluster->setWaveFieldSnapshot(&snapshot);
+  }
+#endif
+}
+
 void seissol::time_stepping::TimeManager::setInitialTimes( double i_time ) {
   assert( i_time >= 0 );
 
@@ -383,5 +602,9 @@ void seissol::time_stepping::TimeManager::freeDynamicResources() {
     cluster->freePointSources();
   }
   communicationManager.reset(nullptr);
+  if (messageAggregator != nullptr) {
+    messageAggregator->freeResources();
+    messageAggregator.reset(nullptr);
+  }
 }
 
@@ -45,6 +45,8 @@
 #include <queue>
 #include <list>
 #include <cassert>
+#include <chrono>
+#include <limits>
 #include <memory>
 
 #include <Initializer/typedefs.hpp>
@@ -58,6 +60,7 @@
 #include "TimeCluster.h"
 #include "Monitoring/Stopwatch.h"
 #include "Solver/time_stepping/GhostTimeClusterFactory.h"
+#include "Solver/time_stepping/PassedSyncPoints.h"
 
 namespace seissol {
   namespace time_stepping {
@@ -110,9 +113,47 @@ class seissol::time_stepping::TimeManager {
     //! one dynamic rupture scheduler per pair of interior/copy cluster
     std::vector<std::unique_ptr<DynamicRuptureScheduler>> dynamicRuptureSchedulers;
 
+    //! progress of each copy layer which is computed region by region, referenced by the ghost clusters
+    std::vector<std::unique_ptr<CopyRegionProgress>> copyRegionProgresses;
+
+    //! combines the ghost messages to the same rank, if enabled; progressed by the communication manager
+    std::unique_ptr<GhostMessageAggregator> messageAggregator;
+
     //! all MPI (ghost) LTS clusters, which are under control of this time manager
     std::unique_ptr<AbstractCommunicationManager> communicationManager;
 
+    //! signalled whenever a message arrives for one of the local clusters
+    WakeupSignal wakeupSignal;
+
+    //! maximum time the scheduler sleeps before checking the communication manager again
+    static constexpr std::chrono::microseconds IdleWaitTimeout{100};
+
+    //! all clusters are re-evaluated if nothing happened for this long
+    static constexpr std::chrono::seconds IdleRecheckInterval{1};
+
+    //! synchronization points of the modules which do not require synchronized clusters
+    PassedSyncPoints passedSyncPoints;
+
+    //! true if ready clusters are computed concurrently by sub-teams of the OpenMP threads
+    bool useConcurrentClusters = false;
+
+    //! number of OpenMP threads which are split into sub-teams
+    int numberOfThreads = 1;
+
+    //! measured compute time per cell and action (exponential moving average), 0 if unknown
+    std::vector<double> costPerCell;
+
+    //! true if copy layers are computed region by region, such that each region is sent as early as possible
+    bool useChunkedCopyLayer = false;
+
+    /**
+     * Lets all clusters which are ready act concurrently, each on its own sub-team of threads.
+     * The sub-team sizes are proportional to the number of cells times the measured cost per cell.
+     *
+     * @return true if any cluster changed its state.
+     **/
+    bool actConcurrently();
+
     //! Stopwatch
     LoopStatistics m_loopStatistics;
     ActorStateStatisticsManager actorStateStatisticsManager;
@@ -120,6 +161,9 @@ class seissol::time_stepping::TimeManager {
     //! dynamic rupture output
     dr::output::OutputManager* m_faultOutputManager{};
 
+    //! friction law shared by all clusters, adds its statistics to m_loopStatistics
+    dr::friction_law::FrictionSolver* m_frictionSolver{};
+
   public:
     /**
      * Construct a new time manager.
@@ -170,6 +214,14 @@ class seissol::time_stepping::TimeManager {
    */
     void setReceiverClusters(writer::ReceiverWriter& receiverWriter); 
 
+    /**
+     * Lets the clusters evaluate the wave field output without synchronization, if possible.
+     *
+     * @param snapshot The snapshot of the wave field writer
+     * @param interval The interval of the wave field output
+     */
+    void setWaveFieldSnapshot(writer::WaveFieldSnapshot& snapshot, double interval);
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -20,8 +20,10 @@ src/Initializer/CellLocalMatrices.cpp
 src/Initializer/time_stepping/LtsLayout.cpp
 src/Initializer/time_stepping/LtsParameters.cpp
 src/Initializer/time_stepping/GlobalTimestep.cpp
+src/Initializer/time_stepping/SpaceFillingCurve.cpp
 src/Initializer/tree/Lut.cpp
 src/Initializer/MemoryManager.cpp
+src/Initializer/PlasticStrainTable.cpp
 src/Initializer/InitialFieldProjection.cpp
 src/Initializer/InputParameters.cpp
 
@@ -48,15 +50,22 @@ src/Solver/time_stepping/AbstractGhostTimeCluster.cpp
 src/Solver/time_stepping/DirectGhostTimeCluster.cpp
 src/Solver/time_stepping/GhostTimeClusterWithCopy.cpp
 src/Solver/time_stepping/CommunicationManager.cpp
+src/Solver/time_stepping/CopyRegionProgress.cpp
+src/Solver/time_stepping/GhostMessageAggregator.cpp
+src/Solver/time_stepping/NeighborIntegrationCache.cpp
+src/Solver/time_stepping/PassedSyncPoints.cpp
+src/Solver/time_stepping/ThreadGroups.cpp
 
 src/Solver/time_stepping/TimeManager.cpp
 src/Solver/Pipeline/DrTuner.cpp
 src/Kernels/DynamicRupture.cpp
 src/Kernels/Plasticity.cpp
 src/Kernels/TimeCommon.cpp
+src/Kernels/FluxSolvers.cpp
 src/Kernels/Receiver.cpp
 src/SeisSol.cpp
 src/Parallel/Pin.cpp
+src/Parallel/PersistentRequests.cpp
 
 src/Geometry/MeshTools.cpp
 src/Geometry/MeshReader.cpp
@@ -79,6 +88,7 @@ src/ResultWriter/ReceiverWriter.cpp
 src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FaultWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
+src/ResultWriter/WaveFieldSnapshot.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
 src/ResultWriter/EnergyOutput.cpp
 
@@ -0,0 +1,215 @@
+#ifndef SEISSOL_LINEARSLIPWEAKENING_T_H
+#define SEISSOL_LINEARSLIPWEAKENING_T_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "DynamicRupture/Misc.h"
+#include "DynamicRupture/Parameters.h"
+#include "DynamicRupture/FrictionLaws/FrictionLaws.h"
+#include "Initializer/DynamicRupture.h"
+#include "Initializer/tree/LTSTree.hpp"
+#include "tests/TestHelper.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+/**
+ * A layer of linear slip weakening faces with random, but reproducible, state.
+ */
+class LinearSlipWeakeningLayer {
+  public:
+  LinearSlipWeakeningLayer(unsigned numberOfFaces, unsigned seed) {
+    lts.addTo(tree);
+    tree.setNumberOfTimeClusters(1);
+    tree.fixate();
+    tree.child(0).child<Ghost>().setNumberOfCells(0);
+    tree.child(0).child<Copy>().setNumberOfCells(0);
+    tree.child(0).child<Interior>().setNumberOfCells(numberOfFaces);
+    tree.allocateVariables();
+    tree.touchVariables();
+
+    std::mt19937 generator(seed);
+    fill(lts.qInterpolatedPlus, generator, -1.0, 1.0);
+    fill(lts.qInterpolatedMinus, generator, -1.0, 1.0);
+    fill(lts.nucleationStressInFaultCS, generator, -1.0, 1.0);
+    fill(lts.initialPressure, generator, -0.5, 0.5);
+    fill(lts.nucleationPressure, generator, -0.5, 0.5);
+    fill(lts.dC, generator, 0.005, 0.02);
+    fill(lts.muS, generator, 0.5, 0.7);
+    fill(lts.muD, generator, 0.1, 0.3);
+    fill(lts.cohesion, generator, 0.0, 0.5);
+    fill(lts.forcedRuptureTime, generator, 0.0, 1.0);
+
+    auto* initialStress = layer().var(lts.initialStressInFaultCS);
+    auto* mu = layer().var(lts.mu);
+    auto* muS = layer().var(lts.muS);
+    auto* impAndEta = layer().var(lts.impAndEta);
+    auto* ruptureTimePending = layer().var(lts.ruptureTimePending);
+    auto* dynStressTimePending = layer().var(lts.dynStressTimePending);
+    std::uniform_real_distribution<double> normalStress(-20.0, -10.0);
+    std::uniform_real_distribution<double> shearStress(2.0, 10.0);
+    std::uniform_real_distribution<double> impedance(10.0, 30.0);
+    for (unsigned ltsFace = 0; ltsFace < numberOfFaces; ++ltsFace) {
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; ++pointIndex) {
+        // some of the points are stronger than the initial shear stress, some are not
+        initialStress[ltsFace][pointIndex][0] = normalStress(generator);
+        initialStress[ltsFace][pointIndex][3] = shearStress(generator);
+        initialStress[ltsFace][pointIndex][5] = shearStress(generator) - 6.0;
+        mu[ltsFace][pointIndex] = muS[ltsFace][pointIndex];
+        ruptureTimePending[ltsFace][pointIndex] = true;
+        dynStressTimePending[ltsFace][pointIndex] = true;
+      }
+
+      auto& faceImpAndEta = impAndEta[ltsFace];
+      faceImpAndEta.zp = impedance(generator);
+      faceImpAndEta.zs = impedance(generator);
+      faceImpAndEta.zpNeig = impedance(generator);
+      faceImpAndEta.zsNeig = impedance(generator);
+      faceImpAndEta.etaP =
+          faceImpAndEta.zp * faceImpAndEta.zpNeig / (faceImpAndEta.zp + faceImpAndEta.zpNeig);
+      faceImpAndEta.etaS =
+          faceImpAndEta.zs * faceImpAndEta.zsNeig / (faceImpAndEta.zs + faceImpAndEta.zsNeig);
+      faceImpAndEta.invEtaS = 1.0 / faceImpAndEta.etaS;
+      faceImpAndEta.invZp = 1.0 / faceImpAndEta.zp;
+      faceImpAndEta.invZs = 1.0 / faceImpAndEta.zs;
+      faceImpAndEta.invZpNeig = 1.0 / faceImpAndEta.zpNeig;
+      faceImpAndEta.invZsNeig = 1.0 / faceImpAndEta.zsNeig;
+    }
+  }
+
+  initializers::Layer& layer() { return tree.child(0).child<Interior>(); }
+
+  initializers::LTSLinearSlipWeakening lts;
+
+  private:
+  template <typename T>
+  void fill(initializers::Variable<T>& handle, std::mt19937& generator, double min, double max) {
+    std::uniform_real_distribution<double> distribution(min, max);
+    auto* values = reinterpret_cast<real*>(layer().var(handle));
+    const auto numberOfValues = layer().getNumberOfCells() * sizeof(T) / sizeof(real);
+    for (std::size_t i = 0; i < numberOfValues; ++i) {
+      values[i] = distribution(generator);
+    }
+  }
+
+  initializers::LTSTree tree;
+};
+
+TEST_CASE("Linear slip weakening face batches") {
+  // the last batch is only partially filled
+  const unsigned numberOfFaces = 2 * misc::faceBatchSize + 1;
+  constexpr unsigned numberOfTimeSteps = 3;
+  constexpr double timeStepWidth = 0.1;
+  constexpr real epsilon = 1e3 * std::numeric_limits<real>::epsilon();
+
+  double timePoints[CONVERGENCE_ORDER];
+  double timeWeights[CONVERGENCE_ORDER];
+  for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+    timePoints[timeIndex] = timeStepWidth * (timeIndex + 0.5) / CONVERGENCE_ORDER;
+    timeWeights[timeIndex] = timeStepWidth / CONVERGENCE_ORDER;
+  }
+
+  DRParameters drParameters;
+  SUBCASE("after the nucleation") { drParameters.t0 = 0.0; }
+  SUBCASE("during the nucleation") { drParameters.t0 = 1.0; }
+
+  LinearSlipWeakeningLayer faceLayer(numberOfFaces, 42);
+  LinearSlipWeakeningLayer batchLayer(numberOfFaces, 42);
+
+  friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization> faceLaw(&drParameters);
+  friction_law::LinearSlipWeakeningLaw<friction_law::NoSpecialization> batchLaw(&drParameters);
+  faceLaw.setFaceBatching(false);
+  batchLaw.setFaceBatching(true);
+  REQUIRE(batchLaw.useFaceBatching);
+
+  faceLaw.computeDeltaT(timePoints);
+  batchLaw.computeDeltaT(timePoints);
+  for (unsigned timeStep = 0; timeStep < numberOfTimeSteps; ++timeStep) {
+    const real fullUpdateTime = timeStep * timeStepWidth;
+    faceLaw.evaluate(faceLayer.layer(), &faceLayer.lts, fullUpdateTime, timeWeights);
+    batchLaw.evaluate(batchLayer.layer(), &batchLayer.lts, fullUpdateTime, timeWeights);
+  }
+
+  auto compare = [&](auto const& handle) {
+    const auto* expected = faceLayer.layer().var(handle);
+    const auto* actual = batchLayer.layer().var(handle);
+    for (unsigned ltsFace = 0; ltsFace < numberOfFaces; ++ltsFace) {
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+           ++pointIndex) {
+        const real value = expected[ltsFace][pointIndex];
+        REQUIRE(actual[ltsFace][pointIndex] ==
+                AbsApprox(value).epsilon(epsilon * std::max(static_cast<real>(1.0),
+                                                            std::abs(value))));
+      }
+    }
+  };
+  compare(faceLayer.lts.mu);
+  compare(faceLayer.lts.slipRateMagnitude);
+  compare(faceLayer.lts.slipRate1);
+  compare(faceLayer.lts.slipRate2);
+  compare(faceLayer.lts.slip1);
+  compare(faceLayer.lts.slip2);
+  compare(faceLayer.lts.accumulatedSlipMagnitude);
+  compare(faceLayer.lts.traction1);
+  compare(faceLayer.lts.traction2);
+  compare(faceLayer.lts.peakSlipRate);
+  compare(faceLayer.lts.ruptureTime);
+  compare(faceLayer.lts.dynStressTime);
+
+  using ImposedStateShapeT = real(*)[misc::numQuantities][misc::numPaddedPoints];
+  auto compareImposedState = [&](auto const& handle) {
+    auto* expected = reinterpret_cast<ImposedStateShapeT>(faceLayer.layer().var(handle));
+    auto* actual = reinterpret_cast<ImposedStateShapeT>(batchLayer.layer().var(handle));
+    for (unsigned ltsFace = 0; ltsFace < numberOfFaces; ++ltsFace) {
+      for (unsigned quantity = 0; quantity < misc::numQuantities; ++quantity) {
+        for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+             ++pointIndex) {
+          const real value = expected[ltsFace][quantity][pointIndex];
+          REQUIRE(actual[ltsFace][quantity][pointIndex] ==
+                  AbsApprox(value).epsilon(epsilon * std::max(static_cast<real>(1.0),
+                                                              std::abs(value))));
+        }
+      }
+    }
+  };
+  compareImposedState(faceLayer.lts.imposedStatePlus);
+  compareImposedState(faceLayer.lts.imposedStateMinus);
+
+  // the nucleation stress is added in both paths
+  const auto* expectedStress = faceLayer.layer().var(faceLayer.lts.initialStressInFaultCS);
+  const auto* actualStress = batchLayer.layer().var(batchLayer.lts.initialStressInFaultCS);
+  for (unsigned ltsFace = 0; ltsFace < numberOfFaces; ++ltsFace) {
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; ++pointIndex) {
+      for (unsigned i = 0; i < 6; ++i) {
+        const real value = expectedStress[ltsFace][pointIndex][i];
+        REQUIRE(actualStress[ltsFace][pointIndex][i] ==
+                AbsApprox(value).epsilon(epsilon * std::max(static_cast<real>(1.0),
+                                                            std::abs(value))));
+      }
+    }
+  }
+
+  // the test is only meaningful if some points slip and weaken
+  const auto* slipRate = faceLayer.layer().var(faceLayer.lts.peakSlipRate);
+  const auto* mu = faceLayer.layer().var(faceLayer.lts.mu);
+  const auto* muS = faceLayer.layer().var(faceLayer.lts.muS);
+  unsigned numberOfSlippingPoints = 0;
+  unsigned numberOfWeakenedPoints = 0;
+  for (unsigned ltsFace = 0; ltsFace < numberOfFaces; ++ltsFace) {
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; ++pointIndex) {
+      numberOfSlippingPoints += slipRate[ltsFace][pointIndex] > 0;
+      numberOfWeakenedPoints += mu[ltsFace][pointIndex] < muS[ltsFace][pointIndex];
+    }
+  }
+  REQUIRE(numberOfSlippingPoints > 0);
+  REQUIRE(numberOfWeakenedPoints > 0);
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_LINEARSLIPWEAKENING_T_H
@@ -0,0 +1,308 @@
+#ifndef SEISSOL_RATEANDSTATE_T_H
+#define SEISSOL_RATEANDSTATE_T_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+#include "DynamicRupture/Misc.h"
+#include "DynamicRupture/Parameters.h"
+#include "DynamicRupture/FrictionLaws/FrictionLaws.h"
+#include "tests/TestHelper.h"
+
+namespace seissol::unit_test::dr {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+/**
+ * Aging law on a single face whose parameters are stored in the class instead of the LTS tree.
+ */
+class RateAndStateTestLaw : public friction_law::AgingLaw<friction_law::NoTP> {
+  public:
+  static constexpr real NormalStress = -50e6;
+  static constexpr real StateVariable = 1.0;
+
+  explicit RateAndStateTestLaw(DRParameters* drParameters) : AgingLaw(drParameters) {
+    this->a = faceA;
+    this->sl0 = faceSl0;
+    this->stateVariable = faceStateVariable;
+    this->impAndEta = faceImpAndEta;
+    this->initialStressInFaultCS = faceInitialStress;
+    this->initialPressure = faceInitialPressure;
+    this->mu = faceMu;
+    this->slipRateMagnitude = faceSlipRateMagnitude;
+    this->slipRate1 = faceSlipRate1;
+    this->slipRate2 = faceSlipRate2;
+    this->traction1 = faceTraction1;
+    this->traction2 = faceTraction2;
+    this->accumulatedSlipMagnitude = faceAccumulatedSlip;
+    this->slip1 = faceSlip1;
+    this->slip2 = faceSlip2;
+    std::fill_n(this->deltaT, CONVERGENCE_ORDER, 1e-4);
+
+    faceImpAndEta[0].etaS = 4.6e6;
+    faceImpAndEta[0].invEtaS = 1.0 / faceImpAndEta[0].etaS;
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      faceA[0][pointIndex] = 0.01;
+      faceSl0[0][pointIndex] = 0.02;
+      faceStateVariable[0][pointIndex] = StateVariable;
+      faceInitialStress[0][pointIndex][0] = NormalStress;
+      // the shear stress differs between the points, such that their Newton iterations do as well
+      faceInitialStress[0][pointIndex][3] = 30e6 + 1e5 * pointIndex;
+    }
+  }
+
+  real shearStress(unsigned pointIndex) const { return faceInitialStress[0][pointIndex][3]; }
+
+  real& slipRate(unsigned pointIndex) { return faceSlipRateMagnitude[0][pointIndex]; }
+  void setSlipRateVector(real slipRate1, real slipRate2) {
+    std::fill_n(faceSlipRate1[0], misc::numPaddedPoints, slipRate1);
+    std::fill_n(faceSlipRate2[0], misc::numPaddedPoints, slipRate2);
+  }
+  real tractionResult(unsigned pointIndex) const { return faceTraction1[0][pointIndex]; }
+  real timeStep() const { return this->deltaT[0]; }
+
+  private:
+  alignas(ALIGNMENT) real faceA[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceSl0[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceStateVariable[1][misc::numPaddedPoints]{};
+  ImpedancesAndEta faceImpAndEta[1]{};
+  alignas(ALIGNMENT) real faceInitialStress[1][misc::numPaddedPoints][6]{};
+  alignas(ALIGNMENT) real faceInitialPressure[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceMu[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceSlipRateMagnitude[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceSlipRate1[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceSlipRate2[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceTraction1[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceTraction2[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceAccumulatedSlip[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceSlip1[1][misc::numPaddedPoints]{};
+  alignas(ALIGNMENT) real faceSlip2[1][misc::numPaddedPoints]{};
+};
+
+/**
+ * The Newton iteration before the convergence mask: all points are updated until the residuals of
+ * all points are below the tolerance.
+ * @return number of iterations
+ */
+inline unsigned invertSlipRateAllPoints(RateAndStateTestLaw& law,
+                                        std::array<real, misc::numPaddedPoints> const& stateVariable,
+                                        std::array<real, misc::numPaddedPoints> const& normalStress,
+                                        std::array<real, misc::numPaddedPoints> const& shearStress,
+                                        std::array<real, misc::numPaddedPoints>& slipRate) {
+  const double invEtaS = 1.0 / 4.6e6;
+  for (unsigned i = 0; i < friction_law::rs::Settings::maxNumberSlipRateUpdates; i++) {
+    double g[misc::numberOfBoundaryGaussPoints];
+    double dG[misc::numberOfBoundaryGaussPoints];
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      const double muF = law.updateMu(0, pointIndex, slipRate[pointIndex], stateVariable[pointIndex]);
+      const double dMuF =
+          law.updateMuDerivative(0, pointIndex, slipRate[pointIndex], stateVariable[pointIndex]);
+      g[pointIndex] =
+          -invEtaS * (std::fabs(normalStress[pointIndex]) * muF - shearStress[pointIndex]) -
+          slipRate[pointIndex];
+      dG[pointIndex] = -invEtaS * (std::fabs(normalStress[pointIndex]) * dMuF) - 1.0;
+    }
+    if (std::all_of(std::begin(g), std::end(g), [](auto val) {
+          return std::fabs(val) < friction_law::rs::Settings::newtonTolerance;
+        })) {
+      return i;
+    }
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      slipRate[pointIndex] = std::max(friction_law::rs::almostZero(),
+                                      static_cast<real>(slipRate[pointIndex] - g[pointIndex] / dG[pointIndex]));
+    }
+  }
+  return friction_law::rs::Settings::maxNumberSlipRateUpdates;
+}
+
+TEST_CASE("Rate and state Newton iteration") {
+  DRParameters drParameters;
+  drParameters.rsF0 = 0.6;
+  drParameters.rsB = 0.014;
+  drParameters.rsSr0 = 1e-6;
+  RateAndStateTestLaw law(&drParameters);
+
+  // The residual tolerance 1e-8 can only be reached in double precision
+  constexpr bool isDoublePrecision = std::is_same_v<real, double>;
+  constexpr real epsilon = isDoublePrecision ? 1e-6 : 1e-3;
+  constexpr auto lastBin = friction_law::rs::Settings::maxNumberSlipRateUpdates;
+
+  std::array<real, misc::numPaddedPoints> stateVariable;
+  std::array<real, misc::numPaddedPoints> normalStress;
+  std::array<real, misc::numPaddedPoints> shearStress;
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    stateVariable[pointIndex] = RateAndStateTestLaw::StateVariable;
+    normalStress[pointIndex] = RateAndStateTestLaw::NormalStress;
+    shearStress[pointIndex] = law.shearStress(pointIndex);
+  }
+
+  // Reference solution of the iteration over all points
+  std::array<real, misc::numPaddedPoints> reference;
+  reference.fill(0.1);
+  const auto referenceIterations =
+      invertSlipRateAllPoints(law, stateVariable, normalStress, shearStress, reference);
+  if constexpr (isDoublePrecision) {
+    REQUIRE(referenceIterations < lastBin);
+  }
+
+  const auto countedPoints = [&]() {
+    const auto& counts = law.getNewtonUpdateCounts();
+    return std::accumulate(counts.begin(), counts.end(), 0ULL);
+  };
+
+  SUBCASE("Agrees with the iteration over all points") {
+    std::array<real, misc::numPaddedPoints> slipRate;
+    slipRate.fill(0.1);
+    const bool hasConverged =
+        law.invertSlipRateIterative(0, stateVariable, normalStress, shearStress, slipRate);
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      REQUIRE(slipRate[pointIndex] == AbsApprox(reference[pointIndex]).epsilon(epsilon));
+    }
+    // Padded points do not take part
+    for (unsigned pointIndex = misc::numberOfBoundaryGaussPoints;
+         pointIndex < misc::numPaddedPoints;
+         pointIndex++) {
+      REQUIRE(slipRate[pointIndex] == static_cast<real>(0.1));
+    }
+    REQUIRE(countedPoints() == misc::numberOfBoundaryGaussPoints);
+    if constexpr (isDoublePrecision) {
+      REQUIRE(hasConverged);
+      // No point needs more updates than the iteration over all points
+      const auto& counts = law.getNewtonUpdateCounts();
+      for (unsigned bin = referenceIterations + 1; bin <= lastBin; bin++) {
+        REQUIRE(counts[bin] == 0);
+      }
+    }
+  }
+
+  SUBCASE("Converged points are masked") {
+    // Every other point starts from its solution, the others far away from it
+    std::array<real, misc::numPaddedPoints> slipRate;
+    unsigned convergedPoints = 0;
+    for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+      const bool isConverged = pointIndex % 2 == 0;
+      slipRate[pointIndex] = isConverged ? reference[pointIndex] : 1e-3;
+      convergedPoints += (isConverged && pointIndex < misc::numberOfBoundaryGaussPoints) ? 1 : 0;
+    }
+    const bool hasConverged =
+        law.invertSlipRateIterative(0, stateVariable, normalStress, shearStress, slipRate);
+    for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      REQUIRE(slipRate[pointIndex] == AbsApprox(reference[pointIndex]).epsilon(epsilon));
+    }
+    if constexpr (isDoublePrecision) {
+      REQUIRE(hasConverged);
+      for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints;
+           pointIndex += 2) {
+        // Converged points keep their slip rate exactly
+        REQUIRE(slipRate[pointIndex] == reference[pointIndex]);
+      }
+      REQUIRE(law.getNewtonUpdateCounts()[0] == convergedPoints);
+    }
+    REQUIRE(countedPoints() == misc::numberOfBoundaryGaussPoints);
+  }
+
+  SUBCASE("Stops early if all points have converged") {
+    if constexpr (isDoublePrecision) {
+      std::array<real, misc::numPaddedPoints> slipRate = reference;
+      REQUIRE(law.invertSlipRateIterative(0, stateVariable, normalStress, shearStress, slipRate));
+      REQUIRE(slipRate == reference);
+      REQUIRE(law.getNewtonUpdateCounts()[0] == misc::numberOfBoundaryGaussPoints);
+    }
+  }
+
+  SUBCASE("Points which do not converge are counted in the last bin") {
+    std::array<real, misc::numPaddedPoints> slipRate;
+    slipRate.fill(0.1);
+    stateVariable[0] = std::numeric_limits<real>::quiet_NaN();
+    const bool hasConverged =
+        law.invertSlipRateIterative(0, stateVariable, normalStress, shearStress, slipRate);
+    REQUIRE(!hasConverged);
+    REQUIRE(law.getNewtonUpdateCounts()[lastBin] >= 1);
+    REQUIRE(countedPoints() == misc::numberOfBoundaryGaussPoints);
+    for (unsigned pointIndex = 1; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+      REQUIRE(slipRate[pointIndex] == AbsApprox(reference[pointIndex]).epsilon(epsilon));
+    }
+  }
+
+  SUBCASE("Counts are handed over to the loop statistics once") {
+    std::array<real, misc::numPaddedPoints> slipRate;
+    slipRate.fill(0.1);
+    law.invertSlipRateIterative(0, stateVariable, normalStress, shearStress, slipRate);
+    LoopStatistics loopStatistics;
+    law.addToLoopStatistics(loopStatistics);
+    law.addToLoopStatistics(loopStatistics);
+    REQUIRE(loopStatistics.getHistogram("rateAndStateNewtonUpdates") == 0);
+    REQUIRE(countedPoints() == 0);
+  }
+}
+
+TEST_CASE("Rate and state warm start") {
+  DRParameters drParameters;
+  drParameters.rsF0 = 0.6;
+  drParameters.rsB = 0.014;
+  drParameters.rsSr0 = 1e-6;
+  FaultStresses faultStresses{};
+  constexpr real epsilon = std::is_same_v<real, double> ? 1e-6 : 1e-3;
+
+  // The slip rate vector of the previous time step, which is the cold start of the iteration
+  constexpr real previousSlipRate = 1e-3;
+
+  // The slip rate magnitude found at the previous time quadrature point is the solution of the first
+  // Newton solve of the next time quadrature point
+  RateAndStateTestLaw warmLaw(&drParameters);
+  std::array<real, misc::numPaddedPoints> stateVariable;
+  std::array<real, misc::numPaddedPoints> normalStress;
+  std::array<real, misc::numPaddedPoints> shearStress;
+  std::array<real, misc::numPaddedPoints> firstSolve;
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    stateVariable[pointIndex] = warmLaw.updateStateVariable(pointIndex,
+                                                            0,
+                                                            RateAndStateTestLaw::StateVariable,
+                                                            warmLaw.timeStep(),
+                                                            previousSlipRate);
+    normalStress[pointIndex] = RateAndStateTestLaw::NormalStress;
+    shearStress[pointIndex] = warmLaw.shearStress(pointIndex);
+    firstSolve[pointIndex] = 0.1;
+  }
+  invertSlipRateAllPoints(warmLaw, stateVariable, normalStress, shearStress, firstSolve);
+
+  RateAndStateTestLaw coldLaw(&drParameters);
+  for (auto* law : {&warmLaw, &coldLaw}) {
+    law->setSlipRateVector(previousSlipRate, 0.0);
+  }
+  for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; pointIndex++) {
+    warmLaw.slipRate(pointIndex) = firstSolve[pointIndex];
+    coldLaw.slipRate(pointIndex) = previousSlipRate;
+  }
+
+  for (auto* law : {&warmLaw, &coldLaw}) {
+    TractionResults tractionResults{};
+    std::array<real, misc::numPaddedPoints> stateVariableBuffer;
+    std::array<real, misc::numPaddedPoints> strengthBuffer{};
+    stateVariableBuffer.fill(RateAndStateTestLaw::StateVariable);
+    law->updateFrictionAndSlip(
+        faultStresses, tractionResults, stateVariableBuffer, strengthBuffer, 0, 0);
+  }
+
+  if constexpr (std::is_same_v<real, double>) {
+    // The first of the state variable updates does not need any Newton update with the warm start
+    REQUIRE(warmLaw.getNewtonUpdateCounts()[0] >= misc::numberOfBoundaryGaussPoints);
+    REQUIRE(coldLaw.getNewtonUpdateCounts()[0] < misc::numberOfBoundaryGaussPoints);
+  }
+  // Both start values lead to the same solution
+  for (unsigned pointIndex = 0; pointIndex < misc::numberOfBoundaryGaussPoints; pointIndex++) {
+    REQUIRE(warmLaw.slipRate(pointIndex) ==
+            AbsApprox(coldLaw.slipRate(pointIndex)).epsilon(epsilon));
+    REQUIRE(warmLaw.tractionResult(pointIndex) ==
+            AbsApprox(coldLaw.tractionResult(pointIndex)).epsilon(epsilon * 1e7));
+  }
+}
+
+} // namespace seissol::unit_test::dr
+
+#endif // SEISSOL_RATEANDSTATE_T_H
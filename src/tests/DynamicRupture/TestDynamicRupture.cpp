@@ -1,5 +1,7 @@
 #include "doctest.h"
 
 #include "FrictionLaws/FrictionSolverCommon.t.h"
+#include "FrictionLaws/LinearSlipWeakening.t.h"
+#include "FrictionLaws/RateAndState.t.h"
 #include "Output/Geometry.t.h"
 #include "Output/Variables.t.h"
@@ -0,0 +1,34 @@
+#include <array>
+
+#include "Initializer/DeduplicatedTable.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Deduplicated table") {
+  using Value = std::array<double, 3>;
+  seissol::initializers::DeduplicatedTable<Value> table;
+
+  const Value* first = table.insert({1.0, 2.0, 3.0});
+  const Value* second = table.insert({1.0, 2.0, 4.0});
+  REQUIRE(first != second);
+  REQUIRE(table.size() == 2);
+
+  SUBCASE("Equal values are stored once") {
+    const Value* repeated = table.insert({1.0, 2.0, 3.0});
+    REQUIRE(repeated == first);
+    REQUIRE(table.size() == 2);
+    REQUIRE(table.getNumberOfInsertions() == 3);
+  }
+
+  SUBCASE("Stored values keep their address") {
+    for (unsigned i = 0; i < 1000; ++i) {
+      table.insert({static_cast<double>(i), 0.0, 0.0});
+    }
+    REQUIRE(table.size() == 1002);
+    REQUIRE(*first == Value{1.0, 2.0, 3.0});
+    REQUIRE(*second == Value{1.0, 2.0, 4.0});
+    REQUIRE(table.insert({1.0, 2.0, 4.0}) == second);
+  }
+}
+
+} // namespace seissol::unit_test
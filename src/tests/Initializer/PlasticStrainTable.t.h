@@ -0,0 +1,36 @@
+#include <algorithm>
+
+#include "Initializer/PlasticStrainTable.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Plastic strain table") {
+  using seissol::initializers::PlasticStrainTable;
+  PlasticStrainTable table(seissol::memory::Standard, 4);
+
+  real* first = table.acquire();
+  std::fill_n(first, PlasticStrainTable::SlotSize, static_cast<real>(1.0));
+  REQUIRE(table.size() == 1);
+
+  SUBCASE("Slots are zeroed and do not overlap") {
+    for (unsigned i = 0; i < 10; ++i) {
+      real* slot = table.acquire();
+      REQUIRE(std::all_of(slot, slot + PlasticStrainTable::SlotSize, [](real v) { return v == 0.0; }));
+      std::fill_n(slot, PlasticStrainTable::SlotSize, static_cast<real>(2.0));
+    }
+    REQUIRE(table.size() == 11);
+    REQUIRE(std::all_of(first, first + PlasticStrainTable::SlotSize, [](real v) { return v == 1.0; }));
+  }
+
+  SUBCASE("Reserved slots are contiguous") {
+    table.reserve(10);
+    real* previous = table.acquire();
+    for (unsigned i = 0; i < 9; ++i) {
+      real* slot = table.acquire();
+      REQUIRE(slot == previous + PlasticStrainTable::SlotSize);
+      previous = slot;
+    }
+  }
+}
+
+} // namespace seissol::unit_test
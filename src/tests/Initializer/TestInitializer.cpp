@@ -2,4 +2,8 @@
 #include "tests/TestHelper.h"
 
 #include "time_stepping/LTSWeights.t.h"
-#include "PointMapper.t.h"
\ No newline at end of file
+#include "time_stepping/LtsLayout.t.h"
+#include "time_stepping/SpaceFillingCurve.t.h"
+#include "PointMapper.t.h"
+#include "DeduplicatedTable.t.h"
+#include "PlasticStrainTable.t.h"
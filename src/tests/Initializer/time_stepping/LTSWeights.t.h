@@ -2,6 +2,7 @@
 #include "Initializer/time_stepping/LtsWeights/WeightsModels.h"
 #include <memory>
 #include <numeric>
+#include <sstream>
 
 namespace seissol::unit_test {
 
@@ -83,6 +84,22 @@ TEST_CASE("Cost function for LTS") {
     }
   }
 
+  SUBCASE("Fixed cost per cluster time step") {
+    std::vector<int> clusterIds = {2, 0, 2, 2};
+    std::vector<int> cellCosts = {2, 1, 3, 1};
+    const auto clusterOverhead = 4.0;
+    const auto rate = 2U;
+    const auto dt = 0.5;
+
+    const auto is = computeLocalCostOfClustering(clusterIds, cellCosts, rate, 1.0, dt, clusterOverhead);
+
+    // Cluster 1 has no cells and hence no fixed cost
+    const auto costCluster0 = (1 + clusterOverhead) / dt;
+    const auto costCluster2 = (2 + 3 + 1 + clusterOverhead) / (rate * rate * dt);
+    const auto should = costCluster0 + costCluster2;
+    REQUIRE(AbsApprox(is).epsilon(eps) == should);
+  }
+
   SUBCASE("Three clusters") {
     std::vector<int> clusterIds = {2, 0, 1, 1, 1};
     std::vector<int> cellCosts = {2, 1, 3, 1, 2};
@@ -187,4 +204,59 @@ TEST_CASE("Auto merging of clusters") {
   }
 }
 
+TEST_CASE("Measured vertex weights") {
+  using namespace initializers::time_stepping;
+  const LtsWeightsConfig config{"", 2, 100, 200, 300};
+
+  SUBCASE("Dynamic rupture") {
+    std::stringstream costs("region,constant,perElement\n"
+                            "computeLocalIntegration,1e-4,2e-6\n"
+                            "computeNeighboringIntegration,1e-4,1e-6\n"
+                            "computeDynamicRupture,1e-5,1.5e-5\n");
+    const auto calibrated = calibrateVertexWeights(config, costs);
+    REQUIRE(calibrated.vertexWeightElement == 100);
+    REQUIRE(calibrated.vertexWeightDynamicRupture == 250);
+    REQUIRE(calibrated.vertexWeightFreeSurfaceWithGravity == 300);
+  }
+
+  SUBCASE("Plasticity") {
+    std::stringstream costs("region,constant,perElement\n"
+                            "computeLocalIntegration,1e-4,2e-6\n"
+                            "computeNeighboringIntegration,1e-4,1e-6\n"
+                            "computePlasticity,1e-5,2e-6\n"
+                            "computeDynamicRupture,1e-5,1.5e-5\n");
+    const auto calibrated = calibrateVertexWeights(config, costs);
+    REQUIRE(calibrated.vertexWeightDynamicRupture == 150);
+  }
+
+  SUBCASE("Malformed lines") {
+    std::stringstream costs("region,constant,perElement\n"
+                            "computeLocalIntegration,1e-4,2e-6\n"
+                            "computeNeighboringIntegration,1e-4,1e-6\n"
+                            "computePlasticity,1e-5,1e999\n"
+                            "computePlasticity,1e-5,2e-6,1\n"
+                            "computePlasticity,1e-5,2e-6x\n"
+                            "computePlasticity,1e-5,nan\n"
+                            "computePlasticity\n"
+                            "computeDynamicRupture,1e-5,1.5e-5\n");
+    const auto calibrated = calibrateVertexWeights(config, costs);
+    REQUIRE(calibrated.vertexWeightDynamicRupture == 250);
+  }
+
+  SUBCASE("Missing header") {
+    std::stringstream costs("computeLocalIntegration,1e-4,2e-6\n"
+                            "computeNeighboringIntegration,1e-4,1e-6\n"
+                            "computeDynamicRupture,1e-5,1.5e-5\n");
+    const auto calibrated = calibrateVertexWeights(config, costs);
+    REQUIRE(calibrated.vertexWeightDynamicRupture == 200);
+  }
+
+  SUBCASE("Missing element costs") {
+    std::stringstream costs("region,constant,perElement\n"
+                            "computeDynamicRupture,1e-5,3e-6\n");
+    const auto calibrated = calibrateVertexWeights(config, costs);
+    REQUIRE(calibrated.vertexWeightDynamicRupture == 200);
+  }
+}
+
 } // namespace seissol::unit_test
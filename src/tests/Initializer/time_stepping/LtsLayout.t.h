@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Initializer/time_stepping/LtsLayout.h"
+#include "Initializer/time_stepping/common.hpp"
+#include "Kernels/TimeCommon.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::unit_test {
+
+/**
+ * Layout of a mesh without MPI neighbors, whose clustering is given.
+ * The interior of every cluster is sorted by mesh id, as after deriveClusteredCopyInterior.
+ */
+class ClusteredLtsLayout : public initializers::time_stepping::LtsLayout {
+  public:
+  ClusteredLtsLayout(const std::vector<Element>& cells,
+                     const std::vector<unsigned>& clusterIds,
+                     unsigned numberOfClusters,
+                     const std::vector<std::uint64_t>& curveIndices) {
+    m_cells = cells;
+    // freed by the LtsLayout
+    m_cellClusterIds = new unsigned int[cells.size()];
+    std::copy(clusterIds.begin(), clusterIds.end(), m_cellClusterIds);
+    m_cellCurveIndices = curveIndices;
+
+    m_localClusters.resize(numberOfClusters);
+    m_clusteredInterior.resize(numberOfClusters);
+    m_clusteredCopy.resize(numberOfClusters);
+    m_clusteredGhost.resize(numberOfClusters);
+    for (unsigned cluster = 0; cluster < numberOfClusters; ++cluster) {
+      m_localClusters[cluster] = cluster;
+    }
+    for (unsigned cell = 0; cell < cells.size(); ++cell) {
+      m_clusteredInterior[clusterIds[cell]].push_back(cell);
+    }
+  }
+
+  using LtsLayout::sortClusteredInterior;
+
+  const std::vector<std::vector<unsigned>>& clusteredInterior() const {
+    return m_clusteredInterior;
+  }
+};
+
+/**
+ * A random mesh in a single rank: face 0 is always regular, the other faces are mostly regular or
+ * periodic. The face neighbors are random and not necessarily symmetric, which does not matter for
+ * the layout.
+ */
+std::vector<Element> randomInteriorMesh(unsigned numberOfCells, std::mt19937& generator) {
+  constexpr FaceType FaceTypes[] = {FaceType::regular,
+                                    FaceType::regular,
+                                    FaceType::regular,
+                                    FaceType::periodic,
+                                    FaceType::freeSurface,
+                                    FaceType::outflow,
+                                    FaceType::dynamicRupture};
+  std::uniform_int_distribution<unsigned> faceTypeDistribution(0, std::size(FaceTypes) - 1);
+  std::uniform_int_distribution<int> neighborDistribution(0, numberOfCells - 1);
+  std::uniform_int_distribution<int> sideDistribution(0, 3);
+  std::uniform_int_distribution<int> orientationDistribution(0, 2);
+
+  std::vector<Element> cells(numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    cells[cell].localId = cell;
+    for (unsigned face = 0; face < 4; ++face) {
+      const auto faceType =
+          face == 0 ? FaceType::regular : FaceTypes[faceTypeDistribution(generator)];
+      cells[cell].boundaries[face] = static_cast<int>(faceType);
+      cells[cell].neighborRanks[face] = MPI::mpi.rank();
+      cells[cell].mpiIndices[face] = -1;
+      cells[cell].neighborSides[face] = sideDistribution(generator);
+      cells[cell].sideOrientations[face] = orientationDistribution(generator);
+      int neighbor = neighborDistribution(generator);
+      while (neighbor == static_cast<int>(cell)) {
+        neighbor = neighborDistribution(generator);
+      }
+      cells[cell].neighbors[face] = neighbor;
+    }
+  }
+  return cells;
+}
+
+TEST_CASE("LTS layout groups the interior by face types and LTS setup") {
+  constexpr unsigned NumberOfCells = 400;
+  constexpr unsigned NumberOfClusters = 3;
+  std::mt19937 generator(20240701);
+
+  const auto cells = randomInteriorMesh(NumberOfCells, generator);
+  std::vector<unsigned> clusterIds(NumberOfCells);
+  // most cells are in the first cluster, such that many cells have only neighbors with the same
+  // time step
+  std::discrete_distribution<unsigned> clusterDistribution({12, 3, 1});
+  for (auto& clusterId : clusterIds) {
+    clusterId = clusterDistribution(generator);
+  }
+
+  for (const bool useCurve : {false, true}) {
+    CAPTURE(useCurve);
+    std::vector<std::uint64_t> curveIndices(NumberOfCells, 0);
+    if (useCurve) {
+      std::uniform_int_distribution<std::uint64_t> curveDistribution(0, NumberOfCells / 4);
+      for (auto& curveIndex : curveIndices) {
+        curveIndex = curveDistribution(generator);
+      }
+    }
+
+    ClusteredLtsLayout layout(cells, clusterIds, NumberOfClusters, curveIndices);
+    const auto unsortedInterior = layout.clusteredInterior();
+    layout.sortClusteredInterior();
+    const auto& interior = layout.clusteredInterior();
+
+    // the interior of every cluster is a permutation of the cluster's cells
+    REQUIRE(interior.size() == NumberOfClusters);
+    for (unsigned cluster = 0; cluster < NumberOfClusters; ++cluster) {
+      REQUIRE(std::is_permutation(interior[cluster].begin(),
+                                  interior[cluster].end(),
+                                  unsortedInterior[cluster].begin(),
+                                  unsortedInterior[cluster].end()));
+    }
+
+    // derive the LTS setups as in the initialization
+    std::vector<CellLocalInformation> cellInformation(NumberOfCells);
+    unsigned* ltsToMesh = nullptr;
+    unsigned numberOfMeshCells = 0;
+    layout.getCellInformation(cellInformation.data(), ltsToMesh, numberOfMeshCells);
+    const auto ltsToMeshGuard = std::unique_ptr<unsigned[]>(ltsToMesh);
+    REQUIRE(numberOfMeshCells == NumberOfCells);
+
+    std::vector<MeshStructure> meshStructure(NumberOfClusters);
+    for (unsigned cluster = 0; cluster < NumberOfClusters; ++cluster) {
+      meshStructure[cluster] = MeshStructure{};
+      meshStructure[cluster].numberOfInteriorCells = interior[cluster].size();
+    }
+    initializers::time_stepping::deriveLtsSetups(
+        NumberOfClusters, meshStructure.data(), cellInformation.data());
+
+    // the LTS cells follow the sorted interior, and the face neighbors point to the same mesh cells
+    unsigned ltsCell = 0;
+    for (unsigned cluster = 0; cluster < NumberOfClusters; ++cluster) {
+      for (const auto meshId : interior[cluster]) {
+        REQUIRE(ltsToMesh[ltsCell] == meshId);
+        REQUIRE(cellInformation[ltsCell].clusterId == cluster);
+        for (unsigned face = 0; face < 4; ++face) {
+          const auto faceType = cellInformation[ltsCell].faceTypes[face];
+          REQUIRE(faceType == static_cast<FaceType>(cells[meshId].boundaries[face]));
+          if (faceType == FaceType::regular || faceType == FaceType::periodic ||
+              faceType == FaceType::dynamicRupture) {
+            REQUIRE(ltsToMesh[cellInformation[ltsCell].faceNeighborIds[face]] ==
+                    static_cast<unsigned>(cells[meshId].neighbors[face]));
+          }
+        }
+        ++ltsCell;
+      }
+    }
+
+    // cells with the same face types and LTS setup are contiguous, and are ordered along the curve
+    // and the mesh
+    using Group = std::pair<std::array<FaceType, 4>, unsigned short>;
+    auto groupOf = [&](unsigned cell) {
+      Group group;
+      std::copy_n(cellInformation[cell].faceTypes, 4, group.first.begin());
+      group.second = cellInformation[cell].ltsSetup;
+      return group;
+    };
+    unsigned numberOfRegularGtsCells = 0;
+    unsigned numberOfNormalizedCells = 0;
+    ltsCell = 0;
+    for (unsigned cluster = 0; cluster < NumberOfClusters; ++cluster) {
+      std::set<Group> finishedGroups;
+      for (unsigned cell = 0; cell < interior[cluster].size(); ++cell, ++ltsCell) {
+        const auto group = groupOf(ltsCell);
+        if (cell > 0 && groupOf(ltsCell - 1) == group) {
+          const auto previous = interior[cluster][cell - 1];
+          const auto current = interior[cluster][cell];
+          REQUIRE(std::make_pair(curveIndices[previous], previous) <
+                  std::make_pair(curveIndices[current], current));
+        } else {
+          REQUIRE(finishedGroups.count(group) == 0);
+          finishedGroups.insert(group);
+        }
+
+        // count the cells which are computed by the regular kernels, and the cells which have the same
+        // face types and cluster relations, but differ by the normalization of the LTS setup
+        if (kernels::TimeCommon::isRegularGtsCell(cellInformation[ltsCell])) {
+          ++numberOfRegularGtsCells;
+        } else if (std::all_of(std::begin(cellInformation[ltsCell].faceTypes),
+                               std::end(cellInformation[ltsCell].faceTypes),
+                               [](FaceType faceType) { return faceType == FaceType::regular; }) &&
+                   (cellInformation[ltsCell].ltsSetup >> 4) % 16 == 15) {
+          ++numberOfNormalizedCells;
+        }
+      }
+    }
+    // the mesh covers the common group as well as the normalization
+    REQUIRE(numberOfRegularGtsCells > 0);
+    REQUIRE(numberOfNormalizedCells > 0);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Initializer/time_stepping/SpaceFillingCurve.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Space filling curves") {
+  using namespace seissol::initializers::time_stepping;
+  constexpr unsigned Bits = 3;
+  constexpr std::uint32_t Size = 1U << Bits;
+
+  std::vector<std::array<std::uint32_t, 3>> grid;
+  for (std::uint32_t x = 0; x < Size; ++x) {
+    for (std::uint32_t y = 0; y < Size; ++y) {
+      for (std::uint32_t z = 0; z < Size; ++z) {
+        grid.push_back({x, y, z});
+      }
+    }
+  }
+
+  SUBCASE("Morton index interleaves the bits") {
+    REQUIRE(mortonIndex({0, 0, 0}, Bits) == 0);
+    REQUIRE(mortonIndex({0, 0, 1}, Bits) == 1);
+    REQUIRE(mortonIndex({1, 1, 1}, Bits) == 7);
+    REQUIRE(mortonIndex({2, 0, 0}, Bits) == 32);
+    REQUIRE(mortonIndex({Size - 1, Size - 1, Size - 1}, Bits) == Size * Size * Size - 1);
+  }
+
+  SUBCASE("Hilbert curve visits every grid point once along face neighbors") {
+    std::vector<std::pair<std::uint64_t, std::array<std::uint32_t, 3>>> curve;
+    for (const auto& point : grid) {
+      curve.emplace_back(hilbertIndex(point, Bits), point);
+    }
+    std::sort(curve.begin(), curve.end());
+
+    for (std::size_t i = 0; i < curve.size(); ++i) {
+      REQUIRE(curve[i].first == i);
+    }
+    for (std::size_t i = 1; i < curve.size(); ++i) {
+      int distance = 0;
+      for (unsigned d = 0; d < 3; ++d) {
+        distance += std::abs(static_cast<int>(curve[i].second[d]) - static_cast<int>(curve[i - 1].second[d]));
+      }
+      REQUIRE(distance == 1);
+    }
+  }
+
+  SUBCASE("Curve indices of points") {
+    const std::vector<std::array<double, 3>> points = {
+        {0.0, 0.0, 0.0}, {10.0, 10.0, 10.0}, {0.1, 0.0, 0.0}, {9.9, 10.0, 10.0}};
+    const auto mesh = curveIndices(CellOrdering::Mesh, points);
+    REQUIRE(std::all_of(mesh.begin(), mesh.end(), [](auto index) { return index == 0; }));
+
+    for (const auto ordering : {CellOrdering::Morton, CellOrdering::Hilbert}) {
+      const auto indices = curveIndices(ordering, points);
+      REQUIRE(indices[0] == 0);
+      REQUIRE(std::set<std::uint64_t>(indices.begin(), indices.end()).size() == points.size());
+      // nearby points are closer on the curve than distant ones
+      REQUIRE(std::max(indices[0], indices[2]) < std::min(indices[1], indices[3]));
+    }
+  }
+
+  SUBCASE("Parsing") {
+    REQUIRE(parseCellOrdering("Hilbert") == CellOrdering::Hilbert);
+    REQUIRE(parseCellOrdering("morton") == CellOrdering::Morton);
+    REQUIRE(parseCellOrdering("mesh") == CellOrdering::Mesh);
+    REQUIRE_THROWS(parseCellOrdering("random"));
+  }
+}
+
+} // namespace seissol::unit_test
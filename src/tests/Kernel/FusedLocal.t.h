@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "generated_code/tensor.h"
+#include "Initializer/GlobalData.h"
+#include "Initializer/LTS.h"
+#include "Initializer/MemoryAllocator.h"
+#include "Initializer/tree/LTSTree.hpp"
+#include "Kernels/Interface.hpp"
+#include "Kernels/Local.h"
+#include "Kernels/Neighbor.h"
+#include "Kernels/Time.h"
+#include "tests/TestHelper.h"
+
+namespace seissol::unit_test {
+
+/**
+ * Interior cells with random DOFs, star matrices and flux solvers, and the kernels of the local and the neighboring step.
+ * Two instances with the same seed hold identical cells.
+ */
+class LocalIntegrationCells {
+  public:
+  // whole batches of the batched local kernel
+  static constexpr unsigned NumberOfCells = 8 * kernels::CellBatchSize;
+  static constexpr double TimeStepWidth = 1e-3;
+
+  explicit LocalIntegrationCells(unsigned seed) {
+    initializers::GlobalDataInitializerOnHost::init(globalData, allocator, memory::Standard);
+    localKernel.setHostGlobalData(&globalData);
+    neighborKernel.setHostGlobalData(&globalData);
+    timeKernel.setHostGlobalData(&globalData);
+
+    lts.addTo(tree, false);
+    tree.setNumberOfTimeClusters(1);
+    tree.fixate();
+    tree.child(0).child<Ghost>().setNumberOfCells(0);
+    tree.child(0).child<Copy>().setNumberOfCells(0);
+    tree.child(0).child<Interior>().setNumberOfCells(NumberOfCells);
+    tree.allocateVariables();
+    tree.touchVariables();
+    loader.load(lts, layer());
+    neighborLoader.load(lts, layer());
+
+    std::mt19937 generator(seed);
+    fill(layer().var(lts.dofs), generator);
+    fill(layer().var(lts.localIntegration), generator);
+    fill(layer().var(lts.neighboringIntegration), generator);
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+    // the face geometry has to be a valid orthonormal basis
+    fill(&godunovStates, 1, generator);
+    auto* neighboringIntegration = layer().var(lts.neighboringIntegration);
+    for (unsigned cell = 0; cell < NumberOfCells; ++cell) {
+      for (auto& face : neighboringIntegration[cell].faces) {
+        face = FaceFluxSolverData{
+            &godunovStates, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, -0.5};
+      }
+    }
+#endif
+
+    // the cells differ in whether they provide buffers, derivatives or both
+    constexpr unsigned short ltsSetups[] = {
+        1 << 8, (1 << 9) | 0x1, (1 << 8) | (1 << 9) | 0x30, (1 << 8) | (1 << 10) | 0x5};
+    auto* cellInformation = layer().var(lts.cellInformation);
+    for (unsigned cell = 0; cell < NumberOfCells; ++cell) {
+      std::fill(std::begin(cellInformation[cell].faceTypes),
+                std::end(cellInformation[cell].faceTypes),
+                cell % 2 == 0 ? FaceType::regular : FaceType::freeSurface);
+      cellInformation[cell].ltsSetup = ltsSetups[cell % std::size(ltsSetups)];
+    }
+
+    integrated = static_cast<real*>(allocator.allocateMemory(
+        NumberOfCells * tensor::I::size() * sizeof(real), PAGESIZE_STACK, memory::Standard));
+    derivatives = static_cast<real*>(
+        allocator.allocateMemory(NumberOfCells * yateto::computeFamilySize<tensor::dQ>() * sizeof(real),
+                                 PAGESIZE_STACK,
+                                 memory::Standard));
+    std::fill_n(integrated, NumberOfCells * tensor::I::size(), 0);
+    std::fill_n(derivatives, NumberOfCells * yateto::computeFamilySize<tensor::dQ>(), 0);
+  }
+
+  initializers::Layer& layer() { return tree.child(0).child<Interior>(); }
+
+  real* timeIntegrated(unsigned cell) { return integrated + cell * tensor::I::size(); }
+
+  //! the derivatives of the cell, or nullptr if its LTS setup does not store them
+  real* timeDerivatives(unsigned cell) {
+    const auto ltsSetup = layer().var(lts.cellInformation)[cell].ltsSetup;
+    if ((ltsSetup >> 9) % 2 == 0) {
+      return nullptr;
+    }
+    return derivatives + cell * yateto::computeFamilySize<tensor::dQ>();
+  }
+
+  initializers::LTS lts;
+  kernels::LocalData::Loader loader;
+  kernels::LocalTmp tmp;
+  kernels::NeighborData::Loader neighborLoader;
+  kernels::Local localKernel;
+  kernels::Neighbor neighborKernel;
+  kernels::Time timeKernel;
+
+  private:
+  template <typename T>
+  void fill(T* values, std::mt19937& generator) {
+    fill(values, NumberOfCells, generator);
+  }
+
+  template <typename T>
+  void fill(T* values, unsigned count, std::mt19937& generator) {
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    auto* reals = reinterpret_cast<real*>(values);
+    for (std::size_t i = 0; i < count * sizeof(T) / sizeof(real); ++i) {
+      reals[i] = distribution(generator);
+    }
+  }
+
+  memory::ManagedAllocator allocator;
+  GlobalData globalData;
+  initializers::LTSTree tree;
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+  FaceGodunovStates godunovStates;
+#endif
+  real* integrated = nullptr;
+  real* derivatives = nullptr;
+};
+
+//! Requires that all values agree up to rounding, relative to the largest value
+inline void compareValues(const real* expected, const real* actual, unsigned numberOfValues) {
+  constexpr double epsilon = 1e3 * std::numeric_limits<real>::epsilon();
+  double scale = 1.0;
+  for (unsigned i = 0; i < numberOfValues; ++i) {
+    scale = std::max(scale, static_cast<double>(std::abs(expected[i])));
+  }
+  for (unsigned i = 0; i < numberOfValues; ++i) {
+    REQUIRE(actual[i] == AbsApprox(expected[i]).epsilon(epsilon * scale));
+  }
+}
+
+TEST_CASE("Fused local integral") {
+  LocalIntegrationCells reference(20240611);
+  LocalIntegrationCells fused(20240611);
+  using Cells = LocalIntegrationCells;
+
+  SUBCASE("equals ADER and local integral") {
+    for (unsigned cell = 0; cell < Cells::NumberOfCells; ++cell) {
+      auto referenceData = reference.loader.entry(cell);
+      reference.timeKernel.computeAder(Cells::TimeStepWidth,
+                                       referenceData,
+                                       reference.tmp,
+                                       reference.timeIntegrated(cell),
+                                       reference.timeDerivatives(cell));
+      CellBoundaryMapping boundaryMapping[4]{};
+      reference.localKernel.computeIntegral(reference.timeIntegrated(cell),
+                                            referenceData,
+                                            reference.tmp,
+                                            nullptr,
+                                            &boundaryMapping,
+                                            0.0,
+                                            Cells::TimeStepWidth);
+
+      auto fusedData = fused.loader.entry(cell);
+      REQUIRE(fused.localKernel.computeFusedIntegral(Cells::TimeStepWidth,
+                                                     fusedData,
+                                                     fused.tmp,
+                                                     fused.timeIntegrated(cell),
+                                                     fused.timeDerivatives(cell)));
+
+      compareValues(referenceData.dofs, fusedData.dofs, tensor::Q::size());
+      compareValues(
+          reference.timeIntegrated(cell), fused.timeIntegrated(cell), tensor::I::size());
+      REQUIRE((reference.timeDerivatives(cell) == nullptr) ==
+              (fused.timeDerivatives(cell) == nullptr));
+      if (fused.timeDerivatives(cell) != nullptr) {
+        const real* referenceDerivative = reference.timeDerivatives(cell);
+        const real* fusedDerivative = fused.timeDerivatives(cell);
+        for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+          compareValues(referenceDerivative, fusedDerivative, tensor::dQ::size(i));
+          referenceDerivative += tensor::dQ::size(i);
+          fusedDerivative += tensor::dQ::size(i);
+        }
+      }
+    }
+  }
+
+  SUBCASE("skips cells with dynamic rupture faces") {
+    auto data = fused.loader.entry(0);
+    data.cellInformation.faceTypes[2] = FaceType::dynamicRupture;
+    alignas(ALIGNMENT) real dofs[tensor::Q::size()];
+    std::copy_n(data.dofs, tensor::Q::size(), dofs);
+
+    REQUIRE_FALSE(fused.localKernel.computeFusedIntegral(
+        Cells::TimeStepWidth, data, fused.tmp, fused.timeIntegrated(0), fused.timeDerivatives(0)));
+    REQUIRE(std::equal(dofs, dofs + tensor::Q::size(), data.dofs));
+  }
+}
+
+#ifdef HOST_CELL_BATCH
+TEST_CASE("Batched fused local integral") {
+  using Cells = LocalIntegrationCells;
+  constexpr auto BatchSize = kernels::CellBatchSize;
+  LocalIntegrationCells fused(20240612);
+  LocalIntegrationCells batched(20240612);
+
+  SUBCASE("equals the fused local integral in each lane") {
+    // the matrices are packed once and reused by every time step
+    const unsigned numberOfBatches = Cells::NumberOfCells / BatchSize;
+    std::vector<kernels::Local::CellBatchMatrices> matrices(numberOfBatches);
+    for (unsigned batch = 0; batch < numberOfBatches; ++batch) {
+      REQUIRE(batched.localKernel.packCellBatchMatrices(
+          batched.loader, batch * BatchSize, matrices[batch]));
+    }
+
+    for (unsigned step = 0; step < 2; ++step) {
+      CAPTURE(step);
+      for (unsigned batch = 0; batch < numberOfBatches; ++batch) {
+        const unsigned firstCell = batch * BatchSize;
+        real* timeIntegrated[BatchSize];
+        real* timeDerivatives[BatchSize];
+        for (unsigned lane = 0; lane < BatchSize; ++lane) {
+          timeIntegrated[lane] = batched.timeIntegrated(firstCell + lane);
+          timeDerivatives[lane] = batched.timeDerivatives(firstCell + lane);
+        }
+        batched.localKernel.computeFusedIntegralBatched(Cells::TimeStepWidth,
+                                                        batched.loader,
+                                                        firstCell,
+                                                        matrices[batch],
+                                                        timeIntegrated,
+                                                        timeDerivatives);
+
+        for (unsigned lane = 0; lane < BatchSize; ++lane) {
+          const unsigned cell = firstCell + lane;
+          auto fusedData = fused.loader.entry(cell);
+          REQUIRE(fused.localKernel.computeFusedIntegral(Cells::TimeStepWidth,
+                                                         fusedData,
+                                                         fused.tmp,
+                                                         fused.timeIntegrated(cell),
+                                                         fused.timeDerivatives(cell)));
+
+          compareValues(fusedData.dofs, batched.loader.entry(cell).dofs, tensor::Q::size());
+          compareValues(
+              fused.timeIntegrated(cell), batched.timeIntegrated(cell), tensor::I::size());
+          if (fused.timeDerivatives(cell) != nullptr) {
+            compareValues(fused.timeDerivatives(cell),
+                          batched.timeDerivatives(cell),
+                          yateto::computeFamilySize<tensor::dQ>());
+          }
+        }
+      }
+    }
+  }
+
+  SUBCASE("does not pack batches with a dynamic rupture face") {
+    batched.loader.entry(BatchSize - 1).cellInformation.faceTypes[0] = FaceType::dynamicRupture;
+    kernels::Local::CellBatchMatrices matrices;
+    REQUIRE_FALSE(batched.localKernel.packCellBatchMatrices(batched.loader, 0, matrices));
+  }
+}
+#endif
+
+} // namespace seissol::unit_test
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "generated_code/init.h"
+#include "generated_code/kernel.h"
+#include "generated_code/tensor.h"
+#include "Kernels/Plasticity.h"
+
+namespace seissol::unit_test {
+
+#ifndef MULTIPLE_SIMULATIONS
+// Evaluates the yield criterion of computePlasticity at all nodes
+inline bool exceedsYieldCriterion(const PlasticityData& plasticityData, real* degreesOfFreedom) {
+  alignas(ALIGNMENT) real QStressNodal[tensor::QStressNodal::size()];
+  kernel::plConvertToNodal m2nKrnl;
+  m2nKrnl.v = init::v::Values;
+  m2nKrnl.QStress = degreesOfFreedom;
+  m2nKrnl.QStressNodal = QStressNodal;
+  m2nKrnl.replicateInitialLoading = init::replicateInitialLoading::Values;
+  m2nKrnl.initialLoading = plasticityData.initialLoading;
+  m2nKrnl.execute();
+
+  auto stress = init::QStressNodal::view::create(QStressNodal);
+  for (unsigned k = 0; k < tensor::QStressNodal::Shape[0]; ++k) {
+    const double mean = (stress(k, 0) + stress(k, 1) + stress(k, 2)) / 3.0;
+    double secondInvariant = 0.0;
+    for (unsigned p = 0; p < 3; ++p) {
+      secondInvariant += 0.5 * (stress(k, p) - mean) * (stress(k, p) - mean);
+    }
+    for (unsigned p = 3; p < 6; ++p) {
+      secondInvariant += stress(k, p) * stress(k, p);
+    }
+    const double taulim = std::max(0.0,
+                                   plasticityData.cohesionTimesCosAngularFriction -
+                                       mean * plasticityData.sinAngularFriction);
+    if (std::sqrt(secondInvariant) > taulim) {
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST_CASE("Plasticity screening is conservative") {
+  PlasticityData plasticityData{};
+  const real initialLoading[6] = {-4.0e7, -5.0e7, -4.5e7, 2.0e6, -1.0e6, 5.0e5};
+  std::copy(std::begin(initialLoading), std::end(initialLoading), plasticityData.initialLoading);
+  plasticityData.cohesionTimesCosAngularFriction = 1.0e6 * std::cos(0.6);
+  plasticityData.sinAngularFriction = std::sin(0.6);
+
+  std::mt19937 generator(20231016);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  alignas(ALIGNMENT) real degreesOfFreedom[tensor::Q::size()];
+  unsigned numberOfScreenedCells = 0;
+  for (unsigned cell = 0; cell < 600; ++cell) {
+    // amplitudes from far below to far above the yield stress
+    const double amplitude = std::pow(10.0, 4.0 + 4.0 * (cell % 6) / 5.0);
+    std::fill(std::begin(degreesOfFreedom), std::end(degreesOfFreedom), 0.0);
+    auto QStress = init::QStress::view::create(degreesOfFreedom);
+    for (unsigned p = 0; p < 6; ++p) {
+      for (unsigned l = 0; l < tensor::QEtaModal::Shape[0]; ++l) {
+        QStress(l, p) = amplitude * distribution(generator) / (1.0 + l);
+      }
+    }
+
+    if (seissol::kernels::Plasticity::isBelowYieldSurface(&plasticityData, degreesOfFreedom)) {
+      ++numberOfScreenedCells;
+      REQUIRE_FALSE(exceedsYieldCriterion(plasticityData, degreesOfFreedom));
+    }
+  }
+  // the cells with small amplitudes are far from yielding and need to pass the screening
+  REQUIRE(numberOfScreenedCells >= 200);
+}
+#endif
+
+} // namespace seissol::unit_test
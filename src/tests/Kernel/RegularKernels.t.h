@@ -0,0 +1,91 @@
+#include <random>
+
+#include "Kernels/Neighbor.h"
+#include "Kernels/TimeCommon.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Regular kernels") {
+  using Cells = LocalIntegrationCells;
+  LocalIntegrationCells generic(20240702);
+  LocalIntegrationCells regular(20240702);
+
+  // regular GTS cells with random face relations, and random time integrated DOFs
+  std::mt19937 generator(20240703);
+  std::uniform_int_distribution<int> sideDistribution(0, 3);
+  std::uniform_int_distribution<int> orientationDistribution(0, 2);
+  std::uniform_real_distribution<double> valueDistribution(-1.0, 1.0);
+  for (unsigned cell = 0; cell < Cells::NumberOfCells; ++cell) {
+    CellLocalInformation cellInformation = generic.loader.entry(cell).cellInformation;
+    for (unsigned face = 0; face < 4; ++face) {
+      cellInformation.faceTypes[face] =
+          (cell + face) % 3 == 0 ? FaceType::periodic : FaceType::regular;
+      cellInformation.faceRelations[face][0] = sideDistribution(generator);
+      cellInformation.faceRelations[face][1] = orientationDistribution(generator);
+    }
+    cellInformation.ltsSetup = (1 << 8) | 0xF0;
+    REQUIRE(kernels::TimeCommon::isRegularGtsCell(cellInformation));
+    generic.loader.entry(cell).cellInformation = cellInformation;
+    regular.loader.entry(cell).cellInformation = cellInformation;
+
+    for (unsigned i = 0; i < tensor::I::size(); ++i) {
+      const real value = valueDistribution(generator);
+      generic.timeIntegrated(cell)[i] = value;
+      regular.timeIntegrated(cell)[i] = value;
+    }
+  }
+
+  SUBCASE("local integral equals the generic local integral") {
+    for (unsigned cell = 0; cell < Cells::NumberOfCells; ++cell) {
+#ifdef USE_VISCOELASTIC2
+      // the anelastic part of the time integrated DOFs is kept in the temporary memory
+      for (unsigned i = 0; i < tensor::Iane::size(); ++i) {
+        const real value = valueDistribution(generator);
+        generic.tmp.timeIntegratedAne[i] = value;
+        regular.tmp.timeIntegratedAne[i] = value;
+      }
+#endif
+      auto genericData = generic.loader.entry(cell);
+      CellBoundaryMapping boundaryMapping[4]{};
+      generic.localKernel.computeIntegral(generic.timeIntegrated(cell),
+                                          genericData,
+                                          generic.tmp,
+                                          nullptr,
+                                          &boundaryMapping,
+                                          0.0,
+                                          Cells::TimeStepWidth);
+
+      auto regularData = regular.loader.entry(cell);
+      regular.localKernel.computeRegularIntegral(
+          regular.timeIntegrated(cell), regularData, regular.tmp);
+
+      compareValues(genericData.dofs, regularData.dofs, tensor::Q::size());
+    }
+  }
+
+  SUBCASE("neighboring integral equals the generic neighboring integral") {
+    for (unsigned cell = 0; cell < Cells::NumberOfCells; ++cell) {
+      // the face neighbors are other cells of the layer
+      real* genericNeighbors[4];
+      real* regularNeighbors[4];
+      for (unsigned face = 0; face < 4; ++face) {
+        const unsigned neighbor = (cell + 3 * face + 1) % Cells::NumberOfCells;
+        genericNeighbors[face] = generic.timeIntegrated(neighbor);
+        regularNeighbors[face] = regular.timeIntegrated(neighbor);
+      }
+
+      auto genericData = generic.neighborLoader.entry(cell);
+      CellDRMapping drMapping[4]{};
+      generic.neighborKernel.computeNeighborsIntegral(
+          genericData, drMapping, genericNeighbors, genericNeighbors);
+
+      auto regularData = regular.neighborLoader.entry(cell);
+      regular.neighborKernel.computeRegularNeighborsIntegral(
+          regularData, regularNeighbors, regularNeighbors);
+
+      compareValues(genericData.dofs, regularData.dofs, tensor::Q::size());
+    }
+  }
+}
+
+} // namespace seissol::unit_test
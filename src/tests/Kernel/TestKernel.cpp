@@ -1,5 +1,13 @@
 #include "doctest.h"
 
+#include "Plasticity.t.h"
+#include "TimeBuffers.t.h"
+
+#if !defined(USE_STP) && !defined(ACL_DEVICE)
+#include "FusedLocal.t.h"
+#include "RegularKernels.t.h"
+#endif
+
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
 #endif // USE_POROELASTIC
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "generated_code/tensor.h"
+#include "Kernels/TimeBuffers.h"
+
+namespace seissol::unit_test {
+
+//! Random values with more digits than single precision has
+inline std::vector<real> randomValues(unsigned numberOfValues, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::vector<real> values(numberOfValues);
+  for (auto& value : values) {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+//! Requires that actual is expected rounded to a type with the given machine epsilon
+inline void requireRounded(double expected, double actual, double epsilon) {
+  REQUIRE(std::abs(expected - actual) <= 0.5 * epsilon * std::abs(expected));
+}
+
+TEST_CASE("Time buffers") {
+  using namespace seissol::kernels;
+  constexpr double epsilon = std::numeric_limits<BufferReal>::epsilon();
+  const auto timeIntegrated = randomValues(tensor::I::size(), 1);
+
+  SUBCASE("keep the following buffers aligned") {
+    if constexpr (ReducedPrecisionBuffers) {
+      REQUIRE(BufferSize * sizeof(real) % ALIGNMENT == 0);
+      REQUIRE(BufferSize * sizeof(real) >= tensor::I::size() * sizeof(BufferReal));
+      REQUIRE(BufferSize < tensor::I::size());
+    } else {
+      REQUIRE(BufferSize == tensor::I::size());
+    }
+  }
+
+  SUBCASE("round trip") {
+    // the entry after the buffer must not be written
+    const real sentinel = 42.0;
+    std::vector<real> buffer(BufferSize + 1, sentinel);
+    std::vector<real> loaded(tensor::I::size());
+
+    storeBuffer(timeIntegrated.data(), buffer.data());
+    loadBuffer(buffer.data(), loaded.data());
+
+    REQUIRE(buffer[BufferSize] == sentinel);
+    for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+      requireRounded(timeIntegrated[dof], loaded[dof], epsilon);
+      REQUIRE(loaded[dof] == static_cast<real>(static_cast<BufferReal>(timeIntegrated[dof])));
+    }
+  }
+
+  SUBCASE("accumulates in the precision of the buffers") {
+    const auto increment = randomValues(tensor::I::size(), 2);
+    std::vector<real> buffer(BufferSize);
+    std::vector<real> loaded(tensor::I::size());
+
+    storeBuffer(timeIntegrated.data(), buffer.data());
+    accumulateBuffer(increment.data(), buffer.data());
+    loadBuffer(buffer.data(), loaded.data());
+
+    for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+      const BufferReal sum = static_cast<BufferReal>(timeIntegrated[dof]) +
+                             static_cast<BufferReal>(increment[dof]);
+      REQUIRE(loaded[dof] == static_cast<real>(sum));
+      REQUIRE(std::abs(loaded[dof] - (timeIntegrated[dof] + increment[dof])) <=
+              1.5 * epsilon * (std::abs(timeIntegrated[dof]) + std::abs(increment[dof])));
+    }
+  }
+
+  SUBCASE("loads the buffers of the neighbors") {
+    std::vector<real> buffer(BufferSize);
+    storeBuffer(timeIntegrated.data(), buffer.data());
+    alignas(ALIGNMENT) real integrationBuffer[4][tensor::I::size()];
+    std::vector<real> other(tensor::I::size());
+
+    // face 0 reads a buffer, face 1 derivatives, face 2 and 3 nothing
+    const unsigned short ltsSetup = 0x2;
+    const FaceType faceTypes[4] = {
+        FaceType::regular, FaceType::regular, FaceType::dynamicRupture, FaceType::outflow};
+    real* timeDofs[4] = {buffer.data(), other.data(), other.data(), other.data()};
+    loadNeighborBuffers(ltsSetup, faceTypes, timeDofs, integrationBuffer);
+
+    if constexpr (ReducedPrecisionBuffers) {
+      REQUIRE(timeDofs[0] == integrationBuffer[0]);
+      for (unsigned dof = 0; dof < tensor::I::size(); ++dof) {
+        requireRounded(timeIntegrated[dof], timeDofs[0][dof], epsilon);
+      }
+    } else {
+      REQUIRE(timeDofs[0] == buffer.data());
+    }
+    for (unsigned face = 1; face < 4; ++face) {
+      REQUIRE(timeDofs[face] == other.data());
+    }
+  }
+}
+
+TEST_CASE("Time derivatives") {
+  using namespace seissol::kernels;
+  constexpr unsigned NumberOfValues = yateto::computeFamilySize<tensor::dQ>();
+  constexpr double epsilon = std::numeric_limits<DerivativeReal>::epsilon();
+  const auto derivatives = randomValues(NumberOfValues, 3);
+
+  SUBCASE("keep the following derivatives aligned") {
+    if constexpr (ReducedPrecisionDerivatives) {
+      REQUIRE(DerivativesSize * sizeof(real) % ALIGNMENT == 0);
+      REQUIRE(DerivativesSize * sizeof(real) >=
+              ReducedDerivativesOffset * sizeof(real) +
+                  (NumberOfValues - ReducedDerivativesOffset) * sizeof(DerivativeReal));
+      REQUIRE(DerivativesSize < NumberOfValues);
+    } else {
+      REQUIRE(DerivativesSize == NumberOfValues);
+    }
+  }
+
+  SUBCASE("keep dQ(0) in working precision") {
+    REQUIRE(FirstReducedDerivative > 0);
+    REQUIRE(ReducedDerivativesOffset >= tensor::dQ::size(0));
+
+    std::vector<real> stored(DerivativesSize);
+    storeDerivatives(derivatives.data(), stored.data());
+    for (unsigned i = 0; i < tensor::dQ::size(0); ++i) {
+      REQUIRE(stored[i] == derivatives[i]);
+    }
+  }
+
+  SUBCASE("round trip") {
+    // the entry after the derivatives must not be written
+    const real sentinel = 42.0;
+    std::vector<real> stored(DerivativesSize + 1, sentinel);
+    std::vector<real> loaded(NumberOfValues);
+
+    storeDerivatives(derivatives.data(), stored.data());
+    loadDerivatives(stored.data(), loaded.data());
+
+    REQUIRE(stored[DerivativesSize] == sentinel);
+    for (unsigned i = 0; i < ReducedDerivativesOffset; ++i) {
+      REQUIRE(loaded[i] == derivatives[i]);
+    }
+    for (unsigned i = ReducedDerivativesOffset; i < NumberOfValues; ++i) {
+      requireRounded(derivatives[i], loaded[i], epsilon);
+      REQUIRE(loaded[i] == static_cast<real>(static_cast<DerivativeReal>(derivatives[i])));
+    }
+  }
+
+  SUBCASE("loads the derivatives of the neighbors") {
+    std::vector<real> stored(DerivativesSize);
+    storeDerivatives(derivatives.data(), stored.data());
+    alignas(ALIGNMENT) real derivativesBuffer[4][NumberOfValues];
+    std::vector<real> other(NumberOfValues);
+
+    // face 0 reads derivatives, face 1 a buffer, face 2 and 3 nothing
+    const unsigned short ltsSetup = 0xd;
+    const FaceType faceTypes[4] = {
+        FaceType::regular, FaceType::regular, FaceType::dynamicRupture, FaceType::outflow};
+    real* timeDofs[4] = {stored.data(), other.data(), other.data(), other.data()};
+    loadNeighborDerivatives(ltsSetup, faceTypes, timeDofs, derivativesBuffer);
+
+    if constexpr (ReducedPrecisionDerivatives) {
+      REQUIRE(timeDofs[0] == derivativesBuffer[0]);
+      for (unsigned i = 0; i < NumberOfValues; ++i) {
+        requireRounded(derivatives[i], timeDofs[0][i], epsilon);
+      }
+    } else {
+      REQUIRE(timeDofs[0] == stored.data());
+    }
+    for (unsigned face = 1; face < 4; ++face) {
+      REQUIRE(timeDofs[face] == other.data());
+    }
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,175 @@
+#ifdef USE_RECOMPUTED_FLUX_SOLVERS
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <Equations/Setup.h>
+#include <Initializer/typedefs.hpp>
+#include <Kernels/FluxSolvers.h>
+#include <Model/common.hpp>
+#include <generated_code/init.h>
+#include <generated_code/kernel.h>
+
+#include "values.h"
+
+namespace seissol::unit_test {
+
+using FluxSolverMaterial = decltype(CellMaterialData::local);
+
+/**
+ * Returns a material whose density and elastic moduli are randomly scaled from the test values.
+ * The poroelastic moduli are scaled less, such that the solid stays stiffer than the matrix.
+ **/
+FluxSolverMaterial randomFluxSolverMaterial(std::mt19937& generator) {
+#ifdef USE_POROELASTIC
+  constexpr unsigned FirstScaled = 1;
+  constexpr unsigned LastScaled = 3;
+  std::uniform_real_distribution<double> scaleDistribution(0.8, 1.25);
+#else
+  constexpr unsigned FirstScaled = 0;
+  constexpr unsigned LastScaled = 2;
+  std::uniform_real_distribution<double> scaleDistribution(0.5, 2.0);
+#endif
+  std::bernoulli_distribution baseDistribution;
+  const double* base = baseDistribution(generator) ? materialVal_1 : materialVal_2;
+  std::vector<double> values(base, base + std::size(materialVal_1));
+  for (unsigned i = FirstScaled; i <= LastScaled; ++i) {
+    values[i] *= scaleDistribution(generator);
+  }
+  return FluxSolverMaterial(values.data(), values.size());
+}
+
+//! Fills a random unit normal and two tangents, such that they form an orthonormal basis
+void randomFaceBasis(std::mt19937& generator, double normal[3], double tangent1[3], double tangent2[3]) {
+  std::normal_distribution<double> distribution;
+  std::array<double, 3> n{};
+  double norm = 0.0;
+  while (norm < 1e-3) {
+    for (auto& value : n) {
+      value = distribution(generator);
+    }
+    norm = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+  }
+  for (unsigned i = 0; i < 3; ++i) {
+    normal[i] = n[i] / norm;
+  }
+  // the first tangent is orthogonal to the normal and the coordinate axis least aligned with it
+  unsigned axis = 0;
+  for (unsigned i = 1; i < 3; ++i) {
+    if (std::abs(normal[i]) < std::abs(normal[axis])) {
+      axis = i;
+    }
+  }
+  double t[3] = {0.0, 0.0, 0.0};
+  t[axis] = 1.0;
+  tangent1[0] = normal[1] * t[2] - normal[2] * t[1];
+  tangent1[1] = normal[2] * t[0] - normal[0] * t[2];
+  tangent1[2] = normal[0] * t[1] - normal[1] * t[0];
+  const double tangentNorm =
+      std::sqrt(tangent1[0] * tangent1[0] + tangent1[1] * tangent1[1] + tangent1[2] * tangent1[2]);
+  for (unsigned i = 0; i < 3; ++i) {
+    tangent1[i] /= tangentNorm;
+  }
+  tangent2[0] = normal[1] * tangent1[2] - normal[2] * tangent1[1];
+  tangent2[1] = normal[2] * tangent1[0] - normal[0] * tangent1[2];
+  tangent2[2] = normal[0] * tangent1[1] - normal[1] * tangent1[0];
+}
+
+//! Compares entry by entry, relative to the largest entry; NaN entries have to match
+void compareFluxSolvers(const real* expected, const real* actual, unsigned size) {
+  constexpr real Epsilon = 1e2 * std::numeric_limits<real>::epsilon();
+  real maxAbs = 0.0;
+  for (unsigned i = 0; i < size; ++i) {
+    if (!std::isnan(expected[i])) {
+      maxAbs = std::max(maxAbs, std::abs(expected[i]));
+    }
+  }
+  for (unsigned i = 0; i < size; ++i) {
+    CAPTURE(i);
+    REQUIRE(std::isnan(expected[i]) == std::isnan(actual[i]));
+    if (!std::isnan(expected[i])) {
+      REQUIRE(std::abs(expected[i] - actual[i]) <= Epsilon * maxAbs);
+    }
+  }
+}
+
+TEST_CASE("Recomputed flux solvers equal the stored flux solvers") {
+  constexpr unsigned NumberOfSamples = 20;
+  constexpr FaceType FaceTypes[] = {FaceType::regular,
+                                    FaceType::freeSurface,
+                                    FaceType::freeSurfaceGravity,
+                                    FaceType::dynamicRupture,
+                                    FaceType::dirichlet,
+                                    FaceType::outflow,
+                                    FaceType::analytical,
+                                    FaceType::periodic};
+  std::mt19937 generator(20240704);
+  std::uniform_real_distribution<double> fluxScaleDistribution(-10.0, -0.1);
+
+  for (unsigned sample = 0; sample < NumberOfSamples; ++sample) {
+    const auto local = randomFluxSolverMaterial(generator);
+    const auto neighbor = randomFluxSolverMaterial(generator);
+    for (const auto faceType : FaceTypes) {
+      CAPTURE(sample);
+      CAPTURE(static_cast<int>(faceType));
+
+      FaceGodunovStates states;
+      auto QgodLocal = init::QgodLocal::view::create(states.QgodLocal);
+      auto QgodNeighbor = init::QgodNeighbor::view::create(states.QgodNeighbor);
+      auto ATtilde = init::star::view<0>::create(states.starMatrix);
+      QgodLocal.setZero();
+      QgodNeighbor.setZero();
+      ATtilde.setZero();
+      model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+      model::getTransposedCoefficientMatrix(local, 0, ATtilde);
+
+      FaceFluxSolverData face;
+      face.godunovStates = &states;
+      randomFaceBasis(generator, face.normal, face.tangent1, face.tangent2);
+      face.fluxScale = fluxScaleDistribution(generator);
+
+      // the flux solvers as stored by initializeCellLocalMatrices
+      alignas(ALIGNMENT) real TData[tensor::T::size()];
+      alignas(ALIGNMENT) real TinvData[tensor::Tinv::size()];
+      auto T = init::T::view::create(TData);
+      auto Tinv = init::Tinv::view::create(TinvData);
+      model::getFaceRotationMatrix(face.normal, face.tangent1, face.tangent2, T, Tinv);
+
+      alignas(ALIGNMENT) real storedLocal[tensor::AplusT::size()];
+      kernel::computeFluxSolverLocal localKrnl;
+      localKrnl.fluxScale = face.fluxScale;
+      localKrnl.AplusT = storedLocal;
+      localKrnl.QgodLocal = states.QgodLocal;
+      localKrnl.T = TData;
+      localKrnl.Tinv = TinvData;
+      localKrnl.star(0) = states.starMatrix;
+      localKrnl.execute();
+
+      alignas(ALIGNMENT) real storedNeighbor[tensor::AminusT::size()];
+      kernel::computeFluxSolverNeighbor neighKrnl;
+      neighKrnl.fluxScale = face.fluxScale;
+      neighKrnl.AminusT = storedNeighbor;
+      neighKrnl.QgodNeighbor = states.QgodNeighbor;
+      neighKrnl.T = TData;
+      neighKrnl.Tinv = TinvData;
+      neighKrnl.star(0) = states.starMatrix;
+      if (faceType == FaceType::dirichlet || faceType == FaceType::freeSurfaceGravity) {
+        neighKrnl.Tinv = init::identityT::Values;
+      }
+      neighKrnl.execute();
+
+      alignas(ALIGNMENT) real rebuiltLocal[tensor::AplusT::size()];
+      alignas(ALIGNMENT) real rebuiltNeighbor[tensor::AminusT::size()];
+      kernels::rebuildLocalFluxSolver(face, rebuiltLocal);
+      kernels::rebuildNeighborFluxSolver(face, faceType, rebuiltNeighbor);
+
+      compareFluxSolvers(storedLocal, rebuiltLocal, tensor::AplusT::size());
+      compareFluxSolvers(storedNeighbor, rebuiltNeighbor, tensor::AminusT::size());
+    }
+  }
+}
+
+} // namespace seissol::unit_test
+#endif
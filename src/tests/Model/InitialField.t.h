@@ -0,0 +1,334 @@
+#include "tests/TestHelper.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include <Equations/datastructures.hpp>
+#include <Physics/InitialField.h>
+
+#include "values.h"
+
+namespace seissol::unit_test {
+
+/**
+ * Evaluates a planar wave in closed form, Re(R A exp(i (omega t - k (x - o) + phase))), from its eigenpairs.
+ * If restrictToWavefront, only the part within one wave length behind the wave front through o is evaluated.
+ */
+template <typename WaveT>
+class ClosedFormWave : public WaveT {
+  public:
+  using WaveT::WaveT;
+
+  //! The value of the quantity; magnitude receives the sum of the magnitudes of the wave modes
+  double value(double time,
+               const std::array<double, 3>& point,
+               unsigned quantity,
+               const std::array<double, 3>& origin,
+               bool restrictToWavefront,
+               double* magnitude = nullptr) const {
+    auto R = yateto::DenseTensorView<2, std::complex<double>>(
+        const_cast<std::complex<double>*>(this->m_eigenvectors.data()),
+        {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
+    double result = 0.0;
+    if (magnitude != nullptr) {
+      *magnitude = 0.0;
+    }
+    for (unsigned v = 0; v < this->m_varField.size(); ++v) {
+      const auto argument = std::complex<double>(0.0, 1.0) *
+                            (this->m_lambdaA[this->m_varField[v]] * time -
+                             this->m_kVec[0] * (point[0] - origin[0]) -
+                             this->m_kVec[1] * (point[1] - origin[1]) -
+                             this->m_kVec[2] * (point[2] - origin[2]) + this->m_phase);
+      const auto mode = R(quantity, this->m_varField[v]) * this->m_ampField[v] * std::exp(argument);
+      if (!restrictToWavefront || (argument.imag() > -0.5 * M_PI && argument.imag() < 1.5 * M_PI)) {
+        result += mode.real();
+      }
+      if (magnitude != nullptr) {
+        *magnitude += std::abs(mode);
+      }
+    }
+    return result;
+  }
+
+  //! Real part of the eigenvalue of the v-th wave mode
+  double frequency(unsigned v) const { return this->m_lambdaA[this->m_varField[v]].real(); }
+
+  //! Distance of the phase of the point to the cutoff at the ends of the wave
+  double distanceToCutoff(double time,
+                          const std::array<double, 3>& point,
+                          const std::array<double, 3>& origin) const {
+    double distance = std::numeric_limits<double>::max();
+    for (unsigned v = 0; v < this->m_varField.size(); ++v) {
+      const double phase = this->m_lambdaA[this->m_varField[v]].real() * time -
+                           this->m_kVec[0] * (point[0] - origin[0]) -
+                           this->m_kVec[1] * (point[1] - origin[1]) -
+                           this->m_kVec[2] * (point[2] - origin[2]) + this->m_phase;
+      distance = std::min(
+          {distance, std::abs(phase + 0.5 * M_PI), std::abs(phase - 1.5 * M_PI)});
+    }
+    return distance;
+  }
+};
+
+/**
+ * The closed-form Ocean scenario of Abrahams et al. (2019), see physics::Ocean.
+ */
+inline double oceanValue(
+    int mode, double rho, double time, const std::array<double, 3>& point, unsigned quantity) {
+  constexpr double g = 9.81e-3;
+  const double k_x = M_PI / 10.0;
+  const double k_y = M_PI / 10.0;
+  constexpr double k_stars[] = {0.4433813748841239, 1.5733628061766445, 4.713305873881573};
+  constexpr double omegas[] = {0.0425599572628432, 2.4523337594491745, 7.1012991617572165};
+  const double k_star = k_stars[mode];
+  const double omega = omegas[mode];
+  const double B = g * k_star / (omega * omega);
+  const double x = point[0];
+  const double y = point[1];
+  const double z = point[2];
+
+  double depthPressure;
+  double depthVelocity;
+  if (mode == 0) {
+    depthPressure = std::sinh(k_star * z) + B * std::cosh(k_star * z);
+    depthVelocity = std::cosh(k_star * z) + B * std::sinh(k_star * z);
+  } else {
+    depthPressure = std::sin(k_star * z) + B * std::cos(k_star * z);
+    depthVelocity = std::cos(k_star * z) - B * std::sin(k_star * z);
+  }
+
+  switch (quantity) {
+  case 0:
+  case 1:
+  case 2:
+    return -std::sin(k_x * x) * std::sin(k_y * y) * std::sin(omega * time) * depthPressure;
+  case 6:
+    return (k_x / (omega * rho)) * std::cos(k_x * x) * std::sin(k_y * y) * std::cos(omega * time) *
+           depthPressure;
+  case 7:
+    return (k_y / (omega * rho)) * std::sin(k_x * x) * std::cos(k_y * y) * std::cos(omega * time) *
+           depthPressure;
+  case 8:
+    return (k_star / (omega * rho)) * std::sin(k_x * x) * std::sin(k_y * y) *
+           std::cos(omega * time) * depthVelocity;
+  default:
+    return 0.0;
+  }
+}
+
+/**
+ * Output of evaluateBatch for several times at the same points.
+ */
+template <unsigned NumberOfPoints, unsigned NumberOfTimes>
+class BatchedValues {
+  public:
+  BatchedValues() : data(NumberOfTimes * NumberOfPoints * NUMBER_OF_QUANTITIES) {
+    for (unsigned t = 0; t < NumberOfTimes; ++t) {
+      views.emplace_back(data.data() + t * NumberOfPoints * NUMBER_OF_QUANTITIES,
+                         std::initializer_list<unsigned>{NumberOfPoints, NUMBER_OF_QUANTITIES});
+    }
+  }
+
+  yateto::DenseTensorView<2, real, unsigned>* operator()() { return views.data(); }
+  yateto::DenseTensorView<2, real, unsigned>& operator[](unsigned t) { return views[t]; }
+
+  private:
+  std::vector<real> data;
+  std::vector<yateto::DenseTensorView<2, real, unsigned>> views;
+};
+
+//! Requires that the value agrees with the expected one up to rounding, relative to the magnitude of its terms
+inline void requireClose(double expected, double actual, double scale) {
+  constexpr double epsilon = 1e4 * std::numeric_limits<real>::epsilon();
+  REQUIRE(actual == AbsApprox(expected).epsilon(epsilon * std::max(1.0, scale)));
+}
+
+inline CellMaterialData initialFieldMaterial() {
+  CellMaterialData materialData;
+#ifdef USE_ANISOTROPIC
+  materialData.local = model::AnisotropicMaterial(materialVal_1, 22);
+#elif defined USE_POROELASTIC
+  materialData.local = model::PoroElasticMaterial(materialVal_1, 10);
+#elif defined USE_VISCOELASTIC || defined USE_VISCOELASTIC2
+  materialData.local =
+      model::ViscoElasticMaterial(materialVal_1, 3 + NUMBER_OF_RELAXATION_MECHANISMS * 4);
+#else
+  materialData.local = model::ElasticMaterial(materialVal_1, 3);
+#endif
+  return materialData;
+}
+
+TEST_CASE("Planar waves") {
+  constexpr unsigned numberOfPoints = 100;
+  constexpr unsigned numberOfTimes = 3;
+  const auto materialData = initialFieldMaterial();
+  const std::array<double, 3> noOrigin = {0.0, 0.0, 0.0};
+  const ClosedFormWave<physics::Planarwave> planarwave(materialData, 0.3);
+  // the phase of the times is of order one, such that it is not dominated by rounding
+  const double omega = std::abs(planarwave.frequency(0));
+  const double times[numberOfTimes] = {0.0, 0.25 / omega, 1.5 / omega};
+
+  // The points span more than one chunk of the batched evaluation
+  std::array<std::array<double, 3>, numberOfPoints> points;
+  for (unsigned i = 0; i < numberOfPoints; ++i) {
+    points[i] = {0.01 * i, 0.5 - 0.02 * i, 0.003 * i * i};
+  }
+  BatchedValues<numberOfPoints, numberOfTimes> batched;
+
+  SUBCASE("The planar wave equals its closed form") {
+    planarwave.evaluateBatch(times, numberOfTimes, points, materialData, batched());
+
+    for (unsigned t = 0; t < numberOfTimes; ++t) {
+      for (unsigned i = 0; i < numberOfPoints; ++i) {
+        for (unsigned j = 0; j < NUMBER_OF_QUANTITIES; ++j) {
+          double magnitude;
+          const double expected =
+              planarwave.value(times[t], points[i], j, noOrigin, false, &magnitude);
+          requireClose(expected, batched[t](i, j), magnitude);
+        }
+      }
+    }
+  }
+
+  SUBCASE("The superimposed planar wave equals the sum of the closed forms") {
+    const physics::SuperimposedPlanarwave superimposedPlanarwave(materialData, 0.3);
+    const std::array<ClosedFormWave<physics::Planarwave>, 3> planarwaves = {
+        ClosedFormWave<physics::Planarwave>(materialData, 0.3, {M_PI, 0.0, 0.0}),
+        ClosedFormWave<physics::Planarwave>(materialData, 0.3, {0.0, M_PI, 0.0}),
+        ClosedFormWave<physics::Planarwave>(materialData, 0.3, {0.0, 0.0, M_PI})};
+    superimposedPlanarwave.evaluateBatch(times, numberOfTimes, points, materialData, batched());
+
+    for (unsigned t = 0; t < numberOfTimes; ++t) {
+      for (unsigned i = 0; i < numberOfPoints; ++i) {
+        for (unsigned j = 0; j < NUMBER_OF_QUANTITIES; ++j) {
+          double expected = 0.0;
+          double scale = 0.0;
+          for (const auto& wave : planarwaves) {
+            double magnitude;
+            expected += wave.value(times[t], points[i], j, noOrigin, false, &magnitude);
+            scale += magnitude;
+          }
+          requireClose(expected, batched[t](i, j), scale);
+        }
+      }
+    }
+  }
+
+  SUBCASE("The batched evaluation equals the evaluation at single times") {
+    planarwave.evaluateBatch(times, numberOfTimes, points, materialData, batched());
+    BatchedValues<numberOfPoints, 1> single;
+    for (unsigned t = 0; t < numberOfTimes; ++t) {
+      planarwave.evaluate(times[t], points, materialData, single[0]);
+      for (unsigned i = 0; i < numberOfPoints; ++i) {
+        for (unsigned j = 0; j < NUMBER_OF_QUANTITIES; ++j) {
+          REQUIRE(batched[t](i, j) == single[0](i, j));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Travelling wave") {
+  constexpr unsigned numberOfPoints = 150;
+  constexpr unsigned numberOfTimes = 3;
+  const auto materialData = initialFieldMaterial();
+
+  TravellingWaveParameters parameters;
+  parameters.origin = {0.5, -0.25, 1.0};
+  parameters.kVec = {2.0, 1.0, -0.5};
+#ifdef USE_POROELASTIC
+  parameters.varField = {3, 12};
+#else
+  parameters.varField = {1, 8};
+#endif
+  parameters.ampField = {std::complex<double>(1.0, 0.5), 2.0};
+  const ClosedFormWave<physics::TravellingWave> travellingWave(materialData, parameters);
+
+  // the points cross the wave along kVec, from far ahead of the wave front to far behind the wave
+  const double kNorm2 = parameters.kVec[0] * parameters.kVec[0] +
+                        parameters.kVec[1] * parameters.kVec[1] +
+                        parameters.kVec[2] * parameters.kVec[2];
+  std::array<std::array<double, 3>, numberOfPoints> points;
+  for (unsigned i = 0; i < numberOfPoints; ++i) {
+    const double phase = -12.0 + 0.163 * i;
+    for (unsigned d = 0; d < 3; ++d) {
+      points[i][d] = parameters.origin[d] + phase * parameters.kVec[d] / kNorm2;
+    }
+    points[i][0] += 0.01 * (i % 7);
+  }
+
+  // the wave moves by a phase of 1 and 3 relative to the points
+  const double omega = std::abs(travellingWave.frequency(0));
+  const double times[numberOfTimes] = {0.0, 1.0 / omega, 3.0 / omega};
+  BatchedValues<numberOfPoints, numberOfTimes> batched;
+
+  SUBCASE("The travelling wave equals its closed form and vanishes outside of the wave") {
+    travellingWave.evaluateBatch(times, numberOfTimes, points, materialData, batched());
+
+    unsigned numberOfPointsInWave = 0;
+    unsigned numberOfPointsOutsideWave = 0;
+    for (unsigned t = 0; t < numberOfTimes; ++t) {
+      for (unsigned i = 0; i < numberOfPoints; ++i) {
+        // the split of the phase into a temporal and a spatial part may round differently at the cutoff
+        if (travellingWave.distanceToCutoff(times[t], points[i], parameters.origin) < 1e-6) {
+          continue;
+        }
+        bool isInWave = false;
+        for (unsigned j = 0; j < NUMBER_OF_QUANTITIES; ++j) {
+          double magnitude;
+          const double expected =
+              travellingWave.value(times[t], points[i], j, parameters.origin, true, &magnitude);
+          requireClose(expected, batched[t](i, j), magnitude);
+          isInWave = isInWave || expected != 0.0;
+        }
+        if (isInWave) {
+          ++numberOfPointsInWave;
+        } else {
+          ++numberOfPointsOutsideWave;
+          for (unsigned j = 0; j < NUMBER_OF_QUANTITIES; ++j) {
+            REQUIRE(batched[t](i, j) == 0.0);
+          }
+        }
+      }
+    }
+    REQUIRE(numberOfPointsInWave > 0);
+    REQUIRE(numberOfPointsOutsideWave > 0);
+  }
+}
+
+#ifndef USE_ANISOTROPIC
+TEST_CASE("Ocean") {
+  constexpr unsigned numberOfPoints = 80;
+  constexpr unsigned numberOfTimes = 4;
+  const double times[numberOfTimes] = {0.0, 0.3, 2.0, 17.5};
+  auto materialData = initialFieldMaterial();
+  materialData.local.mu = 0.0;
+  const double rho = materialData.local.rho;
+
+  std::array<std::array<double, 3>, numberOfPoints> points;
+  for (unsigned i = 0; i < numberOfPoints; ++i) {
+    points[i] = {0.3 * i, 7.0 - 0.11 * i, -2.0 + 0.05 * i};
+  }
+  BatchedValues<numberOfPoints, numberOfTimes> batched;
+
+  for (int mode = 0; mode < 3; ++mode) {
+    CAPTURE(mode);
+    const physics::Ocean ocean(mode, 9.81e-3);
+    ocean.evaluateBatch(times, numberOfTimes, points, materialData, batched());
+
+    for (unsigned t = 0; t < numberOfTimes; ++t) {
+      for (unsigned i = 0; i < numberOfPoints; ++i) {
+        for (unsigned j = 0; j < 9; ++j) {
+          const double expected = oceanValue(mode, rho, times[t], points[i], j);
+          requireClose(expected, batched[t](i, j), std::abs(expected));
+        }
+      }
+    }
+  }
+}
+#endif
+
+} // namespace seissol::unit_test
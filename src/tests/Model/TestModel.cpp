@@ -1,4 +1,6 @@
 #include "doctest.h"
 
 #include "Attenuation.t.h"
+#include "FluxSolvers.t.h"
 #include "GodunovState.t.h"
+#include "InitialField.t.h"
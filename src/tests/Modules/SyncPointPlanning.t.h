@@ -0,0 +1,56 @@
+#include <limits>
+#include <vector>
+
+#include "Modules/SyncPointPlanning.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Synchronization points of modules") {
+  using modules::planSyncPoint;
+  using modules::SyncWindow;
+  constexpr double epsilon = 1e-12;
+
+  SUBCASE("Without modules there is no synchronization point") {
+    REQUIRE(planSyncPoint({}) == std::numeric_limits<double>::max());
+    REQUIRE(planSyncPoint({}, 3.0) == 3.0);
+  }
+
+  SUBCASE("Windows without overlap keep the earliest regular synchronization point") {
+    REQUIRE(planSyncPoint({{1.0, 0.1}, {2.0, 0.2}}) == AbsApprox(1.0).epsilon(epsilon));
+    REQUIRE(planSyncPoint({{2.0, 0.2}, {1.0, 0.1}}) == AbsApprox(1.0).epsilon(epsilon));
+    REQUIRE(planSyncPoint({{1.0, 0.0}, {1.5, 0.0}}) == AbsApprox(1.0).epsilon(epsilon));
+  }
+
+  SUBCASE("Overlapping windows share a synchronization point") {
+    // The earliest regular synchronization point is within both windows
+    REQUIRE(planSyncPoint({{1.0, 0.1}, {1.05, 0.1}}) == AbsApprox(1.0).epsilon(epsilon));
+    // The earliest regular synchronization point is outside of the second window
+    REQUIRE(planSyncPoint({{1.0, 0.1}, {1.15, 0.1}}) == AbsApprox(1.05).epsilon(epsilon));
+    // The third window does not contain the end of the first window
+    REQUIRE(planSyncPoint({{1.0, 0.1}, {1.15, 0.1}, {1.3, 0.1}}) == AbsApprox(1.05).epsilon(epsilon));
+  }
+
+  SUBCASE("Checkpoints keep their exact time") {
+    REQUIRE(planSyncPoint({{1.0, 0.1}}, 1.05) == AbsApprox(1.05).epsilon(epsilon));
+    REQUIRE(planSyncPoint({{1.0, 0.1}, {1.1, 0.1}}, 1.05) == AbsApprox(1.05).epsilon(epsilon));
+    // Checkpoints before all windows
+    REQUIRE(planSyncPoint({{1.0, 0.1}}, 0.5) == AbsApprox(0.5).epsilon(epsilon));
+    // Checkpoints after the earliest window end do not move the synchronization point
+    REQUIRE(planSyncPoint({{1.0, 0.1}}, 1.5) == AbsApprox(1.0).epsilon(epsilon));
+    REQUIRE(planSyncPoint({{1.0, 0.1}, {1.15, 0.1}}, 1.5) == AbsApprox(1.05).epsilon(epsilon));
+  }
+}
+
+TEST_CASE("Saved synchronizations of modules") {
+  using modules::countSavedSyncPoints;
+  constexpr double timeTolerance = 1e-9;
+
+  REQUIRE(countSavedSyncPoints({}, timeTolerance) == 0);
+  REQUIRE(countSavedSyncPoints({1.0}, timeTolerance) == 0);
+  // Regular synchronization points within the tolerance do not need an additional synchronization
+  REQUIRE(countSavedSyncPoints({1.0, 1.0 + 1e-12}, timeTolerance) == 0);
+  REQUIRE(countSavedSyncPoints({1.05, 1.0, 1.0 + 1e-12}, timeTolerance) == 1);
+  REQUIRE(countSavedSyncPoints({1.2, 1.0, 1.1}, timeTolerance) == 2);
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,128 @@
+#ifdef USE_MPI
+#include <array>
+#include <cstdlib>
+
+#include "Initializer/BasicTypedefs.hpp"
+#include "Parallel/MPI.h"
+#include "Parallel/PersistentRequests.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Persistent requests fall back for staged transfer modes") {
+  auto& mpi = MPI::mpi;
+  const auto preferredMode = mpi.getPreferredDataTransferMode();
+
+  SUBCASE("Direct transfer mode") {
+    mpi.setPreferredDataTransferMode(MPI::DataTransferMode::Direct);
+    mpi.setPersistentRequests(true);
+    REQUIRE(mpi.usePersistentRequests());
+    mpi.setPersistentRequests(false);
+    REQUIRE(!mpi.usePersistentRequests());
+  }
+
+  SUBCASE("Copy-in/copy-out transfer modes") {
+    for (const auto mode : {MPI::DataTransferMode::CopyInCopyOutHost,
+                            MPI::DataTransferMode::CopyInCopyOutDevice}) {
+      mpi.setPreferredDataTransferMode(mode);
+      mpi.setPersistentRequests(true);
+      REQUIRE(!mpi.usePersistentRequests());
+    }
+  }
+
+  SUBCASE("Environment variable") {
+    setenv("SEISSOL_MPI_PERSISTENT_REQUESTS", "1", 1);
+    mpi.setPreferredDataTransferMode(MPI::DataTransferMode::CopyInCopyOutHost);
+    mpi.setPersistentRequestsFromEnv();
+    REQUIRE(!mpi.usePersistentRequests());
+    mpi.setPreferredDataTransferMode(MPI::DataTransferMode::Direct);
+    mpi.setPersistentRequestsFromEnv();
+    REQUIRE(mpi.usePersistentRequests());
+    unsetenv("SEISSOL_MPI_PERSISTENT_REQUESTS");
+    mpi.setPersistentRequestsFromEnv();
+    REQUIRE(!mpi.usePersistentRequests());
+  }
+
+  mpi.setPersistentRequests(false);
+  mpi.setPreferredDataTransferMode(preferredMode);
+}
+
+TEST_CASE("Persistent requests of the copy and ghost regions") {
+  // all regions are exchanged with the own rank: region 0 with itself, regions 1 and 2 with each other
+  const int rank = MPI::mpi.rank();
+  constexpr unsigned NumberOfRegions = 3;
+  const std::array<unsigned, NumberOfRegions> sizes = {4, 7, 7};
+
+  std::array<std::array<real, 7>, NumberOfRegions> copyRegions{};
+  std::array<std::array<real, 7>, NumberOfRegions> ghostRegions{};
+  int neighbors[NumberOfRegions][2] = {{rank, 0}, {rank, 1}, {rank, 1}};
+  real* copy[NumberOfRegions];
+  real* ghost[NumberOfRegions];
+  unsigned copySizes[NumberOfRegions];
+  unsigned ghostSizes[NumberOfRegions];
+  int sendIdentifiers[NumberOfRegions] = {10, 11, 12};
+  int receiveIdentifiers[NumberOfRegions] = {10, 12, 11};
+  MPI_Request sendRequests[NumberOfRegions];
+  MPI_Request receiveRequests[NumberOfRegions];
+  for (unsigned region = 0; region < NumberOfRegions; ++region) {
+    copy[region] = copyRegions[region].data();
+    ghost[region] = ghostRegions[region].data();
+    copySizes[region] = sizes[region];
+    ghostSizes[region] = sizes[region];
+  }
+
+  MeshStructure meshStructure{};
+  meshStructure.numberOfRegions = NumberOfRegions;
+  meshStructure.neighboringClusters = neighbors;
+  meshStructure.copyRegions = copy;
+  meshStructure.copyRegionSizes = copySizes;
+  meshStructure.ghostRegions = ghost;
+  meshStructure.ghostRegionSizes = ghostSizes;
+  meshStructure.sendIdentifiers = sendIdentifiers;
+  meshStructure.receiveIdentifiers = receiveIdentifiers;
+  meshStructure.sendRequests = sendRequests;
+  meshStructure.receiveRequests = receiveRequests;
+
+  parallel::initPersistentRequests(meshStructure, timeData, MPI::mpi.comm());
+  for (unsigned region = 0; region < NumberOfRegions; ++region) {
+    REQUIRE(sendRequests[region] != MPI_REQUEST_NULL);
+    REQUIRE(receiveRequests[region] != MPI_REQUEST_NULL);
+  }
+
+  // the requests are reused, and every start sends the current content of the copy regions
+  for (unsigned step = 0; step < 3; ++step) {
+    for (unsigned region = 0; region < NumberOfRegions; ++region) {
+      for (unsigned i = 0; i < sizes[region]; ++i) {
+        copyRegions[region][i] = 100.0 * step + 10.0 * region + i;
+      }
+      MPI_Start(receiveRequests + region);
+    }
+    for (unsigned region = 0; region < NumberOfRegions; ++region) {
+      MPI_Start(sendRequests + region);
+    }
+    MPI_Waitall(NumberOfRegions, sendRequests, MPI_STATUSES_IGNORE);
+    MPI_Waitall(NumberOfRegions, receiveRequests, MPI_STATUSES_IGNORE);
+
+    // completed persistent requests stay allocated
+    for (unsigned region = 0; region < NumberOfRegions; ++region) {
+      REQUIRE(sendRequests[region] != MPI_REQUEST_NULL);
+      REQUIRE(receiveRequests[region] != MPI_REQUEST_NULL);
+    }
+    const std::array<unsigned, NumberOfRegions> sender = {0, 2, 1};
+    for (unsigned region = 0; region < NumberOfRegions; ++region) {
+      for (unsigned i = 0; i < sizes[region]; ++i) {
+        REQUIRE(ghostRegions[region][i] == 100.0 * step + 10.0 * sender[region] + i);
+      }
+    }
+  }
+
+  parallel::freePersistentRequests(meshStructure);
+  for (unsigned region = 0; region < NumberOfRegions; ++region) {
+    REQUIRE(sendRequests[region] == MPI_REQUEST_NULL);
+    REQUIRE(receiveRequests[region] == MPI_REQUEST_NULL);
+  }
+  // freeing twice, e.g. on an early teardown, is harmless
+  parallel::freePersistentRequests(meshStructure);
+}
+
+} // namespace seissol::unit_test
+#endif
@@ -2,4 +2,5 @@
 #include "tests/TestHelper.h"
 
 #include "ReceiverWriter.t.h"
+#include "WaveFieldSnapshot.t.h"
 
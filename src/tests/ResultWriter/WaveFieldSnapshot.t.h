@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Kernels/Time.h"
+#include "ResultWriter/WaveFieldSnapshot.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Wave field snapshot evaluates the Taylor expansion of the step") {
+  constexpr std::size_t numberOfCells = 3;
+  constexpr auto derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+  const std::vector<real> dofs(numberOfCells * tensor::Q::size());
+  writer::WaveFieldSnapshot snapshot(dofs.data(), numberOfCells);
+  REQUIRE(snapshot.cellIndex(dofs.data() + 2 * tensor::Q::size()) == 2);
+
+  constexpr double timeTolerance = 1e-8;
+  constexpr double stepStart = 2.0;
+  constexpr double stepSize = 0.5;
+  snapshot.activate(timeTolerance);
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<real> distribution(-1, 1);
+  alignas(ALIGNMENT) real derivatives[numberOfCells][derivativesSize];
+  for (auto& cellDerivatives : derivatives) {
+    for (auto& value : cellDerivatives) {
+      value = distribution(generator);
+    }
+  }
+
+  kernels::Time timeKernel;
+  const double epsilon = 1e2 * std::numeric_limits<real>::epsilon();
+
+  SUBCASE("Output time inside the step") {
+    constexpr double outputTime = 2.3;
+    snapshot.schedule(outputTime);
+    REQUIRE(snapshot.isInStep(stepStart, stepSize));
+    for (std::size_t cell = 0; cell < numberOfCells; ++cell) {
+      snapshot.evaluate(timeKernel, stepStart, derivatives[cell], cell);
+    }
+
+    alignas(ALIGNMENT) real expected[tensor::Q::size()];
+    for (std::size_t cell = 0; cell < numberOfCells; ++cell) {
+      timeKernel.computeTaylorExpansion(outputTime - stepStart, 0.0, derivatives[cell], expected);
+      for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+        REQUIRE(snapshot.cellDofs(cell)[i] == AbsApprox(expected[i]).epsilon(epsilon));
+      }
+    }
+  }
+
+  SUBCASE("Output time within the tolerance before the step") {
+    snapshot.schedule(stepStart - 0.5 * timeTolerance);
+    REQUIRE(snapshot.isInStep(stepStart, stepSize));
+    REQUIRE(!snapshot.isInStep(stepStart - stepSize, stepSize));
+    snapshot.evaluate(timeKernel, stepStart, derivatives[1], 1);
+
+    // the expansion at the start of the step are the degrees of freedom, i.e. dQ(0)
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      REQUIRE(snapshot.cellDofs(1)[i] == AbsApprox(derivatives[1][i]).epsilon(epsilon));
+    }
+  }
+}
+
+TEST_CASE("Wave field snapshot is completed once all clusters passed the output time") {
+  // Clusters with rate 2 and binary time steps, such that all times are exact
+  const std::array<double, 3> timeStepSizes = {0.125, 0.25, 0.5};
+  const std::array<std::size_t, 3> numberOfCells = {10, 20, 30};
+  constexpr double timeTolerance = 1e-8;
+  const std::vector<real> dofs(60 * tensor::Q::size());
+  writer::WaveFieldSnapshot snapshot(dofs.data(), 60);
+
+  SUBCASE("Inactive snapshots are not evaluated") {
+    snapshot.schedule(0.3);
+    REQUIRE(!snapshot.isInStep(0.25, 0.25));
+  }
+
+  SUBCASE("Every cluster evaluates every output time once") {
+    snapshot.activate(timeTolerance);
+    // inside all steps, at step boundaries of all clusters, and of the smallest cluster only
+    const std::vector<double> outputTimes = {0.375, 1.5, 2.5625, 4.0};
+
+    std::array<double, 3> correctionTimes = {0.0, 0.0, 0.0};
+    std::array<unsigned, 3> evaluations = {0, 0, 0};
+    std::size_t nextOutput = 0;
+    snapshot.schedule(outputTimes[nextOutput]);
+
+    while (nextOutput < outputTimes.size()) {
+      // Like the time manager, the passive sync point is called once all clusters passed it
+      const double minCorrectionTime = *std::min_element(correctionTimes.begin(), correctionTimes.end());
+      if (minCorrectionTime > snapshot.getTime() + timeTolerance) {
+        REQUIRE(snapshot.isComplete());
+        REQUIRE(evaluations == std::array<unsigned, 3>{1, 1, 1});
+        evaluations = {0, 0, 0};
+        ++nextOutput;
+        if (nextOutput < outputTimes.size()) {
+          snapshot.schedule(outputTimes[nextOutput]);
+          REQUIRE(snapshot.getNumberOfEvaluatedCells() == 0);
+        }
+        continue;
+      }
+      REQUIRE(!snapshot.isComplete());
+
+      // The cluster which lags behind computes next; on ties, the largest cluster runs ahead
+      std::size_t cluster = 0;
+      for (std::size_t other = 1; other < correctionTimes.size(); ++other) {
+        if (correctionTimes[other] <= correctionTimes[cluster]) {
+          cluster = other;
+        }
+      }
+      if (snapshot.isInStep(correctionTimes[cluster], timeStepSizes[cluster])) {
+        REQUIRE(snapshot.getTime() >= correctionTimes[cluster] - timeTolerance);
+        REQUIRE(snapshot.getTime() < correctionTimes[cluster] + timeStepSizes[cluster]);
+        snapshot.addEvaluatedCells(numberOfCells[cluster]);
+        ++evaluations[cluster];
+      }
+      correctionTimes[cluster] += timeStepSizes[cluster];
+    }
+  }
+}
+
+} // namespace seissol::unit_test
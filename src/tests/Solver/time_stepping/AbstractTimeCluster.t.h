@@ -44,6 +44,37 @@ TEST_CASE("TimeCluster") {
 
 }
 
+TEST_CASE("Clusters are woken up by messages") {
+  auto cluster1 = MockTimeCluster(1.0, 1);
+  auto cluster2 = MockTimeCluster(1.0, 1);
+  cluster1.connect(cluster2);
+
+  auto listenerCalls = 0;
+  cluster2.setWakeupListener([&]() { ++listenerCalls; });
+
+  for (auto* cluster : {&cluster1, &cluster2}) {
+    cluster->setSyncTime(10);
+    cluster->reset();
+    // A reset cluster always needs to be evaluated once
+    REQUIRE(cluster->consumeWakeup());
+    REQUIRE(!cluster->consumeWakeup());
+  }
+
+  REQUIRE_CALL(cluster1, start());
+  cluster1.act();
+  REQUIRE(!cluster2.consumeWakeup());
+  REQUIRE(!cluster2.hasPendingMessages());
+
+  // The prediction of cluster1 is sent to cluster2, which needs to wake up
+  REQUIRE_CALL(cluster1, predict());
+  cluster1.act();
+  REQUIRE(cluster2.hasPendingMessages());
+  REQUIRE(listenerCalls == 1);
+  REQUIRE(cluster2.consumeWakeup());
+  REQUIRE(!cluster2.consumeWakeup());
+  REQUIRE(!cluster1.consumeWakeup());
+}
+
 TEST_CASE("GTS Timesteping works") {
   const double dt = 1.0;
   const auto numberOfIterations = 10;
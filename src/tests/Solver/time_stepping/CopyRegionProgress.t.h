@@ -0,0 +1,59 @@
+#include <vector>
+
+#include "Solver/time_stepping/CopyRegionProgress.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Copy region progress") {
+  using time_stepping::CopyRegionProgress;
+
+  int neighbors[3][2] = {{0, 4}, {1, 2}, {1, 4}};
+  unsigned copyRegionCells[3] = {5, 0, 3};
+  MeshStructure meshStructure{};
+  meshStructure.numberOfRegions = 3;
+  meshStructure.neighboringClusters = neighbors;
+  meshStructure.numberOfCopyRegionCells = copyRegionCells;
+
+  CopyRegionProgress progress(meshStructure);
+
+  SUBCASE("Regions") {
+    REQUIRE(progress.numberOfRegions() == 3);
+    REQUIRE(progress.regionEnd(0) == 5);
+    REQUIRE(progress.regionEnd(1) == 5);
+    REQUIRE(progress.regionEnd(2) == 8);
+    REQUIRE(progress.regionCluster(0) == 4);
+    REQUIRE(progress.regionCluster(1) == 2);
+    REQUIRE(progress.regionCluster(2) == 4);
+  }
+
+  SUBCASE("Publish") {
+    // Nothing is ready before the first prediction
+    for (unsigned region = 0; region < 3; ++region) {
+      REQUIRE(progress.getReadySteps(region) == -1);
+    }
+
+    progress.publish(1, 2);
+    REQUIRE(progress.getReadySteps(0) == -1);
+    REQUIRE(progress.getReadySteps(1) == 2);
+    REQUIRE(progress.getReadySteps(2) == -1);
+
+    progress.publish(1, 4);
+    progress.publish(0, 4);
+    REQUIRE(progress.getReadySteps(0) == 4);
+    REQUIRE(progress.getReadySteps(1) == 4);
+    REQUIRE(progress.getReadySteps(2) == -1);
+  }
+
+  SUBCASE("Progression callback") {
+    // Without callback, progress does nothing
+    progress.progress();
+
+    int calls = 0;
+    progress.setProgressionCallback([&calls]() { ++calls; });
+    progress.progress();
+    progress.progress();
+    REQUIRE(calls == 2);
+  }
+}
+
+} // namespace seissol::unit_test
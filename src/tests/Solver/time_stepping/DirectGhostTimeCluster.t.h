@@ -0,0 +1,265 @@
+#ifdef USE_MPI
+#include <array>
+#include <vector>
+
+#include "Initializer/BasicTypedefs.hpp"
+#include "Parallel/MPI.h"
+#include "Solver/time_stepping/AbstractTimeCluster.h"
+#include "Solver/time_stepping/CopyRegionProgress.h"
+#include "Solver/time_stepping/DirectGhostTimeCluster.h"
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+//! Regions of a copy and ghost layer which are exchanged with the own rank
+struct SelfExchangeRegions {
+  static constexpr unsigned NumberOfRegions = 2;
+  static constexpr unsigned RegionSize = 3;
+
+  std::array<std::array<real, RegionSize>, NumberOfRegions> copyData{};
+  std::array<std::array<real, RegionSize>, NumberOfRegions> ghostData{};
+  int neighbors[NumberOfRegions][2];
+  unsigned copyRegionCells[NumberOfRegions] = {1, 1};
+  unsigned regionSizes[NumberOfRegions] = {RegionSize, RegionSize};
+  real* copyRegions[NumberOfRegions];
+  real* ghostRegions[NumberOfRegions];
+  int sendIdentifiers[NumberOfRegions];
+  int receiveIdentifiers[NumberOfRegions];
+  MPI_Request sendRequests[NumberOfRegions];
+  MPI_Request receiveRequests[NumberOfRegions];
+  MeshStructure meshStructure{};
+
+  SelfExchangeRegions(int otherGlobalClusterId,
+                      std::array<int, NumberOfRegions> sendIds,
+                      std::array<int, NumberOfRegions> receiveIds) {
+    for (unsigned region = 0; region < NumberOfRegions; ++region) {
+      neighbors[region][0] = MPI::mpi.rank();
+      neighbors[region][1] = otherGlobalClusterId;
+      copyRegions[region] = copyData[region].data();
+      ghostRegions[region] = ghostData[region].data();
+      sendIdentifiers[region] = sendIds[region];
+      receiveIdentifiers[region] = receiveIds[region];
+      sendRequests[region] = MPI_REQUEST_NULL;
+      receiveRequests[region] = MPI_REQUEST_NULL;
+    }
+    meshStructure.numberOfRegions = NumberOfRegions;
+    meshStructure.neighboringClusters = neighbors;
+    meshStructure.numberOfCopyRegionCells = copyRegionCells;
+    meshStructure.copyRegions = copyRegions;
+    meshStructure.copyRegionSizes = regionSizes;
+    meshStructure.ghostRegions = ghostRegions;
+    meshStructure.ghostRegionSizes = regionSizes;
+    meshStructure.sendIdentifiers = sendIdentifiers;
+    meshStructure.receiveIdentifiers = receiveIdentifiers;
+    meshStructure.sendRequests = sendRequests;
+    meshStructure.receiveRequests = receiveRequests;
+  }
+};
+
+class ObservedGhostTimeCluster : public DirectGhostTimeCluster {
+public:
+  using DirectGhostTimeCluster::DirectGhostTimeCluster;
+  using DirectGhostTimeCluster::sendPublishedCopyRegions;
+
+  void sendCopyLayerAt(double correctionTime) {
+    ct.correctionTime = correctionTime;
+    sendCopyLayer();
+  }
+
+  bool sendsCompleted() { return testForCopyLayerSends(); }
+};
+
+//! Receives all messages with the tag from the own rank; returns their number
+int receiveFromSelf(int tag, real* buffer, unsigned size) {
+  int numberOfMessages = 0;
+  int hasMessage = 1;
+  while (hasMessage) {
+    MPI_Iprobe(MPI::mpi.rank(), tag, MPI::mpi.comm(), &hasMessage, MPI_STATUS_IGNORE);
+    if (hasMessage) {
+      MPI_Recv(buffer, static_cast<int>(size), MPI_C_REAL, MPI::mpi.rank(), tag, MPI::mpi.comm(), MPI_STATUS_IGNORE);
+      ++numberOfMessages;
+    }
+  }
+  return numberOfMessages;
+}
+
+TEST_CASE("Ghost cluster sends published copy regions once") {
+  // Region 0 goes to cluster 1, whose ghost cluster is tested; region 1 goes to cluster 2
+  SelfExchangeRegions regions(1, {30, 31}, {30, 31});
+  regions.neighbors[1][1] = 2;
+  CopyRegionProgress progress(regions.meshStructure);
+  ObservedGhostTimeCluster ghost(1.0, 1, 0, 1, &regions.meshStructure);
+  ghost.setCopyRegionProgress(&progress);
+
+  std::array<real, SelfExchangeRegions::RegionSize> received{};
+  auto sentMessages = [&](unsigned region) {
+    const auto count = receiveFromSelf(timeData + regions.sendIdentifiers[region], received.data(), received.size());
+    REQUIRE(ghost.sendsCompleted());
+    return count;
+  };
+
+  SUBCASE("Regions are sent with the copy layer if not published") {
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(0) == 0);
+    ghost.sendCopyLayerAt(0.0);
+    REQUIRE(sentMessages(0) == 1);
+    ghost.sendCopyLayerAt(1.0);
+    REQUIRE(sentMessages(0) == 1);
+    // Regions of other clusters are not sent
+    REQUIRE(sentMessages(1) == 0);
+  }
+
+  SUBCASE("An early sent region is skipped exactly once") {
+    regions.copyData[0].fill(1.0);
+    progress.publish(0, 1);
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(0) == 1);
+    REQUIRE(received[0] == 1.0);
+
+    ghost.sendCopyLayerAt(0.0);
+    REQUIRE(sentMessages(0) == 0);
+
+    // The next step is not published, hence it is sent with the copy layer again
+    regions.copyData[0].fill(2.0);
+    ghost.sendCopyLayerAt(1.0);
+    REQUIRE(sentMessages(0) == 1);
+    REQUIRE(received[0] == 2.0);
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(0) == 0);
+  }
+
+  SUBCASE("A region is never sent twice for the same step") {
+    progress.publish(0, 2);
+    ghost.sendPublishedCopyRegions();
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(0) == 1);
+    ghost.sendCopyLayerAt(0.0);
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(0) == 0);
+
+    // The region is published, but the copy layer is sent before the ghost cluster saw it
+    progress.publish(0, 4);
+    ghost.sendCopyLayerAt(2.0);
+    REQUIRE(sentMessages(0) == 1);
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(0) == 0);
+
+    // Regions of other clusters are not sent, even if published
+    progress.publish(1, 4);
+    ghost.sendPublishedCopyRegions();
+    REQUIRE(sentMessages(1) == 0);
+  }
+}
+
+/**
+ * Emulates the copy layer of a TimeCluster: every prediction writes the number of steps it reaches
+ * to the copy regions, and publishes the regions whose prediction is announced to the ghost cluster.
+ * Every correction checks that the ghost regions hold the first prediction of the other side which
+ * reaches the end of the step.
+ **/
+class CopyLayerCluster : public AbstractTimeCluster {
+  SelfExchangeRegions& regions;
+  CopyRegionProgress* progress;
+  unsigned numberOfPublishedRegions;
+
+public:
+  CopyLayerCluster(double maxTimeStepSize,
+                   long timeStepRate,
+                   SelfExchangeRegions& regions,
+                   CopyRegionProgress* progress,
+                   unsigned numberOfPublishedRegions)
+      : AbstractTimeCluster(maxTimeStepSize, timeStepRate), regions(regions), progress(progress),
+        numberOfPublishedRegions(numberOfPublishedRegions) {}
+
+  void start() override {}
+
+  void predict() override {
+    const long predictionsAfterStep = ct.predictionsSinceStart + ct.timeStepRate;
+    const bool isAnnounced = announcesPrediction(neighbors[0], ct.predictionsSinceLastSync + ct.timeStepRate);
+    for (unsigned region = 0; region < SelfExchangeRegions::NumberOfRegions; ++region) {
+      regions.copyData[region].fill(predictionsAfterStep);
+      if (progress != nullptr && region < numberOfPublishedRegions && isAnnounced) {
+        progress->publish(region, predictionsAfterStep);
+      }
+    }
+  }
+
+  void correct() override {
+    const long stepsAfterStep = ct.stepsSinceStart + ct.timeStepRate;
+    const long otherRate = neighbors[0].ct.timeStepRate;
+    const long expectedSteps = ((stepsAfterStep + otherRate - 1) / otherRate) * otherRate;
+    for (unsigned region = 0; region < SelfExchangeRegions::NumberOfRegions; ++region) {
+      for (auto value : regions.ghostData[region]) {
+        REQUIRE(value == expectedSteps);
+      }
+    }
+  }
+
+  void handleAdvancedPredictionTimeMessage(const NeighborCluster&) override {}
+  void handleAdvancedCorrectionTimeMessage(const NeighborCluster&) override {}
+  void printTimeoutMessage(std::chrono::seconds) override {}
+};
+
+TEST_CASE("Copy and ghost clusters exchange published regions") {
+  // Two ranks are emulated on the own rank: cluster 0 has rate rate0 and cluster 1 has rate rate1.
+  // The ghost cluster of each side mirrors the copy layer of the other side.
+  const double endTime = 8.0;
+  for (const auto& rates : std::vector<std::array<long, 2>>{{1, 1}, {1, 2}, {2, 1}, {2, 4}, {4, 1}}) {
+    const long rate0 = rates[0];
+    const long rate1 = rates[1];
+    for (unsigned numberOfPublishedRegions : {0U, 1U, 2U}) {
+      for (const bool useProgress : {false, true}) {
+        CAPTURE(rate0);
+        CAPTURE(rate1);
+        CAPTURE(numberOfPublishedRegions);
+        CAPTURE(useProgress);
+
+        SelfExchangeRegions regions0(1, {40, 42}, {41, 43});
+        SelfExchangeRegions regions1(0, {41, 43}, {40, 42});
+        CopyRegionProgress progress0(regions0.meshStructure);
+        CopyRegionProgress progress1(regions1.meshStructure);
+
+        CopyLayerCluster copy0(rate0, rate0, regions0, useProgress ? &progress0 : nullptr, numberOfPublishedRegions);
+        CopyLayerCluster copy1(rate1, rate1, regions1, useProgress ? &progress1 : nullptr, numberOfPublishedRegions);
+        DirectGhostTimeCluster ghost0(rate1, rate1, 0, 1, &regions0.meshStructure);
+        DirectGhostTimeCluster ghost1(rate0, rate0, 1, 0, &regions1.meshStructure);
+        if (useProgress) {
+          ghost0.setCopyRegionProgress(&progress0);
+          ghost1.setCopyRegionProgress(&progress1);
+        }
+        copy0.connect(ghost0);
+        copy1.connect(ghost1);
+
+        const std::array<AbstractTimeCluster*, 4> clusters = {&copy0, &ghost0, &copy1, &ghost1};
+        for (auto* cluster : clusters) {
+          cluster->setSyncTime(endTime);
+          cluster->reset();
+        }
+
+        // Leaves the initial sync
+        for (auto* cluster : clusters) {
+          cluster->act();
+        }
+        bool isSynced = false;
+        for (int iteration = 0; iteration < 1000 && !isSynced; ++iteration) {
+          isSynced = true;
+          for (auto* cluster : clusters) {
+            cluster->act();
+            isSynced = isSynced && cluster->synced();
+          }
+        }
+        REQUIRE(isSynced);
+
+        // Every send was received, hence no region was sent twice
+        for (int tag : {40, 41, 42, 43}) {
+          int hasMessage = 0;
+          MPI_Iprobe(MPI::mpi.rank(), timeData + tag, MPI::mpi.comm(), &hasMessage, MPI_STATUS_IGNORE);
+          REQUIRE(!hasMessage);
+        }
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
+#endif
@@ -0,0 +1,146 @@
+#ifdef USE_MPI
+#include <array>
+#include <vector>
+
+#include "Parallel/MPI.h"
+#include "Solver/time_stepping/GhostMessageAggregator.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Ghost message aggregator") {
+  using time_stepping::GhostMessageAggregator;
+
+  // Cluster 1 exchanges with the clusters 0, 1 and 2 of the same rank, such that its copy regions
+  // form one aggregated message, which is received by the ghost regions of the three clusters.
+  const int rank = MPI::mpi.rank();
+  const std::array<unsigned, 3> sizes = {3, 5, 2};
+
+  std::array<std::vector<real>, 3> copyRegions;
+  std::array<std::vector<real>, 3> ghostRegions;
+  for (unsigned i = 0; i < 3; ++i) {
+    copyRegions[i].resize(sizes[i]);
+    ghostRegions[i].resize(sizes[i]);
+  }
+
+  // region i of cluster 1 is exchanged with cluster i; region 0 of cluster 0 and 2 with cluster 1
+  int neighbors0[1][2] = {{rank, 1}};
+  int neighbors1[3][2] = {{rank, 0}, {rank, 1}, {rank, 2}};
+  int neighbors2[1][2] = {{rank, 1}};
+  real* copy0[1] = {copyRegions[0].data()};
+  real* ghost0[1] = {ghostRegions[0].data()};
+  unsigned size0[1] = {sizes[0]};
+  real* copy1[3] = {copyRegions[0].data(), copyRegions[1].data(), copyRegions[2].data()};
+  real* ghost1[3] = {ghostRegions[0].data(), ghostRegions[1].data(), ghostRegions[2].data()};
+  unsigned size1[3] = {sizes[0], sizes[1], sizes[2]};
+  real* copy2[1] = {copyRegions[2].data()};
+  real* ghost2[1] = {ghostRegions[2].data()};
+  unsigned size2[1] = {sizes[2]};
+
+  std::array<MeshStructure, 3> meshStructures{};
+  meshStructures[0].numberOfRegions = 1;
+  meshStructures[0].neighboringClusters = neighbors0;
+  meshStructures[0].copyRegions = copy0;
+  meshStructures[0].copyRegionSizes = size0;
+  meshStructures[0].ghostRegions = ghost0;
+  meshStructures[0].ghostRegionSizes = size0;
+  meshStructures[1].numberOfRegions = 3;
+  meshStructures[1].neighboringClusters = neighbors1;
+  meshStructures[1].copyRegions = copy1;
+  meshStructures[1].copyRegionSizes = size1;
+  meshStructures[1].ghostRegions = ghost1;
+  meshStructures[1].ghostRegionSizes = size1;
+  meshStructures[2].numberOfRegions = 1;
+  meshStructures[2].neighboringClusters = neighbors2;
+  meshStructures[2].copyRegions = copy2;
+  meshStructures[2].copyRegionSizes = size2;
+  meshStructures[2].ghostRegions = ghost2;
+  meshStructures[2].ghostRegionSizes = size2;
+
+  GhostMessageAggregator aggregator(
+      {&meshStructures[0], &meshStructures[1], &meshStructures[2]});
+
+  for (unsigned region = 0; region < 3; ++region) {
+    REQUIRE(aggregator.isAggregated(1, region));
+  }
+  REQUIRE(!aggregator.isAggregated(0, 0));
+  REQUIRE(!aggregator.isAggregated(2, 0));
+
+  // the ghost region of cluster 1 to cluster i is region 0 of cluster i, except for cluster 1 itself
+  auto ghostCluster = [](unsigned region) { return static_cast<int>(region); };
+  auto ghostRegion = [](unsigned region) { return region == 1 ? 1U : 0U; };
+
+  auto fill = [&](unsigned region, real value) {
+    for (unsigned i = 0; i < sizes[region]; ++i) {
+      copyRegions[region][i] = value + i;
+      ghostRegions[region][i] = -1.0;
+    }
+  };
+  auto check = [&](unsigned region, real value) {
+    for (unsigned i = 0; i < sizes[region]; ++i) {
+      REQUIRE(ghostRegions[region][i] == value + i);
+    }
+  };
+  auto progressUntil = [&](auto&& isDone) {
+    for (unsigned i = 0; i < 100000 && !isDone(); ++i) {
+      aggregator.progress();
+    }
+    REQUIRE(isDone());
+  };
+
+  SUBCASE("All masks") {
+    for (unsigned mask = 1; mask < 8; ++mask) {
+      for (unsigned region = 0; region < 3; ++region) {
+        if ((mask & (1U << region)) != 0) {
+          fill(region, 100.0 * mask + 10.0 * region);
+          aggregator.send(1, region);
+        }
+      }
+      // Regions of odd masks are received before they arrive, the others are queued on arrival
+      if (mask % 2 == 1) {
+        for (unsigned region = 0; region < 3; ++region) {
+          if ((mask & (1U << region)) != 0) {
+            aggregator.receive(ghostCluster(region), ghostRegion(region));
+          }
+        }
+      }
+      progressUntil([&]() {
+        bool done = true;
+        for (unsigned region = 0; region < 3; ++region) {
+          done = done && aggregator.isSendCompleted(1, region);
+        }
+        return done;
+      });
+      for (unsigned region = 0; region < 3; ++region) {
+        if ((mask & (1U << region)) == 0) {
+          continue;
+        }
+        if (mask % 2 == 0) {
+          aggregator.receive(ghostCluster(region), ghostRegion(region));
+        }
+        progressUntil([&]() {
+          return aggregator.isReceiveCompleted(ghostCluster(region), ghostRegion(region));
+        });
+        check(region, 100.0 * mask + 10.0 * region);
+      }
+    }
+  }
+
+  SUBCASE("Messages are received in order") {
+    // Region 1 is sent twice before its ghost cluster receives it
+    for (unsigned message = 0; message < 2; ++message) {
+      fill(1, 10.0 * message);
+      aggregator.send(1, 1);
+      progressUntil([&]() { return aggregator.isSendCompleted(1, 1); });
+    }
+    for (unsigned message = 0; message < 2; ++message) {
+      aggregator.receive(1, 1);
+      progressUntil([&]() { return aggregator.isReceiveCompleted(1, 1); });
+      check(1, 10.0 * message);
+    }
+  }
+
+  aggregator.freeResources();
+}
+
+} // namespace seissol::unit_test
+#endif
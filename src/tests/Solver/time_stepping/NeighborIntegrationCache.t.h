@@ -0,0 +1,162 @@
+#include <array>
+#include <random>
+#include <vector>
+
+#include "Kernels/Time.h"
+#include "Kernels/TimeBuffers.h"
+#include "Kernels/TimeCommon.h"
+#include "Solver/time_stepping/NeighborIntegrationCache.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Neighbor integration cache") {
+  using time_stepping::NeighborIntegrationCache;
+
+  std::vector<real> derivatives(3);
+  real* sharedDerivatives = &derivatives[0];
+  real* otherDerivatives = &derivatives[1];
+  real* buffer = &derivatives[2];
+
+  // Cells 0 and 1 integrate the same derivatives; cell 2 uses them in GTS relation and as outflow face
+  std::vector<CellLocalInformation> cellInformation(3);
+  std::vector<std::array<real*, 4>> faceNeighbors(3);
+  for (auto& information : cellInformation) {
+    for (auto& faceType : information.faceTypes) {
+      faceType = FaceType::regular;
+    }
+  }
+  cellInformation[0].ltsSetup = 0b0001;
+  faceNeighbors[0] = {sharedDerivatives, buffer, buffer, buffer};
+  cellInformation[1].ltsSetup = 0b0100;
+  faceNeighbors[1] = {buffer, buffer, sharedDerivatives, buffer};
+  cellInformation[2].ltsSetup = 0b0001'1011;
+  cellInformation[2].faceTypes[3] = FaceType::outflow;
+  faceNeighbors[2] = {sharedDerivatives, otherDerivatives, buffer, sharedDerivatives};
+
+  const NeighborIntegrationCache cache(
+      cellInformation.data(),
+      reinterpret_cast<real* const(*)[4]>(faceNeighbors.data()),
+      static_cast<unsigned>(cellInformation.size()));
+
+  REQUIRE(cache.numberOfEntries() == 1);
+
+  SUBCASE("Shared derivatives are replaced") {
+    real* timeDofs0[4] = {sharedDerivatives, buffer, buffer, buffer};
+    REQUIRE(cache.useCachedIntegrals(0, cellInformation[0].ltsSetup, timeDofs0) == 0);
+    real* timeDofs1[4] = {buffer, buffer, sharedDerivatives, buffer};
+    REQUIRE(cache.useCachedIntegrals(1, cellInformation[1].ltsSetup, timeDofs1) == 0);
+
+    REQUIRE(timeDofs0[0] != sharedDerivatives);
+    REQUIRE(timeDofs0[0] == timeDofs1[2]);
+    REQUIRE(timeDofs0[1] == buffer);
+    REQUIRE(timeDofs1[0] == buffer);
+  }
+
+  SUBCASE("Other faces are unchanged") {
+    real* timeDofs[4] = {sharedDerivatives, otherDerivatives, buffer, sharedDerivatives};
+    REQUIRE(cache.useCachedIntegrals(2, cellInformation[2].ltsSetup, timeDofs) ==
+            cellInformation[2].ltsSetup);
+    REQUIRE(timeDofs[0] == sharedDerivatives);
+    REQUIRE(timeDofs[1] == otherDerivatives);
+    REQUIRE(timeDofs[3] == sharedDerivatives);
+  }
+}
+
+TEST_CASE("Neighbor integration cache integrates like the cell loop") {
+  using time_stepping::NeighborIntegrationCache;
+  using namespace seissol::kernels;
+
+  // Derivatives A and B as stored in the LTS tree, and a time integrated buffer
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<real> distribution(-1, 1);
+  alignas(ALIGNMENT) real storedDerivatives[2][DerivativesSize];
+  alignas(ALIGNMENT) real buffer[tensor::I::size()];
+  for (auto& derivatives : storedDerivatives) {
+    alignas(ALIGNMENT) real values[yateto::computeFamilySize<tensor::dQ>()];
+    for (auto& value : values) {
+      value = distribution(generator);
+    }
+    storeDerivatives(values, derivatives);
+  }
+  for (auto& value : buffer) {
+    value = distribution(generator);
+  }
+  real* derivativesA = storedDerivatives[0];
+  real* derivativesB = storedDerivatives[1];
+
+  // A in LTS relation is shared by cells 0 and 1, B in GTS relation by cells 0, 1 and 2,
+  // and A in GTS relation is only used by cell 2
+  std::vector<CellLocalInformation> cellInformation(3);
+  std::vector<std::array<real*, 4>> faceNeighbors(3);
+  for (auto& information : cellInformation) {
+    for (auto& faceType : information.faceTypes) {
+      faceType = FaceType::regular;
+    }
+  }
+  cellInformation[0].ltsSetup = 0b0010'0011;
+  cellInformation[0].faceTypes[3] = FaceType::outflow;
+  faceNeighbors[0] = {derivativesA, derivativesB, buffer, buffer};
+  cellInformation[1].ltsSetup = 0b0100'0101;
+  faceNeighbors[1] = {derivativesA, buffer, derivativesB, buffer};
+  cellInformation[2].ltsSetup = 0b1010'1010;
+  faceNeighbors[2] = {buffer, derivativesA, buffer, derivativesB};
+
+  NeighborIntegrationCache cache(cellInformation.data(),
+                                 reinterpret_cast<real* const(*)[4]>(faceNeighbors.data()),
+                                 static_cast<unsigned>(cellInformation.size()));
+  REQUIRE(cache.numberOfEntries() == 2);
+
+  Time timeKernel;
+  constexpr double subTimeStart = 0.3;
+  constexpr double timeStepWidth = 0.2;
+  cache.integrate(timeKernel, subTimeStart, timeStepWidth);
+
+  alignas(ALIGNMENT) real integrationBuffer[2][4][tensor::I::size()];
+  alignas(ALIGNMENT) real convertedDerivatives[ReducedPrecisionDerivatives ? 4 : 1][yateto::computeFamilySize<tensor::dQ>()];
+  for (unsigned cell = 0; cell < cellInformation.size(); ++cell) {
+    const auto& information = cellInformation[cell];
+
+    // Neighboring integration without cache
+    real* timeDofs[4];
+    real* timeIntegrated[4];
+    std::copy_n(faceNeighbors[cell].data(), 4, timeDofs);
+    loadNeighborDerivatives(information.ltsSetup, information.faceTypes, timeDofs, convertedDerivatives);
+    TimeCommon::computeIntegrals(timeKernel, information.ltsSetup, information.faceTypes, subTimeStart,
+                                 timeStepWidth, timeDofs, integrationBuffer[0], timeIntegrated);
+
+    // Neighboring integration with cache
+    real* cachedTimeDofs[4];
+    real* cachedTimeIntegrated[4];
+    std::copy_n(faceNeighbors[cell].data(), 4, cachedTimeDofs);
+    const auto ltsSetup = cache.useCachedIntegrals(cell, information.ltsSetup, cachedTimeDofs);
+    loadNeighborDerivatives(ltsSetup, information.faceTypes, cachedTimeDofs, convertedDerivatives);
+    TimeCommon::computeIntegrals(timeKernel, ltsSetup, information.faceTypes, subTimeStart,
+                                 timeStepWidth, cachedTimeDofs, integrationBuffer[1], cachedTimeIntegrated);
+
+    for (unsigned face = 0; face < 4; ++face) {
+      if (information.faceTypes[face] == FaceType::outflow) {
+        continue;
+      }
+      CAPTURE(cell);
+      CAPTURE(face);
+      for (unsigned i = 0; i < tensor::I::size(); ++i) {
+        REQUIRE(cachedTimeIntegrated[face][i] == timeIntegrated[face][i]);
+      }
+    }
+  }
+
+  // The integrals differ for both expansion points, hence the comparison detects a wrong start time
+  real* timeDofs[4] = {derivativesA, derivativesA, buffer, buffer};
+  FaceType faceTypes[4] = {FaceType::regular, FaceType::regular, FaceType::regular, FaceType::regular};
+  real* timeIntegrated[4];
+  loadNeighborDerivatives(0b0010'0011, faceTypes, timeDofs, convertedDerivatives);
+  TimeCommon::computeIntegrals(timeKernel, 0b0010'0011, faceTypes, subTimeStart, timeStepWidth, timeDofs,
+                               integrationBuffer[0], timeIntegrated);
+  bool isDifferent = false;
+  for (unsigned i = 0; i < tensor::I::size(); ++i) {
+    isDifferent = isDifferent || timeIntegrated[0][i] != timeIntegrated[1][i];
+  }
+  REQUIRE(isDifferent);
+}
+
+} // namespace seissol::unit_test
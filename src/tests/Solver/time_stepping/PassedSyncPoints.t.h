@@ -0,0 +1,80 @@
+#include <memory>
+#include <vector>
+
+#include "Modules/Module.h"
+#include "Solver/time_stepping/PassedSyncPoints.h"
+
+namespace seissol::unit_test {
+
+class PassiveSyncModule : public Module {
+  const std::vector<MockTimeCluster*>& clusters;
+
+public:
+  std::vector<double> calledSyncPoints;
+
+  PassiveSyncModule(double syncInterval, const std::vector<MockTimeCluster*>& clusters) : clusters(clusters) {
+    setSyncInterval(syncInterval);
+    setSimulationStartTime(0.0);
+  }
+
+  void syncPoint(double currentTime) override {
+    // All clusters have passed the synchronization point
+    for (auto* cluster : clusters) {
+      REQUIRE(cluster->getCorrectionTime() > currentTime);
+    }
+    calledSyncPoints.push_back(currentTime);
+  }
+
+  bool requiresSynchronizedClusters() const override { return false; }
+};
+
+TEST_CASE("Passed synchronization points are called once") {
+  constexpr double TimeTolerance = 1e-9;
+  const double endTime = 12.0;
+  auto cluster1 = MockTimeCluster(1.0, 1);
+  auto cluster2 = MockTimeCluster(2.0, 2);
+  auto cluster4 = MockTimeCluster(4.0, 4);
+  const auto clusters = std::vector<MockTimeCluster*>{&cluster1, &cluster2, &cluster4};
+  cluster1.connect(cluster2);
+  cluster2.connect(cluster4);
+
+  // Every time step passes several synchronization points
+  const double syncInterval = 0.25;
+  PassiveSyncModule module(syncInterval, clusters);
+  time_stepping::PassedSyncPoints passedSyncPoints(
+      [&module](double currentTime, double timeTolerance) { return module.passedSyncPoint(currentTime, timeTolerance); });
+
+  std::vector<std::unique_ptr<trompeloeil::expectation>> expectations;
+  for (auto* cluster : clusters) {
+    expectations.push_back(NAMED_ALLOW_CALL(*cluster, start()));
+    expectations.push_back(NAMED_ALLOW_CALL(*cluster, predict()));
+    expectations.push_back(NAMED_ALLOW_CALL(*cluster, correct()));
+    expectations.push_back(NAMED_ALLOW_CALL(*cluster, handleAdvancedPredictionTimeMessage(ANY(NeighborCluster))));
+    expectations.push_back(NAMED_ALLOW_CALL(*cluster, handleAdvancedCorrectionTimeMessage(ANY(NeighborCluster))));
+    cluster->setSyncTime(endTime);
+    cluster->reset();
+  }
+  for (auto* cluster : clusters) {
+    cluster->act();
+  }
+
+  bool isSynced = false;
+  for (int iteration = 0; iteration < 1000 && !isSynced; ++iteration) {
+    isSynced = true;
+    for (auto* cluster : clusters) {
+      cluster->act();
+      passedSyncPoints.update(clusters, TimeTolerance);
+      isSynced = isSynced && cluster->synced();
+    }
+  }
+  REQUIRE(isSynced);
+
+  // The synchronization point at the end time is called with the synchronized clusters
+  std::vector<double> expectedSyncPoints;
+  for (double syncPoint = syncInterval; syncPoint < endTime; syncPoint += syncInterval) {
+    expectedSyncPoints.push_back(syncPoint);
+  }
+  REQUIRE(module.calledSyncPoints == expectedSyncPoints);
+}
+
+} // namespace seissol::unit_test
@@ -2,3 +2,9 @@
 #include <doctest/trompeloeil.hpp>
 
 #include "AbstractTimeCluster.t.h"
+#include "CopyRegionProgress.t.h"
+#include "DirectGhostTimeCluster.t.h"
+#include "GhostMessageAggregator.t.h"
+#include "NeighborIntegrationCache.t.h"
+#include "PassedSyncPoints.t.h"
+#include "ThreadGroups.t.h"
@@ -0,0 +1,34 @@
+#include <numeric>
+
+#include "Solver/time_stepping/ThreadGroups.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Thread partitioning") {
+  using time_stepping::partitionThreads;
+
+  SUBCASE("All threads are used") {
+    for (const auto& costs : std::vector<std::vector<double>>{
+             {1.0}, {1.0, 1.0}, {0.1, 5.0, 2.0}, {1e-6, 1e-6, 1e3}, {0.0, 0.0}}) {
+      const auto threads = partitionThreads(costs, 16);
+      REQUIRE(threads.size() == costs.size());
+      REQUIRE(std::accumulate(threads.begin(), threads.end(), 0) == 16);
+      for (const auto numThreads : threads) {
+        REQUIRE(numThreads >= 1);
+      }
+    }
+  }
+
+  SUBCASE("Threads follow the costs") {
+    const auto threads = partitionThreads({1.0, 3.0}, 8);
+    REQUIRE(threads[0] == 2);
+    REQUIRE(threads[1] == 6);
+  }
+
+  SUBCASE("Cheap items still get one thread") {
+    const auto threads = partitionThreads({1e-9, 1.0, 1.0}, 3);
+    REQUIRE(threads == std::vector<int>{1, 1, 1});
+  }
+}
+
+} // namespace seissol::unit_test